@@ -38,3 +38,91 @@
 #define BTN_LEFT   5
 #define BTN_RIGHT 17
 
+// Ethernet-PHY (LAN8720 auf dem WT32-ETH01, RMII-Takt von GPIO0)
+#define LAN_PHY_ADDR   1
+#define LAN_PHY_POWER 16
+#define LAN_PHY_MDC   23
+#define LAN_PHY_MDIO  18
+
+// Front-Panel-Taster (gegen GND, INPUT_PULLUP), gemeinsam entprellt in NavButtons.
+// Reihenfolge = Bit im Debouncer; ein weiterer Taster wird hier angehaengt
+// (+ Eintrag in KEY_SOURCE in NavButtons.cpp).
+#define FRONT_KEY_PINS ENC_SW, BTN_LEFT, BTN_RIGHT
+
+// TFT Framebuffer (Off-Screen-Puffer)
+// 1 = Zeichenprimitive schreiben in einen Puffer im RAM,
+//     flushDisplay() schiebt danach nur die geaenderten Rechtecke per SPI raus.
+// 0 = direktes Zeichnen ueber SPI (altes Verhalten, kein RAM-Bedarf)
+#define TFT_FRAMEBUFFER 1
+
+// Pixelformat des Framebuffers
+// 16 = RGB565 (160x128x2 = 40 KB)
+//  4 = Palettenindex, 16 Farben (160x128/2 = 10 KB), RGB565 erst beim Flush
+//      -> laesst internen RAM fuer den Ethernet-Stack uebrig
+#define TFT_FRAMEBUFFER_BPP 4
+
+// Maximale Anzahl getrennt gefuehrter Dirty-Rechtecke bis zum naechsten flushDisplay().
+// Reicht der Platz nicht, werden die guenstigsten Rechtecke zusammengefasst.
+#define TFT_DIRTY_RECTS 8
+
+// Asynchroner Flush per SPI-DMA (ESP-IDF spi_master, benoetigt TFT_FRAMEBUFFER)
+// 1 = flushDisplayAsync() kehrt sofort zurueck, Uebertragung laeuft im Hintergrund
+#define TFT_DMA_FLUSH 1
+
+// Groesse eines DMA-Staging-Puffers in Pixeln (2 Stueck, >= Displaybreite)
+// 160 * 8 = 1280 Pixel => 2x 2.5 KB DMA-faehiger RAM
+#define TFT_DMA_BAND_PX (160 * 8)
+
+// SPI-Takt fuer den DMA-Treiber
+#define TFT_SPI_HZ 27000000
+
+// flushDisplay() wartet hoechstens so lange auf den DMA (ganzes Bild ~12 ms bei 27 MHz),
+// danach wird der Frame verworfen und beim naechsten Flush komplett gesendet
+#define TFT_FLUSH_TIMEOUT_MS 100
+
+// Latenzmessung Eingabe -> Display (lib/LatencyTrace)
+// 1 = Histogramme p50/p99/max, Ausgabe per 'l' ueber Serial ('r' = zuruecksetzen)
+// 0 = alle Messpunkte sind No-Ops
+#define LATENCY_TRACE 1
+
+// Ausfuehrung in getrennten Tasks (lib/TaskRuntime, FreeRTOS)
+// 0 = alles in loop() ueber guiUpdate() (ein Kern)
+// 1 = Input-Task (Encoder/Taster + State Machine), Render-Task (besitzt TFTDisplay)
+//     und Netz-Task (Radio-Client, Telemetrie, Web-Spiegel, eigenes Timer-Rad);
+//     Austausch ueber Input-Queue, UI-Snapshot und RadioView/Telemetrie-Snapshots
+#define GUI_TASKS 0
+
+// Input-Task: hohe Prioritaet, Kern 0 (neben dem Ethernet-Stack), jede Millisekunde
+#define TASK_INPUT_CORE   0
+#define TASK_INPUT_PRIO   5
+#define TASK_INPUT_STACK  4096
+#define TASK_INPUT_PERIOD_MS 1
+
+// Render-Task: Kern 1 (wie loop()), blockierende SPI-Transfers bremsen nur ihn selbst
+#define TASK_RENDER_CORE  1
+#define TASK_RENDER_PRIO  2
+#define TASK_RENDER_STACK 8192
+#define TASK_RENDER_PERIOD_MS 1
+
+// Netz-Task: Sockets (NetMux-poll()), HTTP/WebSocket-Parsing und Radio-Timer, damit
+// sie das Abtasten im Input-Task nicht verzoegern. Kern 1 ueber dem Render-Task:
+// er schreibt die Snapshots, die der Render-Task liest (Snapshot.h: ein Leser darf
+// auf demselben Kern nicht hoeher priorisiert sein als der Schreiber)
+#define TASK_NET_CORE   1
+#define TASK_NET_PRIO   3
+#define TASK_NET_STACK  6144
+#define TASK_NET_PERIOD_MS 1
+
+// Ereignisgesteuerte Hauptschleife (lib/EventLoop, nur ohne GUI_TASKS)
+// loop() ruht bis Encoder/Taster-Interrupt oder naechster Deadline (Frame, Toast, Entprellung).
+// 1 = lange Ruhephasen (>= EVENT_LOOP_SLEEP_MIN_US) im Light Sleep; EMAC und UART
+//     stehen dann => Netzwerk-Module sperren ihn per eventLoopInhibitSleep()
+#define EVENT_LOOP_LIGHT_SLEEP 1
+
+// Pins, die den Light Sleep beenden (Encoder-Spuren + alle Front-Panel-Taster)
+#define EVENT_WAKE_PINS ENC_CLK, ENC_DT, FRONT_KEY_PINS
+
+// 1 = Serial-Empfang beendet den Light Sleep (Diagnose 'l'/'r').
+//     Das erste Zeichen nach dem Schlaf weckt nur und geht verloren => Befehl
+//     ggf. zweimal senden. 0 = Serial-Befehle nur, solange der Schlaf gesperrt ist
+#define EVENT_WAKE_UART 1
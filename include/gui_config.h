@@ -47,6 +47,10 @@ struct GuiTheme {
   GuiColor line_color    = {80, 80, 80};
   GuiColor cursor_color  = {255, 255, 0};
   GuiColor toast_color   = {0, 255, 0};
+
+  // Meter (Telemetrie): leuchtende / dunkle Segmente
+  GuiColor meter_on      = {0, 200, 0};
+  GuiColor meter_off     = {40, 40, 40};
 };
 
 struct GuiConstraints {
@@ -60,12 +64,28 @@ struct GuiConstraints {
   // false = CLAMP (empfohlen), true = WRAP
   bool frq_wrap = false;
 
+  // Encoder-Beschleunigung (nur FRQ): Schrittweite der Cursor-Stelle x Faktor
+  // bis accel_min_sps Schritte/s Faktor 1, ab accel_max_sps accel_max_factor,
+  // dazwischen quadratisch (accel_max_factor = 1 => aus)
+  uint16_t accel_min_sps    = 10;
+  uint16_t accel_max_sps    = 60;
+  uint16_t accel_max_factor = 50;
+
   // Toast-Dauer (Header wird durch Toast ersetzt)
   uint32_t toast_ms = 2000;
 
   // Layout-Zonenhöhen (in Pixeln)
   uint16_t header_h = 28;   // 0..27 (unterste Zeile ist Trennlinie)
   uint16_t footer_h = 22;   // letzte 22 Pixel
+
+  // Meter über dem Footer (S / SWR / FWD), Segmente je Balken
+  uint8_t  meter_segments     = 8;
+  uint16_t meter_swr_max_x100 = 300;   // SWR 3.0 => Vollausschlag
+  uint16_t meter_fwd_max_dw   = 500;   // 50 W => Vollausschlag
+
+  // Render-Scheduler
+  uint16_t render_fps       = 30;     // max. Redraws pro Sekunde (0 = ohne Limit)
+  uint32_t render_budget_us = 4000;   // max. Renderzeit am Stück, danach Eingaben pollen
 };
 
 struct GuiDefaults {
@@ -0,0 +1,74 @@
+// include/radio_config.h
+#pragma once
+#include <stdint.h>
+
+/*
+  Radio-Konfiguration (Netzwerk, Steuerprotokoll)
+  -----------------------------------------------
+  Verbindung:
+    - WT32-ETH01 (LAN8720) per Ethernet, IP per DHCP
+    - Das Radio ist TCP-Server, das Panel verbindet sich als Client
+    - Mehrere Radios (RADIO_LIST, bis RADIO_MAX): alle bleiben verbunden und
+      werden synchron gehalten, die GUI bedient jeweils eines (Radio-Screen)
+
+  Steuerprotokoll (ASCII, eine Zeile je Kommando, Kodierung: lib/RadioCodec):
+    - Panel -> Radio: "<seq> SET FRQ <hz>\n", "<seq> SET MOD <index>\n", "<seq> SET PWR <index>\n"
+    - Radio -> Panel: "<seq> OK\n" bzw. "<seq> ERR <text>\n" (in Reihenfolge)
+    - Zuruecklesen: "<seq> GET FRQ|MOD|PWR\n" => "<seq> OK <wert>\n"
+    - MOD/PWR-Index = Position in GUI_MOD_LIST / GUI_PWR_LIST
+
+  Telemetrie (eigener Port, Radio -> Panel, 10..20 Zeilen/s, lib/RadioTelemetry):
+    - "TLM S=<dBm> SWR=<x100> FWD=<0.1 W>\n", z.B. "TLM S=-73 SWR=150 FWD=250\n"
+    - Felder in beliebiger Reihenfolge, fehlende behalten ihren Wert, unbekannte
+      werden uebersprungen
+*/
+
+// Max. Radios in RADIO_LIST (je Radio Steuer- + Telemetrie-Verbindung, lib/NetMux)
+#ifndef RADIO_MAX
+#define RADIO_MAX 8
+#endif
+
+// Max. gleichzeitig unbestaetigte Kommandos (Pipeline, je Radio)
+#ifndef RADIO_PIPELINE_DEPTH
+#define RADIO_PIPELINE_DEPTH 4
+#endif
+
+// Endpunkte eines Radios
+struct RadioEndpoint {
+  const char* name;          // Anzeige im Radio-Screen (kurz, Listenschrift)
+  const char* host;          // IPv4-Adresse als Text
+  uint16_t port;             // Steuerung
+  uint16_t telemetry_port;   // Telemetrie-Strom (gleicher Host), 0 = aus
+};
+
+// Zeiten gelten fuer alle Radios
+struct RadioConfig {
+  // Keine Quittung innerhalb dieser Zeit => Verbindung gilt als tot
+  uint32_t ack_timeout_ms = 1000;
+
+  // Verbindungsaufbau: Abbruch nach
+  uint32_t connect_timeout_ms = 2000;
+
+  // Neuer Versuch nach retry_ms, bei jedem weiteren Fehlschlag doppelt so lange
+  // (+-12.5% Zufall, damit mehrere Panels nicht im Gleichschritt anklopfen),
+  // hoechstens retry_max_ms. Eine beantwortete Verbindung setzt zurueck.
+  uint32_t retry_ms = 250;
+  uint32_t retry_max_ms = 8000;
+
+  // Stand des Radios zyklisch zuruecklesen (am Geraet verstellt?), 0 = nur beim Verbinden
+  uint32_t readback_ms = 2000;
+
+  // So lange ohne Rahmen => Werte ungueltig, neu verbinden
+  uint32_t telemetry_timeout_ms = 1000;
+
+  // Sockets so oft abfragen (netMuxPoll()), solange ein Telemetrie-Strom
+  // verbunden ist (Rahmenabstand 50..100 ms)
+  uint32_t telemetry_poll_ms = 10;
+};
+
+// --- Radios (C++11-kompatibel: extern + Definition in src/radio_config.cpp) ---
+extern const RadioEndpoint RADIO_LIST[];
+extern const int RADIO_COUNT;
+
+// Definition in src/radio_config.cpp
+extern const RadioConfig RADIO_CONFIG;
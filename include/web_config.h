@@ -0,0 +1,61 @@
+// include/web_config.h
+#pragma once
+#include <stdint.h>
+
+/*
+  Web-Spiegel des Panels (HTTP + WebSocket, lib/WebMirror)
+  --------------------------------------------------------
+  Browser im selben Netz:
+    - "GET /"   => statische Seite (im Flash, lib/WebMirror/WebPage.h)
+    - "GET /ws" => WebSocket (RFC 6455, nur Text-Rahmen)
+
+  Server -> Browser (JSON, nur geänderte Felder):
+    - einmal nach dem Verbinden: {"mod":[..],"pwr":[..],"rad":[..]} (Listen-Texte)
+    - danach Deltas mit Ein-Buchstaben-Schlüsseln, z.B. {"f":145500000,"c":3}
+        s Screen (GuiScreen), e Edit (0/1), c Cursor, r aktives Radio,
+        f Frequenz in Hz, m MOD-Index, p PWR-Index, l Verbindung (RadioLinkState)
+    - das erste Delta enthält alle Felder
+
+  Browser -> Server (Text, wie die Eingaben am Panel):
+    - "rot <n>"  n Encoder-Schritte (negativ = gegen Uhrzeigersinn)
+    - "press" / "long"  Encoder-Taster kurz / lang
+    - "left" / "right"  Nav-Taster
+*/
+
+// Gleichzeitige Verbindungen (Seite laden + WebSockets), je eine im NetMux
+#ifndef WEB_CLIENTS_MAX
+#define WEB_CLIENTS_MAX 4
+#endif
+
+// Empfangspuffer je Verbindung (HTTP-Anfrage bzw. ein WebSocket-Rahmen)
+#ifndef WEB_RX_SIZE
+#define WEB_RX_SIZE 512
+#endif
+
+// Sendepuffer je Verbindung (Antwort-Kopf, Deltas); Seite kommt direkt aus dem Flash
+#ifndef WEB_TX_SIZE
+#define WEB_TX_SIZE 512
+#endif
+
+struct WebConfig {
+  // TCP-Port, 0 = Web-Spiegel aus (Standard). Solange der Server lauscht, sperrt er
+  // den Light Sleep (EVENT_LOOP_LIGHT_SLEEP in config.h): im Sleep steht der EMAC,
+  // Browser koennten nicht verbinden. Mit Port (z.B. 80) also kein tickless Sleep.
+  uint16_t port = 0;
+
+  // Sockets so oft abfragen (netMuxPoll()), solange der Server lauscht
+  uint32_t poll_ms = 20;
+
+  // HTTP-Anfrage nicht innerhalb dieser Zeit vollständig => Verbindung schließen
+  uint32_t request_timeout_ms = 3000;
+
+  // Beim Schließen (Seite, Fehler, Close-Rahmen) so lange kein Byte mehr
+  // abgenommen => Verbindung verwerfen (Browser liest nicht)
+  uint32_t send_timeout_ms = 3000;
+
+  // Höchstens so viele Encoder-Schritte je "rot"-Nachricht
+  uint16_t rot_max = 32;
+};
+
+// Definition in src/web_config.cpp
+extern const WebConfig WEB_CONFIG;
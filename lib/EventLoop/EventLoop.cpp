@@ -0,0 +1,138 @@
+// lib/EventLoop/EventLoop.cpp
+//
+// ESP32-Port der ereignisgesteuerten Hauptschleife (siehe EventLoop.h).
+//
+// - Warten: ulTaskNotifyTake() auf den Loop-Task, Signal per (ISR-)Notification.
+//   Unter einem Tick (1 ms) wird nicht blockiert, sondern direkt weitergemacht.
+// - Light Sleep: GPIO-Wakeup auf den Gegenpegel jedes Pins in EVENT_WAKE_PINS.
+//   Die Flanken-Interrupts der Pins sind solange aus (der Wakeup schaltet sie auf
+//   Pegel um, die ISR wuerde sonst endlos feuern) und werden danach wiederhergestellt;
+//   die Flanke, die geweckt hat, liest der Aufrufer nach (EVENT_IDLE_SLEEP).
+//   Waehrend des Light Sleep stehen EMAC und UART => vorher Serial leeren,
+//   Netzwerk-Module sperren den Schlaf per eventLoopInhibitSleep(). Mit
+//   EVENT_WAKE_UART weckt auch Serial-Empfang (erstes Zeichen geht verloren).
+
+#ifdef ESP32
+
+#include "EventLoop.h"
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <driver/gpio.h>
+#include <driver/uart.h>
+#include <esp_sleep.h>
+
+#include <atomic>
+
+#ifndef EVENT_LOOP_LIGHT_SLEEP
+#define EVENT_LOOP_LIGHT_SLEEP 0
+#endif
+
+#ifndef EVENT_WAKE_UART
+#define EVENT_WAKE_UART 0
+#endif
+
+static TaskHandle_t loopTask = nullptr;
+static std::atomic<bool> signaled(false);
+static std::atomic<int16_t> inhibit(0);
+static EventLoopStats stats = {};
+
+void eventLoopInit() {
+  loopTask = xTaskGetCurrentTaskHandle();
+  signaled.store(false, std::memory_order_relaxed);
+  inhibit.store(0, std::memory_order_relaxed);
+  stats = EventLoopStats{};
+}
+
+void IRAM_ATTR eventLoopSignal() {
+  signaled.store(true, std::memory_order_release);
+  if (!loopTask) return;
+
+  if (xPortInIsrContext()) {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(loopTask, &woken);
+    if (woken) portYIELD_FROM_ISR();
+  } else {
+    xTaskNotifyGive(loopTask);
+  }
+}
+
+void eventLoopInhibitSleep(bool on) {
+  inhibit.fetch_add(on ? 1 : -1, std::memory_order_relaxed);
+}
+
+#if EVENT_LOOP_LIGHT_SLEEP
+static const uint8_t WAKE_PINS[] = { EVENT_WAKE_PINS };
+
+/**
+ * @brief Light Sleep bis GPIO-Pegelwechsel oder Timer.
+ */
+static void lightSleep(uint32_t us) {
+  Serial.flush();   // UART steht im Light Sleep
+
+  for (uint8_t pin : WAKE_PINS) {
+    gpio_intr_disable((gpio_num_t)pin);
+    const gpio_int_type_t wake = digitalRead(pin) ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL;
+    gpio_wakeup_enable((gpio_num_t)pin, wake);
+  }
+  esp_sleep_enable_gpio_wakeup();
+  esp_sleep_enable_timer_wakeup(us);
+#if EVENT_WAKE_UART
+  // RX-Flanken zaehlen (Minimum 3): das weckende Zeichen selbst geht verloren
+  uart_set_wakeup(UART_NUM_0, 3);
+  esp_sleep_enable_uart_wakeup(0);
+#endif
+
+  // Flanke nach der Pegelabfrage: Wakeup-Pegel liegt schon an => sofort wieder wach
+  if (!signaled.load(std::memory_order_acquire)) esp_light_sleep_start();
+
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+#if EVENT_WAKE_UART
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_UART);
+#endif
+  for (uint8_t pin : WAKE_PINS) {
+    gpio_wakeup_disable((gpio_num_t)pin);
+    gpio_set_intr_type((gpio_num_t)pin, GPIO_INTR_ANYEDGE);   // attachInterrupt(CHANGE)
+    gpio_intr_enable((gpio_num_t)pin);
+  }
+}
+#endif
+
+uint8_t eventLoopIdle(uint32_t timeoutUs) {
+  stats.passes++;
+
+  // Signal seit dem letzten Durchlauf => gleich weiter
+  if (signaled.exchange(false, std::memory_order_acq_rel)) {
+    ulTaskNotifyTake(pdTRUE, 0);
+    stats.signals++;
+    return EVENT_IDLE_NONE;
+  }
+
+  const bool sleepAllowed = EVENT_LOOP_LIGHT_SLEEP && inhibit.load(std::memory_order_relaxed) <= 0;
+  const EventIdlePlan plan = eventLoopPlan(timeoutUs, sleepAllowed);
+
+#if EVENT_LOOP_LIGHT_SLEEP
+  if (plan.mode == EVENT_IDLE_SLEEP) {
+    lightSleep(plan.us);
+    stats.sleeps++;
+    if (signaled.exchange(false, std::memory_order_acq_rel)) stats.signals++;
+    return EVENT_IDLE_SLEEP;
+  }
+#endif
+
+  const TickType_t ticks = pdMS_TO_TICKS(plan.us / 1000);
+  if (plan.mode == EVENT_IDLE_NONE || ticks == 0) return EVENT_IDLE_NONE;
+
+  stats.waits++;
+  if (ulTaskNotifyTake(pdTRUE, ticks) > 0) stats.signals++;
+  signaled.store(false, std::memory_order_relaxed);
+  return EVENT_IDLE_WAIT;
+}
+
+EventLoopStats eventLoopStats() {
+  return stats;
+}
+
+#endif
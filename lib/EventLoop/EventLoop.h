@@ -0,0 +1,49 @@
+// lib/EventLoop/EventLoop.h
+//
+// Ereignisgesteuerte Hauptschleife: loop() laeuft nur, wenn es etwas zu tun gibt.
+//
+// Ablauf pro Durchlauf (src/main.cpp):
+//   guiUpdate();                                   // Arbeit
+//   eventLoopIdle(naechste Deadline aller Module); // ruhen
+//
+// - Geweckt wird durch eventLoopSignal() (Encoder-/Taster-ISR, spaeter Netzwerk)
+//   oder durch Ablauf der Deadline (Toast, Entprell-Tick, naechster Frame).
+// - Ein Signal zwischen Deadline-Berechnung und Ruhen geht nicht verloren
+//   (FreeRTOS Task-Notification zaehlt mit).
+// - Lange Ruhe (>= EVENT_LOOP_SLEEP_MIN_US) => ESP32 Light Sleep mit GPIO-Wakeup
+//   auf EVENT_WAKE_PINS (optional Serial-Empfang, EVENT_WAKE_UART) und
+//   Timer-Wakeup kurz vor der Deadline. Danach liest der Aufrufer Encoder und
+//   Taster neu ein (ihre ISRs laufen im Schlaf nicht).
+//   Mit eventLoopInhibitSleep() kann ein Modul Light Sleep voruebergehend sperren.
+//
+// Host: gleiche API, "Ruhen" stellt die Fake-Clock (lib/HostSim) vor.
+
+#pragma once
+#include <stdint.h>
+
+#include "EventLoopPlan.h"
+
+struct EventLoopStats {
+  uint32_t passes;     // Aufrufe von eventLoopIdle()
+  uint32_t waits;      // davon blockierend gewartet
+  uint32_t sleeps;     // davon Light Sleep
+  uint32_t signals;    // Aufwachen durch Ereignis (nicht durch Deadline)
+};
+
+// Im Task der Hauptschleife aufrufen (setup()), vor dem ersten Signal
+void eventLoopInit();
+
+// Hauptschleife wecken (aus ISR oder anderem Task)
+void eventLoopSignal();
+
+// Light Sleep sperren/freigeben (Zaehler, z.B. waehrend Netzwerkverkehr)
+void eventLoopInhibitSleep(bool inhibit);
+
+/**
+ * @brief Ruhen bis Ereignis oder Deadline.
+ * @param timeoutUs  Zeit bis zur naechsten Deadline (EVENT_NO_DEADLINE = keine)
+ * @return EventIdleMode, der tatsaechlich benutzt wurde
+ */
+uint8_t eventLoopIdle(uint32_t timeoutUs);
+
+EventLoopStats eventLoopStats();
@@ -0,0 +1,61 @@
+// lib/EventLoop/EventLoopHost.cpp
+//
+// Host-Port der ereignisgesteuerten Hauptschleife (siehe EventLoop.h).
+//
+// Es gibt keine echte Nebenlaeufigkeit: Ereignisse entstehen nur zwischen zwei
+// Durchlaeufen (hostSetPin() ruft die ISR synchron auf). "Ruhen" stellt daher
+// einfach die Fake-Clock um die geplante Dauer vor; der Aufrufer begrenzt
+// timeoutUs auf die Zeit bis zum naechsten Skript-Ereignis.
+
+#ifndef ARDUINO
+
+#include "EventLoop.h"
+
+#include <HostSim.h>
+
+#ifndef EVENT_LOOP_LIGHT_SLEEP
+#define EVENT_LOOP_LIGHT_SLEEP 0
+#endif
+
+static bool signaled = false;
+static int16_t inhibit = 0;
+static EventLoopStats stats = {};
+
+void eventLoopInit() {
+  signaled = false;
+  inhibit = 0;
+  stats = EventLoopStats{};
+}
+
+void eventLoopSignal() {
+  signaled = true;
+}
+
+void eventLoopInhibitSleep(bool on) {
+  inhibit += on ? 1 : -1;
+}
+
+uint8_t eventLoopIdle(uint32_t timeoutUs) {
+  stats.passes++;
+
+  if (signaled) {
+    signaled = false;
+    stats.signals++;
+    return EVENT_IDLE_NONE;
+  }
+
+  const EventIdlePlan plan = eventLoopPlan(timeoutUs, EVENT_LOOP_LIGHT_SLEEP && inhibit <= 0);
+  if (plan.mode == EVENT_IDLE_NONE) return EVENT_IDLE_NONE;
+
+  // Light Sleep wacht EVENT_LOOP_SLEEP_MARGIN_US frueher auf, der Rest wird gewartet
+  if (plan.mode == EVENT_IDLE_SLEEP) stats.sleeps++;
+  else stats.waits++;
+  hostAdvanceUs(plan.us);
+  return plan.mode;
+}
+
+EventLoopStats eventLoopStats() {
+  return stats;
+}
+
+#endif
@@ -0,0 +1,70 @@
+// lib/EventLoop/EventLoopPlan.h
+//
+// Entscheidung "wie lange und wie tief darf die Hauptschleife ruhen?"
+// als reine Funktion, damit sie auf dem Host mit Fake-Clock testbar ist.
+//
+// Eingabe: Zeit bis zur naechsten Deadline (EVENT_NO_DEADLINE = keine) und
+// ob Light Sleep gerade erlaubt ist. Ausgabe: Modus + Dauer.
+
+#pragma once
+#include <stdint.h>
+
+#include <config.h>
+
+// "Keine Deadline": nur ein Ereignis (Interrupt, Netzwerk) weckt
+#define EVENT_NO_DEADLINE 0xFFFFFFFFUL
+
+// Light Sleep erst ab so langer Ruhe (darunter lohnt sich der Wechsel nicht)
+#ifndef EVENT_LOOP_SLEEP_MIN_US
+#define EVENT_LOOP_SLEEP_MIN_US 20000UL
+#endif
+
+// So viel frueher aufwachen als die Deadline (Aufwachzeit des Chips)
+#ifndef EVENT_LOOP_SLEEP_MARGIN_US
+#define EVENT_LOOP_SLEEP_MARGIN_US 1000UL
+#endif
+
+// Spaetestens nach dieser Zeit ein Durchlauf, auch ohne Deadline
+#ifndef EVENT_LOOP_MAX_WAIT_US
+#define EVENT_LOOP_MAX_WAIT_US 1000000UL
+#endif
+
+enum EventIdleMode : uint8_t {
+  EVENT_IDLE_NONE = 0,   // sofort weiter (Arbeit ansteht)
+  EVENT_IDLE_WAIT,       // blockierend warten (CPU schlaeft im Idle-Task)
+  EVENT_IDLE_SLEEP       // ESP32 Light Sleep, Wecken per GPIO oder Timer
+};
+
+struct EventIdlePlan {
+  uint8_t mode;    // EventIdleMode
+  uint32_t us;     // maximale Dauer
+};
+
+/**
+ * @brief Naechste Deadline aus zwei Restzeiten (EVENT_NO_DEADLINE = keine).
+ */
+static inline uint32_t eventDeadlineMin(uint32_t a, uint32_t b) {
+  return (a < b) ? a : b;
+}
+
+/**
+ * @brief Ruhephase planen.
+ *
+ * @param timeoutUs     Zeit bis zur naechsten Deadline
+ * @param sleepAllowed  Light Sleep erlaubt (Konfiguration + keine Sperre)
+ */
+static inline EventIdlePlan eventLoopPlan(uint32_t timeoutUs, bool sleepAllowed) {
+  EventIdlePlan p = { EVENT_IDLE_NONE, 0 };
+  if (timeoutUs == 0) return p;
+
+  if (timeoutUs > EVENT_LOOP_MAX_WAIT_US) timeoutUs = EVENT_LOOP_MAX_WAIT_US;
+
+  if (sleepAllowed && timeoutUs >= EVENT_LOOP_SLEEP_MIN_US) {
+    p.mode = EVENT_IDLE_SLEEP;
+    p.us = timeoutUs - EVENT_LOOP_SLEEP_MARGIN_US;
+  } else {
+    p.mode = EVENT_IDLE_WAIT;
+    p.us = timeoutUs;
+  }
+  return p;
+}
@@ -8,57 +8,199 @@
 //     - wenn nicht im Edit: Edit aktivieren, Cursor sichtbar (start bei erster Stelle)
 //     - wenn im Edit: Cursor weiter schieben (bei Frequenz 6 Stellen)
 // - Encoder Drehen (nur im Edit):
-//     - FRQ: ändere freq_hz gemäß Cursor-Stelle (mit Übertrag automatisch)
+//     - FRQ: ändere freq_hz gemäß Cursor-Stelle (mit Übertrag automatisch),
+//       schnelles Drehen beschleunigt (GUI_LIMITS.accel_*)
 //     - MOD/PWR: zyklische Auswahl aus Liste
+//     - jeder geänderte Wert geht sofort an das Radio (lib/RadioTCP, ungesendete
+//       Zwischenwerte werden dort durch neuere ersetzt)
+// - Am Radio verstellte Werte (Zurücklesen, lib/RadioState) übernimmt die GUI
+//   aus dem RadioView-Snapshot des aktiven Radios; es ändern sich nur die
+//   betroffenen Widgets. Sollwerte gehen per radioRequest() (lock-frei) zum
+//   Radio-Client, der mit GUI_TASKS im Netz-Task läuft.
 // - Encoder Long-Press:
-//     - Edit beenden (Cursor weg)
-//     - "Wert gespeichert" als Toast im Header (ersetzt Header-Text) für GUI_LIMITS.toast_ms
+//     - Edit beenden (Cursor weg); die Werte sind schon beim Drehen gesendet,
+//       der Gesamtstand wird nur noch einmal bestätigt (RadioTCP filtert Doppelte)
+//     - "Gespeichert" als Toast im Header (ersetzt Header-Text) für GUI_LIMITS.toast_ms
 // - LEFT/RIGHT Buttons:
-//     - Screenwechsel FRQ <-> MOD <-> PWR
-//     - Edit wird dabei konservativ beendet (ohne Speichern)
+//     - Screenwechsel FRQ <-> MOD <-> PWR <-> RAD
+//     - Edit wird dabei beendet (ohne Toast); gedrehte Werte bleiben gesendet
+// - Radio-Screen (RAD, mehrere Radios in RADIO_LIST):
+//     - Short-Press: Auswahl beginnen; LEFT/RIGHT (oder Drehen) schalten das
+//       aktive Radio sofort um, Short-Press beendet die Auswahl
+//     - Alle Radios bleiben verbunden und synchron (lib/RadioTCP): Umschalten
+//       übernimmt nur die Werte aus dem Spiegel des Radios, Verbindungsstatus
+//       und Telemetrie-Balken gelten ab sofort für das neue Radio
+//     - Der RAD-Tab im Footer zeigt den Namen des aktiven Radios
 //
-// Rendering-Konzept (Anti-Flicker):
-// - Das Display wird in 3 Zonen unterteilt:
-//     1) Header (0..header_h-1)
-//     2) Value Area (header_h..H-footer_h-1)
-//     3) Footer (H-footer_h..H-1)
-// - Statt Full-Clear wird nur die betroffene Zone gelöscht (fillRectRGB(..., schwarz))
-//   und neu gezeichnet (Dirty Flags).
+// Rendering-Konzept (Retained Widgets, siehe Widgets.h):
+// - Alle Anzeigeelemente sind Widgets mit eigener Bounding Box und Dirty-Bit:
+//     Header: Titel/Toast (Label) + Trennlinie
+//     Value Area: je Screen eine Gruppe (FRQ: Wert + Einheit + Cursor,
+//                 MOD/PWR/RAD: Liste + Cursor)
+//     Footer: Trennlinie, Tabs FRQ/MOD/PWR/<Radio> (Labels), Status "ON" (Indikator)
+// - Geometrie wird einmal pro Rotation berechnet (layoutWidgets), nicht pro Frame.
+// - Nach jeder Eingabe überträgt syncWidgets() den UI-State in die Widgets;
+//   die Setter invalidieren nur bei echter Änderung. Gezeichnet werden nur
+//   invalidierte Widgets, Screenwechsel blendet Gruppen aus (löscht genau deren Boxen).
+// - FRQ-Wert: Ziffern kommen aus dem Glyph-Atlas, nur geänderte Zellen werden gezeichnet.
+// - Im Framebuffer-Modus (TFT_FRAMEBUFFER) passiert das Zeichnen im RAM,
+//   flushDisplayAsync() am Ende eines Frames sendet nur die geänderten Rechtecke.
+// - Mit DMA-Flush läuft die Übertragung im Hintergrund weiter, während guiUpdate()
+//   schon wieder Eingaben pollt. Solange isFlushBusy() true ist, wird nicht gerendert.
+//
+// Render-Scheduler:
+// - Gerendert wird höchstens mit GUI_LIMITS.render_fps: alle Encoder-Rastungen
+//   innerhalb eines Frames landen so in einem einzigen Redraw (freq_hz selbst
+//   ändert sich sofort).
+// - Ein Frame ist ein Durchlauf über alle Widgets (Value Area zuerst). Zwischen den
+//   Widgets werden Encoder/Buttons gepollt; ist GUI_LIMITS.render_budget_us verbraucht,
+//   kehrt guiUpdate() zurück und der Frame wird im nächsten Durchlauf fortgesetzt.
+// - Erst wenn alle Widgets gezeichnet sind, wird der Frame geflusht.
+//
+// Eingaben (InputEvents.h):
+// - Encoder und Buttons legen zeitgestempelte Events in eine gemeinsame Queue,
+//   guiUpdate() verarbeitet sie gesammelt und in Original-Reihenfolge.
+// - Die Beschleunigung rechnet mit den Event-Zeitstempeln, nicht mit dem
+//   Zeitpunkt der Verarbeitung: ein verspäteter Durchlauf ändert das Ergebnis nicht.
+// - Latenzmessung (LatencyTrace.h): Event angewendet -> Frame geöffnet -> Flush fertig.
+//
+// Input-Teil / Render-Teil:
+// - guiPollInput() besitzt den UI-State (Events => State Machine) und
+//   veröffentlicht jede Änderung als versionierten Snapshot (Snapshot.h).
+// - guiRender() übernimmt den neuesten Snapshot in die Widgets und zeichnet;
+//   nur dieser Teil fasst TFTDisplay an.
+// - guiUpdate() ruft beides nacheinander auf (ein Loop). Mit GUI_TASKS laufen
+//   die Teile in eigenen Tasks auf getrennten Kernen (siehe main.cpp).
 
 #include "GUI.h"
 
 #include <gui_config.h>
 
 #include <TFTDisplay.h>
+#include <GlyphAtlas.h>
+#include "Widgets.h"
 #include <RotaryEncoder.h>
+#include <EncoderVelocity.h>
 #include <NavButtons.h>
+#include <InputEvents.h>
+#include <LatencyTrace.h>
+#include <Snapshot.h>
+#include <EventLoop.h>
+#include <TimerWheel.h>
+#include <RadioTCP.h>
+#include <RadioTelemetry.h>
+
+#include <stdint.h>
+#include <string.h>
 
 // --------------------
 // Interner UI State
 // --------------------
+// Komplett trivial kopierbar: wird als Snapshot an den Render-Teil übergeben.
 struct UIState {
   GuiScreen screen = GUI_FRQ;
 
   bool edit = false;           // true => Cursor sichtbar + Wert ist editierbar
   uint8_t cursor = 0;          // FRQ: 0..5 für "DDD.DDD"; Listen: 0
 
-  // Solange millis() < toastUntil, wird im Header der Toast-Text angezeigt
-  // (ersetzt die Überschrift)
-  uint32_t toastUntil = 0;
+  // Toast im Header (ersetzt die Überschrift), Ende per Timer (toastTimer)
+  bool toast = false;
+
+  // Aktives Radio (Index für radioSet() usw.), Werte unten gehören zu ihm
+  uint8_t radio = 0;
+
+  // Werte / Auswahl-Indizes
+  int32_t freq_hz = 0;         // Frequenz in Hz (Anzeige "DDD.DDD MHz")
+  int32_t modIndex = 0;        // Index in GUI_MOD_LIST
+  int32_t pwrIndex = 0;        // Index in GUI_PWR_LIST
+
+  // Verbindung zum aktiven Radio (RadioLinkState), Anzeige im Footer rechts
+  uint8_t link = RADIO_LINK_DOWN;
+
+  // Latenzmessung: älteste Flanke / Zeitpunkt der Anwendung der letzten Eingaben
+  uint32_t edgeUs = 0;
+  uint32_t appliedUs = 0;
 };
 
+// Input-Teil: besitzt und ändert den State, veröffentlicht jede Änderung
 static UIState ui;
+static Snapshot<UIState> uiSnapshot;
+static bool uiChanged = false;   // Änderung ohne Eingabe (Timer, Radio), noch nicht veröffentlicht
+static UIState batchStart;       // Stand vor dem laufenden Batch (nur Geändertes geht an das Radio)
+static Timer toastTimer;
+
+// Input-Teil: zuletzt übernommener Stand des aktiven Radios (RadioView, lib/RadioTCP)
+static uint32_t radioSeenVersion = 0;
+static uint32_t radioSeenExternal[RADIO_PARAM_COUNT];
+
+// Render-Teil: zuletzt übernommener Stand
+static UIState view;
+static uint32_t viewVersion = 0;
+static uint32_t measuredAppliedUs = 0;   // letzte gemessene Eingabe (Latenz)
+
+// Render-Teil: Telemetrie des angezeigten Radios (Snapshot je Radio in lib/RadioTelemetry, 10..20 Hz)
+static RadioTelemetry meter;
+static uint32_t meterVersion = 0;
+static uint8_t meterRadio = 0;
+
+// Radio-Screen: Namen aus radioName() (in guiInit() gesammelt)
+static const char* radioNames[RADIO_MAX];
+static uint8_t radioNameCount = 0;
+
 static bool initialized = false;
 
-// Werte / Auswahl-Indizes
-static int32_t freq_hz = 0;    // Frequenz in Hz (Anzeige "DDD.DDD MHz")
-static int modIndex = 0;       // Index in GUI_MOD_LIST
-static int pwrIndex = 0;       // Index in GUI_PWR_LIST
+// Glyph-Atlas für die Frequenzanzeige (in guiInit() gebaut, -1 => Fallback drawText)
+static int8_t fontValue = -1;   // "0123456789." in value_size
+static int8_t fontUnit  = -1;   // "MHz" in unit_size
+
+// Footer-Statusanzeige rechts: Text je RadioLinkState, verbunden in Gruen
+static const GuiColor FOOTER_ON_COLOR = {0, 255, 0};
+static const char* const LINK_TEXT[3] = { "OFF", "...", "ON" };
+
+static const char* const FRQ_UNIT = "MHz";
+static const uint8_t FRQ_CHARS = 7;   // "DDD.DDD"
+
+static const char* const TOAST_TEXT = "Gespeichert";
+static const uint8_t TOAST_SIZE = 2;
+
+static const uint8_t GUI_SCREENS = 4;
+static const char* const FOOTER_TABS[GUI_SCREENS] = { "FRQ", "MOD", "PWR", "RAD" };
+
+// Meter-Zeile über dem Footer: Beschriftung + Balken je Spalte
+static const char* const METER_LABELS[3] = { "S", "SWR", "FWD" };
+static const uint8_t METER_LABEL_CHARS = 3;
+
+// S-Meter-Bereich: S0 (-127 dBm) .. S9+40 dB (-33 dBm), 6 dB je S-Stufe
+static const int16_t METER_S_MIN_DBM = -127;
+static const int16_t METER_S_MAX_DBM = -33;
+
+// Widget-Baum (Anlagereihenfolge = Zeichenreihenfolge)
+struct GuiWidgets {
+  WidgetId screen[GUI_SCREENS];          // Gruppen je Screen (Index = GuiScreen)
+  WidgetId frqValue, frqUnit, frqCursor;
+  WidgetId modList, modCursor;
+  WidgetId pwrList, pwrCursor;
+  WidgetId radList, radCursor;
+
+  WidgetId title;                        // Header: Überschrift bzw. Toast
+  WidgetId headerRule;
+
+  WidgetId footerRule;
+  WidgetId tabs[GUI_SCREENS];            // FRQ/MOD/PWR/<Name des aktiven Radios>
+  WidgetId status;                       // Verbindung: "OFF" / "..." / "ON"
 
-// Dirty Flags für Teil-Redraws
-static bool dirtyHeader = true;
-static bool dirtyValue  = true;
-static bool dirtyFooter = true;
+  WidgetId meterLabel[3];                // S / SWR / FWD
+  WidgetId meterBar[3];
+};
+
+static GuiWidgets wid;
+
+// true => nächster Frame beginnt mit clearDisplay() (Start/Force-Redraw)
+static bool fullClearPending = true;
+
+// Render-Scheduler
+static bool frameOpen = false;
+static uint32_t lastFrameUs = 0;   // micros() beim Öffnen des letzten Frames
 
 // --------------------
 // Utility Helpers
@@ -74,46 +216,63 @@ static int modPos(int a, int m) {
 }
 
 /**
- * @brief Clamp (Begrenzen) eines int32-Werts auf [lo..hi].
+ * @brief Clamp (Begrenzen) eines int64-Werts auf [lo..hi].
  *        Empfohlen für Frequenzen, um niemals ungültige Werte zu erzeugen.
  */
-static int32_t clampI32(int32_t v, int32_t lo, int32_t hi) {
+static int64_t clampI64(int64_t v, int64_t lo, int64_t hi) {
   if (v < lo) return lo;
   if (v > hi) return hi;
   return v;
 }
 
 /**
- * @brief Wrap eines int32-Werts in den Bereich [lo..hi] (zyklisch).
+ * @brief Wrap eines int64-Werts in den Bereich [lo..hi] (zyklisch).
  *        Optional, falls frq_wrap = true in gui_config.h.
  */
-static int32_t wrapI32(int32_t v, int32_t lo, int32_t hi) {
+static int64_t wrapI64(int64_t v, int64_t lo, int64_t hi) {
   if (lo > hi) return v;
-  int32_t range = hi - lo + 1;
-  int32_t x = v - lo;
+  int64_t range = hi - lo + 1;
+  int64_t x = v - lo;
   x %= range;
   if (x < 0) x += range;
   return lo + x;
 }
 
 /**
- * @brief Frequenz auf das kleinste Raster (1 kHz) zwingen und dann clamp/wrap anwenden.
+ * @brief Setzt freq_hz: erst auf das kleinste Raster (1 kHz) zwingen, dann clamp/wrap.
  *        Dadurch ist die Anzeige stabil (keine "krummen" Schritte) und immer gültig.
+ *
+ * Rechnet in 64 Bit: auch ein Kandidat weit außerhalb von int32 (gebündelte
+ * 100-MHz-Schritte) landet korrekt am Anschlag bzw. im Wrap-Bereich.
  */
-static void limitFreq() {
+static void setFreq(int64_t f) {
   // Auf das kleinste Raster (z.B. 1000 Hz = 1 kHz) zwingen
-  int32_t step = GUI_LIMITS.frq_step_min_hz;
-  if (step > 0) {
-    int32_t rem = freq_hz % step;
-    if (rem != 0) freq_hz -= rem;
-  }
+  const int64_t step = GUI_LIMITS.frq_step_min_hz;
+  if (step > 0) f -= f % step;
 
   // Grenzen anwenden
   if (GUI_LIMITS.frq_wrap) {
-    freq_hz = wrapI32(freq_hz, GUI_LIMITS.frq_min_hz, GUI_LIMITS.frq_max_hz);
+    f = wrapI64(f, GUI_LIMITS.frq_min_hz, GUI_LIMITS.frq_max_hz);
   } else {
-    freq_hz = clampI32(freq_hz, GUI_LIMITS.frq_min_hz, GUI_LIMITS.frq_max_hz);
+    f = clampI64(f, GUI_LIMITS.frq_min_hz, GUI_LIMITS.frq_max_hz);
   }
+  ui.freq_hz = (int32_t)f;
+}
+
+/**
+ * @brief Beschleunigungsfaktor für die FRQ-Schrittweite bei v Schritten/s.
+ *
+ * Bis accel_min_sps Faktor 1 (Feineinstellung bleibt exakt), ab accel_max_sps
+ * accel_max_factor, dazwischen quadratisch ansteigend.
+ */
+static uint32_t accelFactor(uint32_t v) {
+  const GuiConstraints &c = GUI_LIMITS;
+  if (c.accel_max_factor <= 1 || v <= c.accel_min_sps) return 1;
+  if (v >= c.accel_max_sps || c.accel_max_sps <= c.accel_min_sps) return c.accel_max_factor;
+
+  // t = 0..256 (Q8), Faktor = 1 + (max - 1) * t²
+  const uint64_t t = ((uint64_t)(v - c.accel_min_sps) << 8) / (c.accel_max_sps - c.accel_min_sps);
+  return 1 + (uint32_t)(((uint64_t)(c.accel_max_factor - 1) * t * t) >> 16);
 }
 
 /**
@@ -124,38 +283,11 @@ static const char* screenName(GuiScreen s) {
     case GUI_FRQ: return "Frequenz";
     case GUI_MOD: return "Modulation";
     case GUI_PWR: return "Power";
+    case GUI_RAD: return "Radio";
     default: return "";
   }
 }
 
-// Default Font: 6x8 Pixel bei size=1
-static int textW(const char* s, uint8_t size) { return (int)strlen(s) * 6 * size; }
-static int textH(uint8_t size) { return 8 * size; }
-
-/**
- * @brief Löscht einen Displaybereich, indem er schwarz gefüllt wird.
- *        (Damit vermeiden wir clearDisplay() und flackern weniger.)
- */
-static void clearArea(int16_t x, int16_t y, int16_t w, int16_t h) {
-  fillRectRGB(x, y, w, h, 0, 0, 0);
-}
-
-/**
- * @brief Zeichnet eine Linie in der Theme-Line-Farbe.
- */
-static void lineTheme(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
-  drawLineRGB(x0, y0, x1, y1,
-              GUI_THEME.line_color.r, GUI_THEME.line_color.g, GUI_THEME.line_color.b);
-}
-
-/**
- * @brief Zeichnet eine Linie in der Cursor-Farbe.
- */
-static void lineCursor(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
-  drawLineRGB(x0, y0, x1, y1,
-              GUI_THEME.cursor_color.r, GUI_THEME.cursor_color.g, GUI_THEME.cursor_color.b);
-}
-
 /**
  * @brief Bestimmt die Schrittweite (Hz) für die aktuelle Cursor-Position bei "DDD.DDD MHz".
  *
@@ -184,7 +316,7 @@ static int32_t cursorStepHz(uint8_t cursor) {
  *   -> mhz_int=104, frac=200
  *   -> "104.200"
  */
-static void formatFreq(char out[8]) {
+static void formatFreq(int32_t freq_hz, char out[8]) {
   int32_t kHz = freq_hz / 1000;
   int32_t mhz_int = kHz / 1000; // 30..511
   int32_t frac = kHz % 1000;    // 0..999
@@ -200,173 +332,282 @@ static void formatFreq(char out[8]) {
 }
 
 // --------------------
-// Rendering: Teilbereiche
+// Widgets: Aufbau, Layout, State-Sync
 // --------------------
 
 /**
- * @brief Rendert den Headerbereich.
+ * @brief Registriert alle Theme-Farben in der Display-Palette.
  *
- * Verhalten:
- * - Wenn Toast aktiv: Header zeigt "Gespeichert" (zentriert) an
- * - Sonst: Header zeigt Überschrift (aktueller Screen) links an
- * - Trennlinie am unteren Rand des Headers
+ * Nur beim indizierten 4bpp-Framebuffer wirksam: jede Farbe bekommt einen
+ * festen Slot (Hintergrund schwarz = Slot 0), bevor irgendetwas gezeichnet wird.
  */
-static void renderHeaderArea(int16_t W) {
-  clearArea(0, 0, W, GUI_LIMITS.header_h);
-
-  const bool toastActive = (millis() < ui.toastUntil);
-
-  if (toastActive) {
-    const char* msg = "Gespeichert";
-    uint8_t size = 2;
-    int w = textW(msg, size);
-    int x = (W - w) / 2;
-    if (x < 6) x = 6;
-
-    drawText(msg, x, 6, size,
-             GUI_THEME.toast_color.r, GUI_THEME.toast_color.g, GUI_THEME.toast_color.b);
-  } else {
-    drawText(screenName(ui.screen), 6, 6, GUI_THEME.header_size,
-             GUI_THEME.header_text.r, GUI_THEME.header_text.g, GUI_THEME.header_text.b);
-  }
+static void registerThemePalette() {
+  const GuiColor* const colors[] = {
+    &GUI_THEME.header_text, &GUI_THEME.value_text, &GUI_THEME.unit_text,
+    &GUI_THEME.footer_active, &GUI_THEME.footer_idle,
+    &GUI_THEME.line_color, &GUI_THEME.cursor_color, &GUI_THEME.toast_color,
+    &GUI_THEME.meter_on, &GUI_THEME.meter_off, &FOOTER_ON_COLOR
+  };
 
-  // Trennlinie am unteren Rand des Headers
-  lineTheme(0, GUI_LIMITS.header_h - 1, W - 1, GUI_LIMITS.header_h - 1);
+  registerPaletteColor(0, 0, 0);
+  for (const GuiColor* c : colors) registerPaletteColor(c->r, c->g, c->b);
 }
 
 /**
- * @brief Rendert den Footerbereich (Menüleiste unten).
- * - Trennlinie oben
- * - FRQ/MOD/PWR Labels, aktives Label wird farblich hervorgehoben
- * - Rechts "ON" als Platzhalter (später echtes Symbol)
+ * @brief Rastert Frequenzziffern und Einheit einmalig (Theme-Farben auf schwarz).
  */
-static void renderFooterArea(int16_t W, int16_t H) {
-  int y0 = H - GUI_LIMITS.footer_h;
-  clearArea(0, y0, W, GUI_LIMITS.footer_h);
-
-  lineTheme(0, y0, W - 1, y0);
-
-  auto col = [&](GuiScreen s, uint8_t &r, uint8_t &g, uint8_t &b) {
-    if (ui.screen == s) { r = GUI_THEME.footer_active.r; g = GUI_THEME.footer_active.g; b = GUI_THEME.footer_active.b; }
-    else { r = GUI_THEME.footer_idle.r; g = GUI_THEME.footer_idle.g; b = GUI_THEME.footer_idle.b; }
-  };
-
-  int footerTextY = y0 + 6;
-
-  uint8_t r,g,b;
-  col(GUI_FRQ, r,g,b); drawText("FRQ", 10, footerTextY, GUI_THEME.footer_size, r,g,b);
-  col(GUI_MOD, r,g,b); drawText("MOD", 50, footerTextY, GUI_THEME.footer_size, r,g,b);
-  col(GUI_PWR, r,g,b); drawText("PWR", 90, footerTextY, GUI_THEME.footer_size, r,g,b);
-
-  drawText("ON", W - 28, footerTextY, GUI_THEME.footer_size, 0, 255, 0);
+static void buildFrqGlyphs() {
+  glyphAtlasClear();
+
+  fontValue = glyphAtlasBuild("0123456789.", GUI_THEME.value_size,
+                              GUI_THEME.value_text.r, GUI_THEME.value_text.g, GUI_THEME.value_text.b,
+                              0, 0, 0);
+  fontUnit = glyphAtlasBuild(FRQ_UNIT, GUI_THEME.unit_size,
+                             GUI_THEME.unit_text.r, GUI_THEME.unit_text.g, GUI_THEME.unit_text.b,
+                             0, 0, 0);
 }
 
 /**
- * @brief Rendert die Frequenzanzeige in der Value Area:
- * - "DDD.DDD" groß
- * - "MHz" kleiner als Einheit
- * - Cursor als Unterstrich unter der aktiven Stelle (nur im Edit)
+ * @brief Legt den Widget-Baum an (einmalig in guiInit()).
+ *        Value Area zuerst: dort sieht man das Drehen am Encoder.
  */
-static void renderFRQ(int16_t W, int16_t H) {
-  const uint8_t valueSize = GUI_THEME.value_size;
-  const uint8_t unitSize  = GUI_THEME.unit_size;
-  const int gapPx = 2 * valueSize;
-
-  char frqStr[8];
-  formatFreq(frqStr);
-
-  const char* unit = "MHz";
+static void buildWidgets() {
+  widgetsReset();
 
-  const int valueWidth = textW(frqStr, valueSize);
-  const int unitWidth  = textW(unit, unitSize);
-  const int totalWidth = valueWidth + gapPx + unitWidth;
+  const uint8_t listSize = GUI_THEME.value_size + 1;   // etwas größer für kurze Strings
 
-  // Zentrierung bezogen auf das Gesamt-Display (Value Area ist vorher gelöscht)
-  const int startX = (W - totalWidth) / 2;
-  const int y = (H / 2) - (textH(valueSize) / 2);
+  for (uint8_t i = 0; i < GUI_SCREENS; i++) wid.screen[i] = widgetAddGroup(-1);
 
-  drawText(frqStr, startX, y, valueSize,
-           GUI_THEME.value_text.r, GUI_THEME.value_text.g, GUI_THEME.value_text.b);
+  wid.frqValue  = widgetAddValue(wid.screen[GUI_FRQ], fontValue, FRQ_CHARS,
+                                 GUI_THEME.value_size, GUI_THEME.value_text);
+  wid.frqUnit   = widgetAddValue(wid.screen[GUI_FRQ], fontUnit, 3,
+                                 GUI_THEME.unit_size, GUI_THEME.unit_text);
+  widgetSetValue(wid.frqUnit, FRQ_UNIT);
+  wid.frqCursor = widgetAddCursor(wid.screen[GUI_FRQ], wid.frqValue, GUI_THEME.cursor_color);
 
-  // Einheit optisch an die Basislinie anpassen
-  const int unitX = startX + valueWidth + gapPx;
-  const int unitY = y + textH(valueSize) - textH(unitSize);
-  drawText(unit, unitX, unitY, unitSize,
-           GUI_THEME.unit_text.r, GUI_THEME.unit_text.g, GUI_THEME.unit_text.b);
+  wid.modList   = widgetAddList(wid.screen[GUI_MOD], GUI_MOD_LIST, GUI_MOD_COUNT,
+                                listSize, GUI_THEME.value_text);
+  wid.modCursor = widgetAddCursor(wid.screen[GUI_MOD], wid.modList, GUI_THEME.cursor_color);
 
-  // Cursor (Unterstrich) nur im Edit
-  if (ui.edit) {
-    // Cursor 0..5 mappt auf Zeichenindex in "DDD.DDD" (Punkt ist an Index 3)
-    const int charIndex = (ui.cursor <= 2) ? ui.cursor : (ui.cursor + 1);
+  wid.pwrList   = widgetAddList(wid.screen[GUI_PWR], GUI_PWR_LIST, GUI_PWR_COUNT,
+                                listSize, GUI_THEME.value_text);
+  wid.pwrCursor = widgetAddCursor(wid.screen[GUI_PWR], wid.pwrList, GUI_THEME.cursor_color);
 
-    const int charWpx = 6 * valueSize;
-    const int charHpx = 8 * valueSize;
+  wid.radList   = widgetAddList(wid.screen[GUI_RAD], radioNames, radioNameCount,
+                                listSize, GUI_THEME.value_text);
+  wid.radCursor = widgetAddCursor(wid.screen[GUI_RAD], wid.radList, GUI_THEME.cursor_color);
 
-    const int underlineX0 = startX + charIndex * charWpx;
-    const int underlineX1 = underlineX0 + charWpx - 2;
-    const int underlineY  = y + charHpx + valueSize;
+  wid.title      = widgetAddLabel(-1, screenName(GUI_FRQ), GUI_THEME.header_size,
+                                  GUI_THEME.header_text, WIDGET_ALIGN_LEFT);
+  wid.headerRule = widgetAddRule(-1, GUI_THEME.line_color);
 
-    lineCursor(underlineX0, underlineY, underlineX1, underlineY);
+  wid.footerRule = widgetAddRule(-1, GUI_THEME.line_color);
+  for (uint8_t i = 0; i < GUI_SCREENS; i++) {
+    wid.tabs[i] = widgetAddLabel(-1, FOOTER_TABS[i], GUI_THEME.footer_size,
+                                 GUI_THEME.footer_idle, WIDGET_ALIGN_LEFT);
+  }
+  wid.status = widgetAddIndicator(-1, LINK_TEXT[RADIO_LINK_DOWN], GUI_THEME.footer_size,
+                                  FOOTER_ON_COLOR, GUI_THEME.footer_idle);
+
+  for (uint8_t i = 0; i < 3; i++) {
+    wid.meterLabel[i] = widgetAddLabel(-1, METER_LABELS[i], GUI_THEME.footer_size,
+                                       GUI_THEME.footer_idle, WIDGET_ALIGN_LEFT);
+    wid.meterBar[i] = widgetAddBar(-1, GUI_LIMITS.meter_segments,
+                                   GUI_THEME.meter_on, GUI_THEME.meter_off);
   }
 }
 
 /**
- * @brief Rendert einen Listenwert (z.B. Modulation/Power) mittig.
- *        Optional wird ein Cursor als Unterstrich unter dem gesamten Text gezeichnet.
+ * @brief Setzt die Box eines Widgets auf seine natürliche Größe,
+ *        horizontal zentriert in [colX, colX + colW).
  */
-static void renderListValue(int16_t W, int16_t H, const char* value) {
-  const uint8_t size = GUI_THEME.value_size + 1; // etwas größer für kurze Strings
-
-  const int w = textW(value, size);
-  const int h = textH(size);
+static void placeCentered(WidgetId id, int16_t colX, int16_t colW, int16_t y) {
+  int16_t w, h;
+  widgetMeasure(id, w, h);
+  widgetSetBounds(id, colX + (colW - w) / 2, y, w, h);
+}
 
-  const int x = (W - w) / 2;
-  const int y = (H / 2) - (h / 2);
+/**
+ * @brief Berechnet die Geometrie aller Widgets (einmal pro Rotation).
+ *
+ * - Header: Titel/Toast über die volle Breite, Höhe der größeren Variante
+ * - FRQ: "DDD.DDD" + Abstand + "MHz" als Block zentriert, Einheit auf der Basislinie
+ * - Listen: volle Breite, vertikal zentriert
+ * - Footer: 5 gleich breite Spalten (4 Tabs + Status), Inhalt jeweils zentriert;
+ *   Radio-Tab und Status bekommen die ganze Spalte (Text wechselt, deckend neu gezeichnet)
+ * - Meter: Zeile direkt über dem Footer, 3 Spalten mit Beschriftung + Balken
+ */
+static void layoutWidgets(int16_t W, int16_t H) {
+  // Header
+  const uint8_t titleSize = (TOAST_SIZE > GUI_THEME.header_size) ? TOAST_SIZE : GUI_THEME.header_size;
+  widgetSetBounds(wid.title, 0, 6, W, 8 * titleSize);
+  widgetSetInset(wid.title, 6);
+  widgetSetBounds(wid.headerRule, 0, GUI_LIMITS.header_h - 1, W, 1);
+
+  // FRQ
+  int16_t valueW, valueH, unitW, unitH;
+  widgetMeasure(wid.frqValue, valueW, valueH);
+  widgetMeasure(wid.frqUnit, unitW, unitH);
+
+  const int16_t gapPx = 2 * GUI_THEME.value_size;
+  const int16_t startX = (W - (valueW + gapPx + unitW)) / 2;
+  const int16_t valueY = (H / 2) - (valueH / 2);
+
+  widgetSetBounds(wid.frqValue, startX, valueY, valueW, valueH);
+  widgetSetBounds(wid.frqUnit, startX + valueW + gapPx, valueY + valueH - unitH, unitW, unitH);
+
+  // Listen
+  const WidgetId lists[3] = { wid.modList, wid.pwrList, wid.radList };
+  for (WidgetId id : lists) {
+    int16_t w, h;
+    widgetMeasure(id, w, h);
+    widgetSetBounds(id, 0, (H / 2) - (h / 2), W, h);
+  }
 
-  drawText(value, x, y, size,
-           GUI_THEME.value_text.r, GUI_THEME.value_text.g, GUI_THEME.value_text.b);
+  // Footer
+  const int16_t y0 = H - GUI_LIMITS.footer_h;
+  const int16_t colW = W / (GUI_SCREENS + 1);
+  widgetSetBounds(wid.footerRule, 0, y0, W, 1);
+  for (uint8_t i = 0; i < GUI_RAD; i++) placeCentered(wid.tabs[i], i * colW, colW, y0 + 6);
+  int16_t statusW, statusH;
+  widgetMeasure(wid.status, statusW, statusH);
+  widgetSetBounds(wid.tabs[GUI_RAD], GUI_RAD * colW, y0 + 6, colW, statusH);
+  widgetSetAlign(wid.tabs[GUI_RAD], WIDGET_ALIGN_CENTER);
+  widgetSetBounds(wid.status, GUI_SCREENS * colW, y0 + 6, W - GUI_SCREENS * colW, statusH);
+
+  // Meter: Balken so breit, dass alle Segmente gleich breit sind
+  const int16_t meterH = 8 * GUI_THEME.footer_size;
+  const int16_t meterY = y0 - meterH - 4;
+  const int16_t meterColW = W / 3;
+  const int16_t labelW = METER_LABEL_CHARS * 6 * GUI_THEME.footer_size;
+  const uint8_t segs = (GUI_LIMITS.meter_segments > 0) ? GUI_LIMITS.meter_segments : 1;
+  const int16_t barW = ((meterColW - labelW - 8) / segs) * segs;
+  for (uint8_t i = 0; i < 3; i++) {
+    const int16_t x = i * meterColW + 2;
+    widgetSetBounds(wid.meterLabel[i], x, meterY, labelW, meterH);
+    widgetSetBounds(wid.meterBar[i], x + labelW + 3, meterY + 1, barW, meterH - 2);
+  }
+}
 
-  if (ui.edit) {
-    const int underlineY = y + h + size;
-    lineCursor(x, underlineY, x + w - 2, underlineY);
+/**
+ * @brief Überträgt einen UI-State (Snapshot) in die Widgets.
+ *        Setter invalidieren nur bei Änderung, daher jeden Durchlauf aufrufbar.
+ */
+static void syncWidgets(const UIState &st) {
+  // Header: Toast ersetzt die Überschrift
+  const bool toastActive = st.toast;
+  widgetSetText(wid.title, toastActive ? TOAST_TEXT : screenName(st.screen));
+  widgetSetTextSize(wid.title, toastActive ? TOAST_SIZE : GUI_THEME.header_size);
+  widgetSetColor(wid.title, toastActive ? GUI_THEME.toast_color : GUI_THEME.header_text);
+  widgetSetAlign(wid.title, toastActive ? WIDGET_ALIGN_CENTER : WIDGET_ALIGN_LEFT);
+
+  // Aktiver Screen + Tab (Radio-Tab: Name des aktiven Radios)
+  widgetSetText(wid.tabs[GUI_RAD], (st.radio < radioNameCount) ? radioNames[st.radio] : FOOTER_TABS[GUI_RAD]);
+  for (uint8_t i = 0; i < GUI_SCREENS; i++) {
+    const bool active = (st.screen == (GuiScreen)i);
+    widgetSetVisible(wid.screen[i], active);
+    widgetSetColor(wid.tabs[i], active ? GUI_THEME.footer_active : GUI_THEME.footer_idle);
   }
+
+  // FRQ: Cursor 0..5 mappt auf Zeichenindex in "DDD.DDD" (Punkt ist an Index 3)
+  char frqStr[8];
+  formatFreq(st.freq_hz, frqStr);
+  widgetSetValue(wid.frqValue, frqStr);
+  widgetSetCursor(wid.frqCursor, st.edit ? (int8_t)((st.cursor <= 2) ? st.cursor : st.cursor + 1) : -1);
+
+  // Listen: Cursor unter dem ganzen Eintrag
+  widgetSetIndex(wid.modList, st.modIndex);
+  widgetSetCursor(wid.modCursor, st.edit ? 0 : -1);
+  widgetSetIndex(wid.pwrList, st.pwrIndex);
+  widgetSetCursor(wid.pwrCursor, st.edit ? 0 : -1);
+  widgetSetIndex(wid.radList, st.radio);
+  widgetSetCursor(wid.radCursor, st.edit ? 0 : -1);
+
+  // Verbindung zum Radio
+  const uint8_t link = (st.link <= RADIO_LINK_UP) ? st.link : (uint8_t)RADIO_LINK_DOWN;
+  widgetSetText(wid.status, LINK_TEXT[link]);
+  widgetSetOn(wid.status, link == RADIO_LINK_UP);
+}
+
+/**
+ * @brief Wert => leuchtende Segmente (linear, angefangenes Segment leuchtet).
+ */
+static uint8_t meterLevel(int32_t v, int32_t lo, int32_t hi) {
+  const int32_t segs = GUI_LIMITS.meter_segments;
+  if (v <= lo || hi <= lo) return 0;
+  if (v >= hi) return (uint8_t)segs;
+  return (uint8_t)(((v - lo) * segs + (hi - lo - 1)) / (hi - lo));
 }
 
 /**
- * @brief Rendert die komplette Value Area (mittlerer Bereich).
- *        Wird bei Wertänderungen/Cursoränderungen neu gezeichnet.
+ * @brief Telemetrie in die Balken übertragen. Ohne gültigen Strom (bzw. für
+ *        nie gemeldete Werte) bleiben die Balken dunkel.
  */
-static void renderValueArea(int16_t W, int16_t H) {
-  const int y0 = GUI_LIMITS.header_h;
-  const int h  = H - GUI_LIMITS.header_h - GUI_LIMITS.footer_h;
+static void syncMeters(const RadioTelemetry &t) {
+  const bool s = t.valid && (t.fields & TLM_S);
+  const bool swr = t.valid && (t.fields & TLM_SWR);
+  const bool fwd = t.valid && (t.fields & TLM_FWD);
+
+  widgetSetLevel(wid.meterBar[0], s ? meterLevel(t.sDbm, METER_S_MIN_DBM, METER_S_MAX_DBM) : 0);
+  widgetSetLevel(wid.meterBar[1], swr ? meterLevel(t.swr100, 100, GUI_LIMITS.meter_swr_max_x100) : 0);
+  widgetSetLevel(wid.meterBar[2], fwd ? meterLevel(t.fwdDw, 0, GUI_LIMITS.meter_fwd_max_dw) : 0);
+}
 
-  // Nur den zentralen Bereich löschen, nicht das ganze Display
-  clearArea(0, y0, W, h);
+// --------------------
+// Render-Scheduler
+// --------------------
 
-  switch (ui.screen) {
-    case GUI_FRQ:
-      renderFRQ(W, H);
-      break;
-    case GUI_MOD:
-      renderListValue(W, H, (GUI_MOD_COUNT > 0) ? GUI_MOD_LIST[modIndex] : "---");
-      break;
-    case GUI_PWR:
-      renderListValue(W, H, (GUI_PWR_COUNT > 0) ? GUI_PWR_LIST[pwrIndex] : "---");
-      break;
+/**
+ * @brief Mindestabstand zwischen zwei Frames in µs (0 => kein Limit).
+ */
+static uint32_t frameIntervalUs() {
+  return (GUI_LIMITS.render_fps > 0) ? (1000000UL / GUI_LIMITS.render_fps) : 0;
+}
+
+/**
+ * @brief Öffnet einen Frame (Durchlauf über alle invalidierten Widgets).
+ */
+static void openFrame() {
+  if (fullClearPending) {
+    clearDisplay();
+    widgetsInvalidateAll();     // Display ist schwarz, alles neu zeichnen
+    fullClearPending = false;
   }
+
+  widgetsBeginPass();
+  frameOpen = true;
+  lastFrameUs = micros();
+  latencyRenderStart(lastFrameUs);
 }
 
 /**
- * @brief Rendert nur die als "dirty" markierten Zonen.
- *        Dadurch minimieren wir Flackern und unnötige Arbeit.
+ * @brief Zeichnet Widgets des offenen Frames, bis alle fertig sind oder das Budget
+ *        verbraucht ist. Zwischen den Widgets werden die Eingaben gepollt.
+ *
+ * @param budgetUs    max. Renderzeit (0 => Frame komplett zeichnen)
+ * @param pollInputs  Eingaben zwischen den Widgets pollen
+ * @return true wenn der Frame fertig ist (und geflusht wurde)
  */
-static void renderDirty() {
-  int16_t W, H;
-  getDisplaySize(W, H);
+static bool renderFrameSlice(uint32_t budgetUs, bool pollInputs) {
+  const uint32_t startUs = micros();
+
+  while (widgetsPaintNext()) {
+    // Encoder-Flanken nicht verpassen, Events bleiben bis guiUpdate() gespeichert
+    // (mit Input-Task erledigt der das auf dem anderen Kern)
+    if (pollInputs) {
+      updateRotaryEncoder();
+      updateNavButtons();
+    }
+
+    if (budgetUs > 0 && (micros() - startUs) >= budgetUs) return false;
+  }
+
+  frameOpen = false;
 
-  if (dirtyHeader) { renderHeaderArea(W); dirtyHeader = false; }
-  if (dirtyValue)  { renderValueArea(W, H); dirtyValue = false; }
-  if (dirtyFooter) { renderFooterArea(W, H); dirtyFooter = false; }
+  // Geänderte Bereiche zum Display schieben (ohne Framebuffer: no-op,
+  // mit DMA: kehrt sofort zurück, Übertragung läuft im Hintergrund)
+  flushDisplayAsync();
+  return true;
 }
 
 // --------------------
@@ -387,7 +628,84 @@ static void enterEdit() {
 static void exitEditAndSave() {
   ui.edit = false;
   ui.cursor = 0;
-  ui.toastUntil = millis() + GUI_LIMITS.toast_ms;
+  ui.toast = true;
+  timerArm(toastTimer, millis(), GUI_LIMITS.toast_ms);
+
+  // Gesamten Stand übergeben (bereits gesendete Werte filtert RadioTCP)
+  radioRequest(ui.radio, RADIO_FRQ, ui.freq_hz);
+  radioRequest(ui.radio, RADIO_MOD, ui.modIndex);
+  radioRequest(ui.radio, RADIO_PWR, ui.pwrIndex);
+}
+
+/**
+ * @brief Im laufenden Batch geänderte Werte an das aktive Radio (nur den Endstand).
+ */
+static void commitToRadio() {
+  if (ui.freq_hz != batchStart.freq_hz) radioRequest(ui.radio, RADIO_FRQ, ui.freq_hz);
+  if (ui.modIndex != batchStart.modIndex) radioRequest(ui.radio, RADIO_MOD, ui.modIndex);
+  if (ui.pwrIndex != batchStart.pwrIndex) radioRequest(ui.radio, RADIO_PWR, ui.pwrIndex);
+}
+
+/**
+ * @brief Wert eines Radios für die Anzeige: Sollwert, sonst vom Radio bestätigter
+ *        Wert (beides in RadioView::value), sonst Default (noch nie verbunden).
+ */
+static int32_t radioValueOr(const RadioView &v, RadioParam param, int32_t fallback) {
+  return (v.valid & (1u << param)) ? v.value[param] : fallback;
+}
+
+/**
+ * @brief Aktives Radio wechseln: Werte aus seinem Spiegel, sein Verbindungsstatus.
+ *        Nichts wird gesendet, nichts muss neu verbunden werden.
+ */
+static void selectRadio(uint8_t radio) {
+  RadioView v;
+  radioSeenVersion = radioReadView(radio, v);
+  memcpy(radioSeenExternal, v.externalGen, sizeof(radioSeenExternal));
+
+  ui.radio = radio;
+  setFreq(radioValueOr(v, RADIO_FRQ, GUI_DEFAULTS.frq_start_hz));
+  ui.modIndex = modPos(radioValueOr(v, RADIO_MOD, GUI_DEFAULTS.mod_index), GUI_MOD_COUNT);
+  ui.pwrIndex = modPos(radioValueOr(v, RADIO_PWR, GUI_DEFAULTS.pwr_index), GUI_PWR_COUNT);
+  ui.link = v.link;
+}
+
+/**
+ * @brief Timer: Toast abgelaufen => wieder Überschrift (Input-Kontext, timerRun()).
+ */
+static void toastExpired(void*) {
+  ui.toast = false;
+  uiChanged = true;
+}
+
+/**
+ * @brief Neuen Stand des aktiven Radios übernehmen (Input-Kontext).
+ *        Eigene Werte zeigt die GUI schon; übernommen werden nur fremde (externalGen)
+ *        und der Verbindungsstatus. Die anderen Radios liest selectRadio() beim Umschalten.
+ */
+static void pollRadioView() {
+  if (radioViewVersion(ui.radio) == radioSeenVersion) return;
+
+  RadioView v;
+  radioSeenVersion = radioReadView(ui.radio, v);
+
+  for (uint8_t p = 0; p < RADIO_PARAM_COUNT; p++) {
+    if (v.externalGen[p] == radioSeenExternal[p]) continue;
+    radioSeenExternal[p] = v.externalGen[p];
+
+    switch (p) {
+      case RADIO_FRQ: setFreq(v.value[p]); break;
+      case RADIO_MOD: ui.modIndex = modPos(v.value[p], GUI_MOD_COUNT); break;
+      case RADIO_PWR: ui.pwrIndex = modPos(v.value[p], GUI_PWR_COUNT); break;
+      default: continue;
+    }
+    uiChanged = true;
+  }
+
+  if (v.link != ui.link) {
+    ui.link = v.link;
+    uiChanged = true;
+  }
 }
 
 /**
@@ -402,32 +720,39 @@ static void nextCursorPosition() {
 
 /**
  * @brief Wertänderung in Abhängigkeit vom Screen:
- * - FRQ: freq_hz += delta * cursorStepHz(cursor)
+ * - FRQ: freq_hz += delta * cursorStepHz(cursor) (64 Bit, gesättigt)
  * - MOD/PWR: zyklisches Durchschalten der Listen
+ * - RAD: aktives Radio zyklisch umschalten
  */
-static void changeValueByDelta(int32_t d) {
+static void changeValueByDelta(int64_t d) {
   if (d == 0) return;
 
   if (ui.screen == GUI_FRQ) {
-    freq_hz += (int32_t)d * cursorStepHz(ui.cursor);
-    limitFreq();
+    // Sättigen, damit d * 100 MHz sicher in int64 passt (weit jenseits jedes Anschlags)
+    d = clampI64(d, -INT32_MAX, INT32_MAX);
+    setFreq((int64_t)ui.freq_hz + d * cursorStepHz(ui.cursor));
   } else if (ui.screen == GUI_MOD) {
-    if (GUI_MOD_COUNT > 0) modIndex = modPos(modIndex + (int)d, GUI_MOD_COUNT);
+    if (GUI_MOD_COUNT > 0) ui.modIndex = modPos(ui.modIndex + (int)(d % GUI_MOD_COUNT), GUI_MOD_COUNT);
   } else if (ui.screen == GUI_PWR) {
-    if (GUI_PWR_COUNT > 0) pwrIndex = modPos(pwrIndex + (int)d, GUI_PWR_COUNT);
+    if (GUI_PWR_COUNT > 0) ui.pwrIndex = modPos(ui.pwrIndex + (int)(d % GUI_PWR_COUNT), GUI_PWR_COUNT);
+  } else if (ui.screen == GUI_RAD) {
+    if (radioNameCount == 0) return;
+    commitToRadio();   // Änderungen dieses Batches gehören noch dem bisherigen Radio
+    selectRadio((uint8_t)modPos(ui.radio + (int)(d % radioNameCount), radioNameCount));
+    batchStart = ui;   // Werte des neuen Radios sind dessen Stand, nichts zu senden
   }
 }
 
 /**
  * @brief Screenwechsel per LEFT/RIGHT.
- *        Konservatives UX: Edit wird beendet (ohne Speichern).
+ *        Edit wird beendet; gedrehte Werte sind bereits gesendet (kein Toast).
  */
 static void switchScreenByDelta(int delta) {
   ui.edit = false;
   ui.cursor = 0;
 
   int s = (int)ui.screen + delta;
-  s = modPos(s, 3);
+  s = modPos(s, GUI_SCREENS);
   ui.screen = (GuiScreen)s;
 }
 
@@ -443,86 +768,219 @@ void guiInit() {
   ui = UIState{};
   ui.screen = GUI_FRQ;
 
-  freq_hz  = GUI_DEFAULTS.frq_start_hz;
-  modIndex = modPos(GUI_DEFAULTS.mod_index, GUI_MOD_COUNT);
-  pwrIndex = modPos(GUI_DEFAULTS.pwr_index, GUI_PWR_COUNT);
-
-  // Frequenz in Grenzen + Raster bringen
-  limitFreq();
+  // Radios aus radioInit(); ohne (Host-Simulation) ein Platzhalter
+  radioNameCount = 0;
+  for (uint8_t r = 0; r < radioCount() && r < RADIO_MAX; r++) {
+    radioNames[radioNameCount++] = radioName(r);
+  }
+  if (radioNameCount == 0) radioNames[radioNameCount++] = "-";
+
+  // Erstes Radio aktiv; Frequenz in Grenzen + Raster bringen (Defaults, solange unbekannt)
+  selectRadio(0);
+  timerInit(toastTimer, toastExpired, nullptr);
+  uiChanged = false;
+  snapshotInit(uiSnapshot, ui);
+  view = ui;
+  viewVersion = snapshotVersion(uiSnapshot);
+  measuredAppliedUs = 0;
+  meterRadio = view.radio;
+  meterVersion = telemetryRead(meterRadio, meter);
 
   initialized = true;
 
-  // Einmal Full-Clear für sauberen Start, danach nur noch Teil-Redraws
-  clearDisplay();
+  // Frequenz-Glyphen einmalig rastern, Widgets anlegen und einmal layouten
+  int16_t W, H;
+  getDisplaySize(W, H);
+  registerThemePalette();
+  buildFrqGlyphs();
+  buildWidgets();
+  layoutWidgets(W, H);
+  syncWidgets(view);
+  syncMeters(meter);
+
+  // Einmal Full-Clear für sauberen Start, danach nur noch invalidierte Widgets
+  fullClearPending = true;
+  openFrame();
+  renderFrameSlice(0, false);
+}
+
+// Geschwindigkeit für die Beschleunigung, gespeist aus den Event-Zeitstempeln
+static EncoderVelocity inputVelocity = {};
+
+/**
+ * @brief Ein nicht-Dreh-Event auf die State Machine anwenden.
+ */
+static void handleInputEvent(const InputEvent &e) {
+  const bool longPress = (e.type == INPUT_LONG_PRESS);
+
+  switch (e.source) {
+    // --- LEFT/RIGHT: Screenwechsel, in der Radio-Auswahl: Radio wechseln ---
+    case INPUT_SRC_LEFT:
+      if (longPress) break;
+      if (ui.edit && ui.screen == GUI_RAD) changeValueByDelta(-1);
+      else switchScreenByDelta(-1);
+      break;
+    case INPUT_SRC_RIGHT:
+      if (longPress) break;
+      if (ui.edit && ui.screen == GUI_RAD) changeValueByDelta(+1);
+      else switchScreenByDelta(+1);
+      break;
+
+    case INPUT_SRC_ENC_BUTTON:
+      if (longPress) {
+        // --- Encoder Long-Press: speichern + exit edit + toast ---
+        exitEditAndSave();
+      } else if (!ui.edit) {
+        // --- Encoder Short-Press: edit togglen / cursor weiterschieben ---
+        enterEdit();
+      } else if (ui.screen == GUI_RAD) {
+        // Radio-Auswahl: Umschalten ist schon passiert, nichts zu speichern
+        ui.edit = false;
+      } else {
+        nextCursorPosition();
+      }
+      break;
 
-  dirtyHeader = dirtyValue = dirtyFooter = true;
-  renderDirty();
+    default:
+      break;
+  }
 }
 
 /**
- * @brief Hauptupdate der GUI:
- * - Liest Eingaben (Encoder + Buttons)
- * - Aktualisiert State Machine
- * - Markiert betroffene Bereiche "dirty"
- * - Rendert am Ende nur die dirty Zonen
+ * @brief Input-Teil: Eingaben lesen, State Machine, Snapshot veröffentlichen.
  */
-void guiUpdate() {
+void guiPollInput() {
   if (!initialized) return;
 
   updateRotaryEncoder();
   updateNavButtons();
-
-  // --- LEFT/RIGHT: Screenwechsel ---
-  if (getLeftPressed()) {
-    switchScreenByDelta(-1);
-    dirtyHeader = dirtyValue = dirtyFooter = true;
-  }
-  if (getRightPressed()) {
-    switchScreenByDelta(+1);
-    dirtyHeader = dirtyValue = dirtyFooter = true;
+  pollRadioView();
+
+  // --- Events in Reihenfolge abarbeiten ---
+  // Aufeinanderfolgende Drehschritte werden in einer Operation angewendet
+  // (nur im Edit Mode), bevor ein Tasten-Event den State ändert.
+  // FRQ: jeder Schritt zählt mit dem Faktor seiner Drehgeschwindigkeit.
+  InputEvent batch[INPUT_QUEUE_SIZE];
+  const uint8_t n = inputDrain(batch, INPUT_QUEUE_SIZE);
+  if (n == 0) {
+    // Nur Timer-/Radio-Änderungen (Toast-Ende, Zurücklesen): veröffentlichen, ohne Latenzmessung
+    if (uiChanged) snapshotPublish(uiSnapshot, ui);
+    uiChanged = false;
+    return;
   }
 
-  // --- Encoder Long-Press: speichern + exit edit + toast ---
-  if (getButtonLongPressed()) {
-    exitEditAndSave();
+  batchStart = ui;
+
+  int64_t d = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    const InputEvent &e = batch[i];
 
-    // Header zeigt Toast statt Titel
-    dirtyHeader = true;
+    if (e.type == INPUT_ROTATE) {
+      const uint32_t v = encoderVelocityFeed(inputVelocity, e.us, (int8_t)e.value);
+      const uint32_t factor = (ui.screen == GUI_FRQ) ? accelFactor(v) : 1;
+      d += (int64_t)e.value * factor;
+      continue;
+    }
 
-    // Cursor verschwindet (Value Area muss neu)
-    dirtyValue = true;
+    if (d != 0 && ui.edit) changeValueByDelta(d);
+    d = 0;
+    handleInputEvent(e);
   }
+  if (d != 0 && ui.edit) changeValueByDelta(d);
 
-  // --- Encoder Short-Press: edit togglen / cursor weiterschieben ---
-  if (getButtonPressed()) {
-    if (!ui.edit) enterEdit();
-    else nextCursorPosition();
+  // --- Geänderte Werte => Radio (nur den Endstand des Batches) ---
+  commitToRadio();
 
-    // Cursor/Mode liegt in Value Area
-    dirtyValue = true;
-  }
+  // --- State => Render-Teil (Latenz ab der ältesten Flanke des Batches) ---
+  ui.edgeUs = batch[0].us;
+  ui.appliedUs = micros();
+  snapshotPublish(uiSnapshot, ui);
+  uiChanged = false;
+}
 
-  // --- Encoder drehen: nur im Edit Mode ---
-  int32_t d = getEncoderDelta();
-  if (d != 0 && ui.edit) {
-    changeValueByDelta(d);
+/**
+ * @brief Render-Teil: neuesten Snapshot übernehmen und zeichnen.
+ *
+ * @param pollInputs  Eingaben zwischen den Widgets pollen (nur ohne eigenen Input-Task)
+ */
+static void renderUpdate(bool pollInputs) {
+  // --- Snapshot => Widgets (invalidiert nur, was sich geändert hat) ---
+  const bool changed = (snapshotVersion(uiSnapshot) != viewVersion);
+  if (changed) {
+    viewVersion = snapshotRead(uiSnapshot, view);
+    syncWidgets(view);
+  }
 
-    // Wert hat sich geändert => Value Area neu
-    dirtyValue = true;
+  // --- Telemetrie => Balken (nur Segmente mit neuem Zustand werden gezeichnet) ---
+  // Radiowechsel: sofort der Stand des neuen Radios (empfängt im Hintergrund mit)
+  if (view.radio != meterRadio || telemetryVersion(meterRadio) != meterVersion) {
+    meterRadio = view.radio;
+    meterVersion = telemetryRead(meterRadio, meter);
+    syncMeters(meter);
   }
 
-  // --- Toast abgelaufen? => Header wieder normal zeichnen ---
-  static bool toastWasActive = false;
-  const bool toastActive = (millis() < ui.toastUntil);
-  if (toastWasActive && !toastActive) {
-    dirtyHeader = true;
+  // Eingabe ohne sichtbare Änderung (z.B. Drehen außerhalb Edit) ergibt keine Messung,
+  // Änderungen ohne neue Eingabe (Toast-Ende) auch nicht
+  if (changed && view.appliedUs != measuredAppliedUs) {
+    measuredAppliedUs = view.appliedUs;
+    latencyInput(view.edgeUs, view.appliedUs);
   }
-  toastWasActive = toastActive;
+  if (!frameOpen && !fullClearPending && !widgetsAnyDirty()) latencyDiscardPending();
+
+  // --- Render-Scheduler ---
+  // isFlushBusy() jeden Durchlauf pollen: startet die nächsten DMA-Bänder.
+  // Neuer Frame nur, wenn kein Frame offen ist, kein Flush mehr läuft
+  // und das Frame-Intervall abgelaufen ist. Sonst bleiben die Widgets invalidiert.
+  const bool flushing = isFlushBusy();
+  if (!frameOpen && !flushing &&
+      (fullClearPending || widgetsAnyDirty()) &&
+      (micros() - lastFrameUs) >= frameIntervalUs()) {
+    openFrame();
+  }
+
+  if (frameOpen) renderFrameSlice(GUI_LIMITS.render_budget_us, pollInputs);
+}
+
+void guiRender() {
+  if (!initialized) return;
+  renderUpdate(false);
+}
+
+/**
+ * @brief Hauptupdate der GUI (ein Loop, ohne Tasks):
+ * - Leert die Input-Queue (Encoder + Buttons) in Reihenfolge
+ * - Aktualisiert State Machine
+ * - Überträgt den State in die Widgets (invalidiert nur Geändertes)
+ * - Rendert am Ende nur invalidierte Widgets (Render-Scheduler)
+ */
+void guiUpdate() {
+  if (!initialized) return;
+
+  guiPollInput();
+  renderUpdate(true);
+}
 
-  // --- Render wenn nötig ---
-  if (dirtyHeader || dirtyValue || dirtyFooter) {
-    renderDirty();
+/**
+ * @brief Zeit in µs, bis guiUpdate() wieder etwas zu tun hat (EventLoop-Deadline).
+ *
+ * 0 bei anstehenden Events, offenem Frame, laufendem DMA-Flush (wird gepollt) oder
+ * neuer Telemetrie; sonst der nächste Frame-Slot, wenn etwas invalidiert ist. Neue Eingaben wecken
+ * die Hauptschleife selbst (ISR => eventLoopSignal()), Toast-Ende ist ein Timer.
+ */
+uint32_t guiIdleUs() {
+  if (!initialized) return EVENT_NO_DEADLINE;
+  if (inputPending() || uiChanged || frameOpen || isFlushBusy()) return 0;
+  if (view.radio != meterRadio || telemetryVersion(meterRadio) != meterVersion) return 0;
+  if (radioViewVersion(ui.radio) != radioSeenVersion) return 0;
+
+  uint32_t idle = EVENT_NO_DEADLINE;
+
+  if (fullClearPending || widgetsAnyDirty()) {
+    const uint32_t since = micros() - lastFrameUs;
+    const uint32_t interval = frameIntervalUs();
+    idle = (since >= interval) ? 0 : interval - since;
   }
+  return idle;
 }
 
 /**
@@ -530,8 +988,17 @@ void guiUpdate() {
  */
 void guiForceRedraw() {
   if (!initialized) return;
-  dirtyHeader = dirtyValue = dirtyFooter = true;
-  renderDirty();
+
+  // Displaygröße kann sich (Rotation) geändert haben
+  int16_t W, H;
+  getDisplaySize(W, H);
+  layoutWidgets(W, H);
+  fullClearPending = true;
+
+  if (!frameOpen && !isFlushBusy()) {
+    openFrame();
+    renderFrameSlice(0, false);
+  }
 }
 
 /**
@@ -543,3 +1010,27 @@ GuiScreen guiGetScreen() { return ui.screen; }
  * @brief true wenn im Edit-Mode (Cursor sichtbar, Drehen ändert Werte).
  */
 bool guiIsEditing() { return ui.edit; }
+
+/**
+ * @brief Aktives Radio (Stand des Input-Teils).
+ */
+uint8_t guiGetRadio() { return ui.radio; }
+
+/**
+ * @brief Neuester veröffentlichter Stand (liest nur den Snapshot, kein Eingriff in den Input-Teil).
+ */
+uint32_t guiReadState(GuiState &out) {
+  UIState st;
+  const uint32_t version = snapshotRead(uiSnapshot, st);
+  out.screen = st.screen;
+  out.edit = st.edit;
+  out.cursor = st.cursor;
+  out.radio = st.radio;
+  out.freq_hz = st.freq_hz;
+  out.modIndex = st.modIndex;
+  out.pwrIndex = st.pwrIndex;
+  out.link = st.link;
+  return version;
+}
+
+uint32_t guiStateVersion() { return snapshotVersion(uiSnapshot); }
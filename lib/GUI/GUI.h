@@ -6,7 +6,8 @@
 enum GuiScreen : uint8_t {
   GUI_FRQ = 0,
   GUI_MOD = 1,
-  GUI_PWR = 2
+  GUI_PWR = 2,
+  GUI_RAD = 3    // Auswahl des aktiven Radios (RADIO_LIST)
 };
 
 // Initialisiert die GUI (zieht Theme/Limits/Listen/Defaults aus include/gui_config.h)
@@ -15,9 +16,37 @@ void guiInit();
 // Muss zyklisch in loop() aufgerufen werden (Input lesen + State + partiell rendern)
 void guiUpdate();
 
+// Alternativ getrennt in Tasks (GUI_TASKS, config.h):
+// Input lesen + State (veröffentlicht Snapshot) ...
+void guiPollInput();
+// ... und Snapshot übernehmen + partiell rendern (einziger Nutzer von TFTDisplay)
+void guiRender();
+
+// Zeit in µs bis zum nächsten nötigen guiUpdate() (EVENT_NO_DEADLINE = erst bei Eingabe/Timer)
+uint32_t guiIdleUs();
+
 // Optional: erzwingt Full-Redraw (setzt alle Bereiche "dirty")
 void guiForceRedraw();
 
-// Status (optional)
+// Status (optional, Stand des Input-Teils)
 GuiScreen guiGetScreen();
 bool guiIsEditing();
+uint8_t guiGetRadio();   // aktives Radio (Index in der Liste aus radioInit())
+
+// Veröffentlichter Bedienstand (z.B. Web-Spiegel, lib/WebMirror)
+struct GuiState {
+  GuiScreen screen;
+  bool edit;
+  uint8_t cursor;      // FRQ: 0..5, Listen: 0
+  uint8_t radio;       // aktives Radio
+  int32_t freq_hz;
+  int32_t modIndex;    // Index in GUI_MOD_LIST
+  int32_t pwrIndex;    // Index in GUI_PWR_LIST
+  uint8_t link;        // RadioLinkState des aktiven Radios
+};
+
+// Neuester veröffentlichter Stand (Snapshot, aus jedem Kontext), liefert dessen Version
+uint32_t guiReadState(GuiState &out);
+
+// Version des neuesten Stands (ändert sich mit jeder Veröffentlichung)
+uint32_t guiStateVersion();
@@ -0,0 +1,602 @@
+// lib/GUI/Widgets.cpp
+//
+// Retained-Widget-Schicht (siehe Widgets.h).
+//
+// Aufbau:
+// - Alle Widgets liegen in einem festen Array (keine Heap-Allokation),
+//   die Baumstruktur ergibt sich aus dem parent-Index.
+// - shown == true: das Widget steht so auf dem Display (bzw. im Framebuffer).
+//   Nur dann muss es beim Verstecken geloescht werden.
+// - Hintergrund ist immer schwarz (wie der Rest der GUI).
+
+#include "Widgets.h"
+
+#include <TFTDisplay.h>
+#include <GlyphAtlas.h>
+
+#include <string.h>
+
+enum WidgetType : uint8_t {
+  WIDGET_GROUP = 0,
+  WIDGET_LABEL,
+  WIDGET_VALUE,
+  WIDGET_LIST,
+  WIDGET_INDICATOR,
+  WIDGET_CURSOR,
+  WIDGET_RULE,
+  WIDGET_BAR
+};
+
+struct Widget {
+  WidgetType type;
+  WidgetId parent;
+
+  bool visible;             // eigener Zustand (Gruppe kann ueberstimmen)
+  bool shown;               // aktuell gezeichnet
+  bool dirty;               // muss gezeichnet bzw. geloescht werden
+
+  int16_t x, y, w, h;       // Bounding Box
+  int16_t inset;            // Textabstand zum Boxrand
+
+  uint8_t size;
+  WidgetAlign align;
+  GuiColor color;
+
+  // LABEL / INDICATOR / BAR
+  const char* text;
+  GuiColor colorOff;
+  bool on;
+
+  // BAR
+  uint8_t segments;
+  uint8_t level, shownLevel;
+
+  // LIST
+  const char* const* items;
+  int count;
+  int index;
+
+  // VALUE
+  int8_t font;
+  uint8_t len;
+  int16_t cellW, cellH;
+  char str[WIDGET_VALUE_MAX + 1];
+  char shownStr[WIDGET_VALUE_MAX + 1];
+
+  // CURSOR
+  WidgetId target;
+  int8_t cell;
+  int16_t shownX0, shownX1, shownY;   // zuletzt gezeichnetes Segment
+};
+
+static Widget widgets[WIDGET_MAX];
+static uint8_t widgetCount = 0;
+
+// Durchlauf: 0..count-1 = Loeschphase, count..2*count-1 = Zeichenphase
+static uint16_t passPos = 0;
+
+// --------------------
+// Helpers
+// --------------------
+
+// Default Font: 6x8 Pixel bei size=1
+static int16_t textW(const char* s, uint8_t size) { return (int16_t)(strlen(s) * 6 * size); }
+static int16_t textH(uint8_t size) { return (int16_t)(8 * size); }
+
+static bool validId(WidgetId id) { return id >= 0 && id < widgetCount; }
+
+static void fillBlack(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (w > 0 && h > 0) fillRectRGB(x, y, w, h, 0, 0, 0);
+}
+
+/**
+ * @brief Sichtbar = selbst sichtbar und alle Vorfahren sichtbar.
+ */
+static bool effectiveVisible(WidgetId id) {
+  while (validId(id)) {
+    if (!widgets[id].visible) return false;
+    id = widgets[id].parent;
+  }
+  return true;
+}
+
+static bool isDescendant(WidgetId id, WidgetId ancestor) {
+  for (WidgetId p = widgets[id].parent; validId(p); p = widgets[p].parent) {
+    if (p == ancestor) return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Widget invalidieren. Cursor haengen an ihrem Ziel (Position/Breite).
+ */
+static void markDirty(WidgetId id) {
+  widgets[id].dirty = true;
+  for (uint8_t i = 0; i < widgetCount; i++) {
+    if (widgets[i].type == WIDGET_CURSOR && widgets[i].target == id) widgets[i].dirty = true;
+  }
+}
+
+static WidgetId addWidget(WidgetType type, WidgetId parent) {
+  if (widgetCount >= WIDGET_MAX) return -1;
+
+  const WidgetId id = (WidgetId)widgetCount++;
+  Widget &w = widgets[id];
+  w = Widget{};
+  w.type = type;
+  w.parent = validId(parent) ? parent : -1;
+  w.visible = true;
+  w.dirty = true;
+  w.font = -1;
+  w.target = -1;
+  w.cell = -1;
+  return id;
+}
+
+/**
+ * @brief Aktueller Text eines Text-Widgets (LABEL/INDICATOR/LIST).
+ */
+static const char* currentText(const Widget &w) {
+  if (w.type == WIDGET_LIST) {
+    if (!w.items || w.count <= 0 || w.index < 0 || w.index >= w.count) return "---";
+    return w.items[w.index];
+  }
+  return w.text ? w.text : "";
+}
+
+/**
+ * @brief Text-X-Position gemaess Ausrichtung (nie links vom Inset).
+ */
+static int16_t alignX(const Widget &w, int16_t tw) {
+  switch (w.align) {
+    case WIDGET_ALIGN_CENTER: {
+      const int16_t x = w.x + (w.w - tw) / 2;
+      return (x < w.x + w.inset) ? (int16_t)(w.x + w.inset) : x;
+    }
+    case WIDGET_ALIGN_RIGHT:
+      return (int16_t)(w.x + w.w - tw - w.inset);
+    default:
+      return (int16_t)(w.x + w.inset);
+  }
+}
+
+/**
+ * @brief Cursor-Segment aus dem Ziel-Widget. false => nichts anzuzeigen.
+ */
+static bool cursorSegment(const Widget &c, int16_t &x0, int16_t &x1, int16_t &y) {
+  if (c.cell < 0 || !validId(c.target) || !effectiveVisible(c.target)) return false;
+
+  const Widget &t = widgets[c.target];
+  y = t.y + t.h + t.size;
+
+  if (t.type == WIDGET_VALUE) {
+    if (c.cell >= t.len) return false;
+    x0 = t.x + c.cell * t.cellW;
+    x1 = x0 + t.cellW - 2;
+    return true;
+  }
+
+  const int16_t tw = textW(currentText(t), t.size);
+  x0 = alignX(t, tw);
+  x1 = x0 + tw - 2;
+  return true;
+}
+
+// --------------------
+// Zeichnen pro Typ
+// --------------------
+
+/**
+ * @brief Text deckend in die Box, Restzeilen unter dem Text loeschen.
+ */
+static void paintText(Widget &w, const char* s, const GuiColor &c) {
+  const int16_t th = textH(w.size);
+  drawTextOpaque(s, alignX(w, textW(s, w.size)), w.y, w.size,
+                 c.r, c.g, c.b, 0, 0, 0, w.x, w.w);
+  if (th < w.h) fillBlack(w.x, w.y + th, w.w, w.h - th);
+}
+
+/**
+ * @brief Zeichnet eine Zeichenzelle eines VALUE-Widgets (deckend).
+ */
+static void paintCell(const Widget &w, uint8_t i, char c) {
+  const int16_t x = w.x + i * w.cellW;
+
+  if (w.font >= 0) {
+    glyphAtlasDrawChar(w.font, c, x, w.y);
+    return;
+  }
+
+  // Fallback ohne Atlas: Zelle loeschen, Zeichen transparent zeichnen
+  const char s[2] = { c, '\0' };
+  fillBlack(x, w.y, w.cellW, w.cellH);
+  drawText(s, x, w.y, w.size, w.color.r, w.color.g, w.color.b);
+}
+
+static void paintValue(Widget &w) {
+  const bool full = !w.shown;
+  for (uint8_t i = 0; i < w.len; i++) {
+    if (full || w.str[i] != w.shownStr[i]) paintCell(w, i, w.str[i]);
+  }
+  memcpy(w.shownStr, w.str, sizeof(w.shownStr));
+}
+
+static void paintCursor(Widget &w) {
+  int16_t x0 = 0, x1 = 0, y = 0;
+  const bool want = cursorSegment(w, x0, x1, y);
+
+  // Altes Segment weg, wenn es sich bewegt hat oder der Cursor aus ist
+  if (w.shown && (!want || x0 != w.shownX0 || x1 != w.shownX1 || y != w.shownY)) {
+    drawLineRGB(w.shownX0, w.shownY, w.shownX1, w.shownY, 0, 0, 0);
+    w.shown = false;
+  }
+
+  if (want) {
+    drawLineRGB(x0, y, x1, y, w.color.r, w.color.g, w.color.b);
+    w.shownX0 = x0;
+    w.shownX1 = x1;
+    w.shownY = y;
+    w.shown = true;
+  }
+}
+
+/**
+ * @brief Zeichnet die Segmente eines Balkens: beim ersten Mal alle, danach nur
+ *        die zwischen gezeichnetem und neuem Pegel. Segment = Zelle minus 1 px Luecke.
+ */
+static void paintBar(Widget &w) {
+  if (w.segments == 0) return;
+  const int16_t segW = w.w / w.segments;
+
+  uint8_t from = 0, to = w.segments;
+  if (w.shown) {
+    from = (w.level < w.shownLevel) ? w.level : w.shownLevel;
+    to = (w.level < w.shownLevel) ? w.shownLevel : w.level;
+  }
+
+  for (uint8_t i = from; i < to; i++) {
+    const GuiColor &c = (i < w.level) ? w.color : w.colorOff;
+    fillRectRGB(w.x + i * segW, w.y, segW - 1, w.h, c.r, c.g, c.b);
+  }
+  w.shownLevel = w.level;
+}
+
+static void paintWidget(Widget &w) {
+  switch (w.type) {
+    case WIDGET_LABEL:
+    case WIDGET_LIST:
+      paintText(w, currentText(w), w.color);
+      break;
+    case WIDGET_INDICATOR:
+      paintText(w, currentText(w), w.on ? w.color : w.colorOff);
+      break;
+    case WIDGET_VALUE:
+      paintValue(w);
+      break;
+    case WIDGET_CURSOR:
+      paintCursor(w);
+      return;   // shown setzt paintCursor selbst
+    case WIDGET_RULE:
+      drawLineRGB(w.x, w.y, w.x + w.w - 1, w.y, w.color.r, w.color.g, w.color.b);
+      break;
+    case WIDGET_BAR:
+      paintBar(w);
+      break;
+    default:
+      return;
+  }
+  w.shown = true;
+}
+
+/**
+ * @brief Sichtbare, bereits gezeichnete Widgets im geloeschten Bereich neu zeichnen
+ *        lassen. Noetig, wenn die Sichtbarkeit mitten im Durchlauf wechselt
+ *        (Screenwechsel in der Zeichenphase): die neue Gruppe steht dann schon auf
+ *        dem Display, die alte wird erst im naechsten Durchlauf geloescht.
+ */
+static void redirtyOverlapping(const Widget &erased, int16_t x, int16_t y, int16_t w, int16_t h) {
+  for (uint8_t i = 0; i < widgetCount; i++) {
+    const Widget &o = widgets[i];
+    if (&o == &erased || o.type == WIDGET_GROUP || !o.shown || o.dirty) continue;
+    if (o.x >= x + w || x >= o.x + o.w || o.y >= y + h || y >= o.y + o.h) continue;
+    if (effectiveVisible((WidgetId)i)) markDirty((WidgetId)i);
+  }
+}
+
+static void eraseWidget(Widget &w) {
+  if (w.type == WIDGET_CURSOR) {
+    drawLineRGB(w.shownX0, w.shownY, w.shownX1, w.shownY, 0, 0, 0);
+    redirtyOverlapping(w, w.shownX0, w.shownY, w.shownX1 - w.shownX0 + 1, 1);
+  } else {
+    fillBlack(w.x, w.y, w.w, w.h);
+    redirtyOverlapping(w, w.x, w.y, w.w, w.h);
+  }
+  w.shown = false;
+}
+
+// --------------------
+// Public API
+// --------------------
+
+void widgetsReset() {
+  widgetCount = 0;
+  passPos = 0;
+}
+
+WidgetId widgetAddGroup(WidgetId parent) {
+  return addWidget(WIDGET_GROUP, parent);
+}
+
+WidgetId widgetAddLabel(WidgetId parent, const char* text, uint8_t size,
+                        const GuiColor &color, WidgetAlign align) {
+  const WidgetId id = addWidget(WIDGET_LABEL, parent);
+  if (id < 0) return id;
+
+  Widget &w = widgets[id];
+  w.text = text;
+  w.size = size;
+  w.color = color;
+  w.align = align;
+  return id;
+}
+
+WidgetId widgetAddValue(WidgetId parent, int8_t font, uint8_t len, uint8_t size,
+                        const GuiColor &color) {
+  const WidgetId id = addWidget(WIDGET_VALUE, parent);
+  if (id < 0) return id;
+
+  Widget &w = widgets[id];
+  w.font = font;
+  w.len = (len > WIDGET_VALUE_MAX) ? WIDGET_VALUE_MAX : len;
+  w.size = size;
+  w.color = color;
+
+  // Zellmasse aus dem Atlas (Fallback: Default-Font 6x8)
+  w.cellW = (font >= 0) ? glyphAtlasGlyphW(font) : (int16_t)(6 * size);
+  w.cellH = (font >= 0) ? glyphAtlasGlyphH(font) : textH(size);
+
+  memset(w.str, ' ', w.len);
+  return id;
+}
+
+WidgetId widgetAddList(WidgetId parent, const char* const* items, int count,
+                       uint8_t size, const GuiColor &color) {
+  const WidgetId id = addWidget(WIDGET_LIST, parent);
+  if (id < 0) return id;
+
+  Widget &w = widgets[id];
+  w.items = items;
+  w.count = count;
+  w.size = size;
+  w.color = color;
+  w.align = WIDGET_ALIGN_CENTER;
+  return id;
+}
+
+WidgetId widgetAddIndicator(WidgetId parent, const char* text, uint8_t size,
+                            const GuiColor &onColor, const GuiColor &offColor) {
+  const WidgetId id = addWidget(WIDGET_INDICATOR, parent);
+  if (id < 0) return id;
+
+  Widget &w = widgets[id];
+  w.text = text;
+  w.size = size;
+  w.color = onColor;
+  w.colorOff = offColor;
+  w.align = WIDGET_ALIGN_CENTER;
+  return id;
+}
+
+WidgetId widgetAddCursor(WidgetId parent, WidgetId target, const GuiColor &color) {
+  const WidgetId id = addWidget(WIDGET_CURSOR, parent);
+  if (id < 0) return id;
+
+  widgets[id].target = target;
+  widgets[id].color = color;
+  return id;
+}
+
+WidgetId widgetAddRule(WidgetId parent, const GuiColor &color) {
+  const WidgetId id = addWidget(WIDGET_RULE, parent);
+  if (id < 0) return id;
+
+  widgets[id].color = color;
+  return id;
+}
+
+WidgetId widgetAddBar(WidgetId parent, uint8_t segments, const GuiColor &onColor,
+                      const GuiColor &offColor) {
+  const WidgetId id = addWidget(WIDGET_BAR, parent);
+  if (id < 0) return id;
+
+  Widget &w = widgets[id];
+  w.segments = segments;
+  w.color = onColor;
+  w.colorOff = offColor;
+  return id;
+}
+
+void widgetMeasure(WidgetId id, int16_t &w, int16_t &h) {
+  w = h = 0;
+  if (!validId(id)) return;
+  const Widget &wd = widgets[id];
+
+  switch (wd.type) {
+    case WIDGET_LABEL:
+    case WIDGET_INDICATOR:
+      w = textW(currentText(wd), wd.size);
+      h = textH(wd.size);
+      break;
+    case WIDGET_LIST:
+      for (int i = 0; i < wd.count; i++) {
+        const int16_t iw = textW(wd.items[i], wd.size);
+        if (iw > w) w = iw;
+      }
+      h = textH(wd.size);
+      break;
+    case WIDGET_VALUE:
+      w = wd.cellW * wd.len;
+      h = wd.cellH;
+      break;
+    case WIDGET_RULE:
+      h = 1;
+      break;
+    default:
+      break;
+  }
+}
+
+void widgetSetBounds(WidgetId id, int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (!validId(id)) return;
+  Widget &wd = widgets[id];
+  wd.x = x;
+  wd.y = y;
+  wd.w = w;
+  wd.h = h;
+  markDirty(id);
+}
+
+void widgetSetInset(WidgetId id, int16_t inset) {
+  if (!validId(id) || widgets[id].inset == inset) return;
+  widgets[id].inset = inset;
+  markDirty(id);
+}
+
+void widgetsInvalidateAll() {
+  for (uint8_t i = 0; i < widgetCount; i++) {
+    widgets[i].shown = false;
+    widgets[i].dirty = true;
+  }
+  passPos = 0;
+}
+
+void widgetSetVisible(WidgetId id, bool visible) {
+  if (!validId(id) || widgets[id].visible == visible) return;
+  widgets[id].visible = visible;
+  markDirty(id);
+
+  // Gruppe: alle Nachfahren loeschen bzw. zeichnen
+  for (uint8_t i = 0; i < widgetCount; i++) {
+    if (isDescendant((WidgetId)i, id)) markDirty((WidgetId)i);
+  }
+}
+
+void widgetSetText(WidgetId id, const char* text) {
+  if (!validId(id)) return;
+  Widget &w = widgets[id];
+  if (w.text == text || (w.text && text && strcmp(w.text, text) == 0)) {
+    w.text = text;
+    return;
+  }
+  w.text = text;
+  markDirty(id);
+}
+
+void widgetSetTextSize(WidgetId id, uint8_t size) {
+  if (!validId(id) || widgets[id].size == size) return;
+  widgets[id].size = size;
+  markDirty(id);
+}
+
+void widgetSetAlign(WidgetId id, WidgetAlign align) {
+  if (!validId(id) || widgets[id].align == align) return;
+  widgets[id].align = align;
+  markDirty(id);
+}
+
+void widgetSetColor(WidgetId id, const GuiColor &color) {
+  if (!validId(id)) return;
+  GuiColor &c = widgets[id].color;
+  if (c.r == color.r && c.g == color.g && c.b == color.b) return;
+  c = color;
+  markDirty(id);
+}
+
+void widgetSetValue(WidgetId id, const char* str) {
+  if (!validId(id) || widgets[id].type != WIDGET_VALUE) return;
+  Widget &w = widgets[id];
+
+  bool changed = false;
+  bool ended = false;
+  for (uint8_t i = 0; i < w.len; i++) {
+    if (!ended && str[i] == '\0') ended = true;
+    const char c = ended ? ' ' : str[i];
+    if (w.str[i] != c) { w.str[i] = c; changed = true; }
+  }
+  // Zellinhalt verschiebt keinen Cursor => nur das Widget selbst
+  if (changed) w.dirty = true;
+}
+
+void widgetSetIndex(WidgetId id, int index) {
+  if (!validId(id) || widgets[id].index == index) return;
+  widgets[id].index = index;
+  markDirty(id);
+}
+
+void widgetSetOn(WidgetId id, bool on) {
+  if (!validId(id) || widgets[id].on == on) return;
+  widgets[id].on = on;
+  markDirty(id);
+}
+
+void widgetSetLevel(WidgetId id, uint8_t level) {
+  if (!validId(id) || widgets[id].type != WIDGET_BAR) return;
+  Widget &w = widgets[id];
+  if (level > w.segments) level = w.segments;
+  if (w.level == level) return;
+
+  // Pegel verschiebt keinen Cursor => nur das Widget selbst
+  w.level = level;
+  w.dirty = true;
+}
+
+void widgetSetCursor(WidgetId id, int8_t cell) {
+  if (!validId(id) || widgets[id].cell == cell) return;
+  widgets[id].cell = cell;
+  markDirty(id);
+}
+
+bool widgetsAnyDirty() {
+  for (uint8_t i = 0; i < widgetCount; i++) {
+    if (widgets[i].dirty) return true;
+  }
+  return false;
+}
+
+void widgetsBeginPass() {
+  passPos = 0;
+}
+
+bool widgetsPaintNext() {
+  while (passPos < 2 * widgetCount) {
+    const bool erasePhase = passPos < widgetCount;
+    Widget &w = widgets[passPos % widgetCount];
+    passPos++;
+
+    if (!w.dirty) continue;
+
+    if (w.type == WIDGET_GROUP) {
+      w.dirty = false;
+      continue;
+    }
+
+    const bool visible = effectiveVisible((WidgetId)(&w - widgets));
+
+    if (erasePhase) {
+      // Loeschphase: nur versteckte Widgets, die noch auf dem Display stehen
+      if (visible) continue;
+      w.dirty = false;
+      if (!w.shown) continue;
+      eraseWidget(w);
+      return true;
+    }
+
+    // Zeichenphase (erst hier versteckt geworden => naechster Durchlauf)
+    if (!visible) continue;
+    w.dirty = false;
+    paintWidget(w);
+    return true;
+  }
+
+  return false;
+}
@@ -0,0 +1,120 @@
+// lib/GUI/Widgets.h
+//
+// Leichtgewichtige Retained-Widget-Schicht fuer die GUI.
+//
+// Idee:
+// - Die GUI legt ihre Anzeigeelemente einmal als Widgets an (Label, Wert, Liste,
+//   Indikator, Cursor, Trennlinie, Balken) und haengt sie in Gruppen (z.B. ein Screen).
+// - Jedes Widget hat eine Bounding Box (vom Layout gesetzt, einmal pro Rotation)
+//   und ein eigenes Dirty-Bit.
+// - Setter vergleichen mit dem aktuellen Inhalt und markieren nur bei Aenderung.
+// - Gezeichnet werden nur invalidierte Widgets. Wird ein Widget (oder seine Gruppe)
+//   unsichtbar, loescht es genau seine zuletzt gezeichnete Box.
+//
+// Zeichenreihenfolge = Anlagereihenfolge. Ein Durchlauf (widgetsBeginPass)
+// loescht zuerst alle versteckten, danach zeichnet er alle sichtbaren Widgets.
+//
+// Wichtig:
+// - Kein Arduino-Include: zeichnet nur ueber TFTDisplay/GlyphAtlas (Host-faehig).
+// - Texte/Listen werden nicht kopiert (String-Literale bzw. dauerhaft gueltig).
+
+#pragma once
+#include <stdint.h>
+#include <gui_config.h>   // GuiColor
+
+// Max. Anzahl Widgets (alle Screens zusammen)
+#define WIDGET_MAX 32
+
+// Max. Zeichen eines VALUE-Widgets
+#define WIDGET_VALUE_MAX 8
+
+typedef int8_t WidgetId;   // -1 => keins / ungueltig
+
+enum WidgetAlign : uint8_t {
+  WIDGET_ALIGN_LEFT = 0,
+  WIDGET_ALIGN_CENTER,
+  WIDGET_ALIGN_RIGHT
+};
+
+// Loescht alle Widgets (vor dem Neuaufbau)
+void widgetsReset();
+
+// --------------------
+// Anlegen
+// --------------------
+
+// Container (z.B. ein Screen). Unsichtbare Gruppe => alle Kinder unsichtbar.
+WidgetId widgetAddGroup(WidgetId parent);
+
+// Text deckend in seiner Box (Box-Rest unterhalb des Textes wird geloescht)
+WidgetId widgetAddLabel(WidgetId parent, const char* text, uint8_t size,
+                        const GuiColor &color, WidgetAlign align);
+
+// Zeichenkette fester Laenge, zeichenweise aus einem Glyph-Atlas-Font
+// (font < 0 => Default-Font). Nur geaenderte Zeichenzellen werden neu gezeichnet.
+WidgetId widgetAddValue(WidgetId parent, int8_t font, uint8_t len, uint8_t size,
+                        const GuiColor &color);
+
+// Ein Eintrag aus einer String-Liste, zentriert in seiner Box
+WidgetId widgetAddList(WidgetId parent, const char* const* items, int count,
+                       uint8_t size, const GuiColor &color);
+
+// Kurzer Statustext mit Ein-/Aus-Farbe
+WidgetId widgetAddIndicator(WidgetId parent, const char* text, uint8_t size,
+                            const GuiColor &onColor, const GuiColor &offColor);
+
+// Unterstrich unter einer Zeichenzelle (VALUE) bzw. unter dem Text (LIST)
+WidgetId widgetAddCursor(WidgetId parent, WidgetId target, const GuiColor &color);
+
+// Horizontale Trennlinie ueber die Boxbreite
+WidgetId widgetAddRule(WidgetId parent, const GuiColor &color);
+
+// Pegelbalken aus gleich breiten Segmenten (Meter). Bei neuem Pegel werden nur
+// die Segmente zwischen altem und neuem Pegel neu gezeichnet.
+WidgetId widgetAddBar(WidgetId parent, uint8_t segments, const GuiColor &onColor,
+                      const GuiColor &offColor);
+
+// --------------------
+// Layout (einmal pro Rotation)
+// --------------------
+
+// Natuerliche Groesse (Text/Zellen) fuer die Layout-Berechnung
+void widgetMeasure(WidgetId id, int16_t &w, int16_t &h);
+
+// Bounding Box setzen (Cursor: ergibt sich aus dem Ziel, nicht noetig)
+void widgetSetBounds(WidgetId id, int16_t x, int16_t y, int16_t w, int16_t h);
+
+// Abstand des Textes zum Boxrand (Label/Liste)
+void widgetSetInset(WidgetId id, int16_t inset);
+
+// Display wurde komplett geloescht: alles gilt als nicht gezeichnet + dirty
+void widgetsInvalidateAll();
+
+// --------------------
+// Inhalt (markiert nur bei Aenderung)
+// --------------------
+void widgetSetVisible(WidgetId id, bool visible);
+void widgetSetText(WidgetId id, const char* text);
+void widgetSetTextSize(WidgetId id, uint8_t size);
+void widgetSetAlign(WidgetId id, WidgetAlign align);
+void widgetSetColor(WidgetId id, const GuiColor &color);
+void widgetSetValue(WidgetId id, const char* str);    // VALUE
+void widgetSetIndex(WidgetId id, int index);          // LIST
+void widgetSetOn(WidgetId id, bool on);               // INDICATOR
+void widgetSetLevel(WidgetId id, uint8_t level);      // BAR: leuchtende Segmente 0..segments
+void widgetSetCursor(WidgetId id, int8_t cell);       // CURSOR: Zelle bzw. 0 (LIST), -1 = aus
+
+// --------------------
+// Zeichnen
+// --------------------
+
+// true wenn mindestens ein Widget neu gezeichnet/geloescht werden muss
+bool widgetsAnyDirty();
+
+// Startet einen Durchlauf ueber alle Widgets
+void widgetsBeginPass();
+
+// Zeichnet bzw. loescht das naechste invalidierte Widget des Durchlaufs.
+// false => Durchlauf fertig (nichts mehr zu tun). Was danach dirty wird,
+// kommt in den naechsten Durchlauf.
+bool widgetsPaintNext();
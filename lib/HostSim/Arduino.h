@@ -0,0 +1,77 @@
+// lib/HostSim/Arduino.h
+//
+// Minimaler Arduino-Ersatz fuer Host-Builds (PlatformIO env:native_*).
+//
+// Zweck:
+// - GUI, RotaryEncoder, NavButtons usw. kompilieren unveraendert auf Linux.
+// - Zeit (millis/micros) kommt aus einer Fake-Clock, GPIOs aus einem Pin-Array.
+//   Beides wird ueber HostSim.h vom Simulations-/Testprogramm gesteuert.
+//
+// Wichtig:
+// - Nur das, was die Module dieses Projekts tatsaechlich benutzen.
+// - Wird im ESP32-Build per lib_ignore ausgeschlossen.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+
+#define IRAM_ATTR
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t level);
+
+int digitalPinToInterrupt(uint8_t pin);
+void attachInterrupt(int irq, void (*isr)(), int mode);
+void detachInterrupt(int irq);
+
+void noInterrupts();
+void interrupts();
+
+/**
+ * Serial-Ersatz: Ausgabe nach stdout, Eingabe aus hostSerialInject().
+ */
+class HostSerial {
+public:
+  void begin(unsigned long) {}
+
+  size_t write(uint8_t c);
+  size_t print(const char* s);
+  size_t print(char c);
+  size_t print(int v);
+  size_t print(unsigned int v);
+  size_t print(long v);
+  size_t print(unsigned long v);
+  size_t println(const char* s = "");
+  size_t println(int v);
+  size_t println(unsigned long v);
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+  int available();
+  int read();
+
+  operator bool() const { return true; }
+};
+
+extern HostSerial Serial;
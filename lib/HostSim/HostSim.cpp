@@ -0,0 +1,153 @@
+// lib/HostSim/HostSim.cpp
+//
+// Host-Umgebung fuer Arduino-Code (siehe Arduino.h / HostSim.h).
+
+#ifndef ARDUINO
+
+#include "Arduino.h"
+#include "HostSim.h"
+
+// --------------------
+// Fake-Clock + GPIO
+// --------------------
+static const uint8_t HOST_PINS = 40;   // ESP32: GPIO 0..39
+
+static uint64_t nowUs = 0;
+
+// Pegel als "ist LOW" gespeichert: Default (false) = HIGH wie mit Pull-up
+static bool pinLow[HOST_PINS];
+
+struct HostIsr {
+  void (*fn)();
+  int mode;
+};
+
+static HostIsr isr[HOST_PINS];
+
+// Serial-Eingabe (Ringpuffer)
+static char serialIn[256];
+static uint16_t serialHead = 0;
+static uint16_t serialTail = 0;
+
+HostSerial Serial;
+
+void hostSimReset() {
+  nowUs = 0;
+  for (uint8_t i = 0; i < HOST_PINS; i++) {
+    pinLow[i] = false;
+    isr[i].fn = nullptr;
+    isr[i].mode = 0;
+  }
+  serialHead = serialTail = 0;
+}
+
+void hostAdvanceUs(uint32_t us) { nowUs += us; }
+uint64_t hostNowUs() { return nowUs; }
+
+void hostSetPin(uint8_t pin, int level) {
+  if (pin >= HOST_PINS) return;
+
+  const bool wasLow = pinLow[pin];
+  pinLow[pin] = (level == LOW);
+  if (wasLow == pinLow[pin] || !isr[pin].fn) return;
+
+  const bool rising = !pinLow[pin];
+  if (isr[pin].mode == CHANGE ||
+      (isr[pin].mode == RISING && rising) ||
+      (isr[pin].mode == FALLING && !rising)) {
+    isr[pin].fn();
+  }
+}
+
+int hostGetPin(uint8_t pin) {
+  if (pin >= HOST_PINS) return LOW;
+  return pinLow[pin] ? LOW : HIGH;
+}
+
+uint32_t hostGpioInReg(uint8_t reg) {
+  uint32_t v = 0;
+  for (uint8_t bit = 0; bit < 32; bit++) {
+    const uint8_t pin = (uint8_t)(reg * 32 + bit);
+    if (pin < HOST_PINS && !pinLow[pin]) v |= 1u << bit;
+  }
+  return v;
+}
+
+void hostSerialInject(const char* text) {
+  for (const char* p = text; *p; p++) {
+    const uint16_t next = (uint16_t)((serialHead + 1) % sizeof(serialIn));
+    if (next == serialTail) return;
+    serialIn[serialHead] = *p;
+    serialHead = next;
+  }
+}
+
+// --------------------
+// Arduino-API
+// --------------------
+uint32_t millis() { return (uint32_t)(nowUs / 1000); }
+uint32_t micros() { return (uint32_t)nowUs; }
+
+void delay(uint32_t ms) { nowUs += (uint64_t)ms * 1000; }
+void delayMicroseconds(uint32_t us) { nowUs += us; }
+
+// Pegel steuert allein der Host (hostSetPin), Default ist HIGH
+void pinMode(uint8_t, uint8_t) {}
+
+int digitalRead(uint8_t pin) { return hostGetPin(pin); }
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+  if (pin < HOST_PINS) pinLow[pin] = (level == LOW);
+}
+
+int digitalPinToInterrupt(uint8_t pin) { return pin; }
+
+void attachInterrupt(int irq, void (*fn)(), int mode) {
+  if (irq < 0 || irq >= HOST_PINS) return;
+  isr[irq].fn = fn;
+  isr[irq].mode = mode;
+}
+
+void detachInterrupt(int irq) {
+  if (irq < 0 || irq >= HOST_PINS) return;
+  isr[irq].fn = nullptr;
+}
+
+// Host: Handler laufen synchron in hostSetPin(), es gibt nichts zu sperren
+void noInterrupts() {}
+void interrupts() {}
+
+// --------------------
+// Serial
+// --------------------
+size_t HostSerial::write(uint8_t c) { return fputc(c, stdout) == EOF ? 0 : 1; }
+size_t HostSerial::print(const char* s) { return (size_t)fputs(s, stdout) >= 0 ? strlen(s) : 0; }
+size_t HostSerial::print(char c) { return write((uint8_t)c); }
+size_t HostSerial::print(int v) { return (size_t)::printf("%d", v); }
+size_t HostSerial::print(unsigned int v) { return (size_t)::printf("%u", v); }
+size_t HostSerial::print(long v) { return (size_t)::printf("%ld", v); }
+size_t HostSerial::print(unsigned long v) { return (size_t)::printf("%lu", v); }
+size_t HostSerial::println(const char* s) { return print(s) + print('\n'); }
+size_t HostSerial::println(int v) { return print(v) + print('\n'); }
+size_t HostSerial::println(unsigned long v) { return print(v) + print('\n'); }
+
+size_t HostSerial::printf(const char* fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  const int n = vprintf(fmt, ap);
+  va_end(ap);
+  return (n > 0) ? (size_t)n : 0;
+}
+
+int HostSerial::available() {
+  return (int)((serialHead + sizeof(serialIn) - serialTail) % sizeof(serialIn));
+}
+
+int HostSerial::read() {
+  if (serialHead == serialTail) return -1;
+  const char c = serialIn[serialTail];
+  serialTail = (uint16_t)((serialTail + 1) % sizeof(serialIn));
+  return (unsigned char)c;
+}
+
+#endif // !ARDUINO
@@ -0,0 +1,26 @@
+// lib/HostSim/HostSim.h
+//
+// Steuerung der Host-Umgebung (Fake-Clock, Fake-GPIO, Serial-Eingabe).
+// Nur fuer Host-Builds; Gegenstueck zu lib/HostSim/Arduino.h.
+
+#pragma once
+#include <stdint.h>
+
+// Alles auf Anfang: Zeit = 0, alle Pins HIGH (Pull-ups, Taster offen)
+void hostSimReset();
+
+// Fake-Clock weiterdrehen (millis()/micros() laufen nur hierueber und ueber delay())
+void hostAdvanceUs(uint32_t us);
+uint64_t hostNowUs();
+
+// Eingangspegel setzen. Bei Pegelwechsel werden per attachInterrupt()
+// registrierte Handler passend zum Modus (RISING/FALLING/CHANGE) aufgerufen.
+void hostSetPin(uint8_t pin, int level);
+int hostGetPin(uint8_t pin);
+
+// Nachgebildete Eingangsregister (wie GPIO_IN_REG / GPIO_IN1_REG):
+// reg 0 = GPIO 0..31, reg 1 = GPIO 32..39, Bit gesetzt = HIGH
+uint32_t hostGpioInReg(uint8_t reg);
+
+// Text in den Serial-Eingang legen (Serial.available()/read())
+void hostSerialInject(const char* text);
@@ -0,0 +1,93 @@
+// lib/InputEvents/InputEvents.cpp
+//
+// Begrenzte lock-freie Queue (siehe InputEvents.h).
+//
+// Prinzip (Sequenznummer pro Zelle):
+// - Zelle i ist frei fuer Schreibposition p, wenn seq == p.
+// - Producer reserviert p per compare_exchange auf enqueuePos, schreibt das
+//   Ereignis und gibt die Zelle mit seq = p + 1 frei (release).
+// - Consumer liest an Position p, wenn seq == p + 1, und gibt die Zelle mit
+//   seq = p + SIZE fuer die naechste Runde zurueck.
+// - Kein Producer wartet auf einen anderen: ein unterbrochener Producer haelt
+//   nur "seinen" Platz auf, der Consumer sieht ihn dann einfach noch als leer.
+
+#include "InputEvents.h"
+
+#include <atomic>
+
+static_assert((INPUT_QUEUE_SIZE & (INPUT_QUEUE_SIZE - 1)) == 0, "INPUT_QUEUE_SIZE muss 2^n sein");
+static_assert(INPUT_QUEUE_SIZE <= 255, "inputDrain() zaehlt in uint8_t");
+
+struct Cell {
+  std::atomic<uint32_t> seq;
+  InputEvent ev;
+};
+
+static Cell cells[INPUT_QUEUE_SIZE];
+static std::atomic<uint32_t> enqueuePos(0);
+static std::atomic<uint32_t> dequeuePos(0);
+static std::atomic<uint32_t> dropped(0);
+
+void inputQueueInit() {
+  for (uint32_t i = 0; i < INPUT_QUEUE_SIZE; i++) {
+    cells[i].seq.store(i, std::memory_order_relaxed);
+  }
+  enqueuePos.store(0, std::memory_order_relaxed);
+  dequeuePos.store(0, std::memory_order_relaxed);
+  dropped.store(0, std::memory_order_release);
+}
+
+bool inputPush(uint8_t source, uint8_t type, uint32_t us, int32_t value) {
+  uint32_t pos = enqueuePos.load(std::memory_order_relaxed);
+
+  for (;;) {
+    Cell &c = cells[pos & (INPUT_QUEUE_SIZE - 1)];
+    const uint32_t seq = c.seq.load(std::memory_order_acquire);
+    const int32_t diff = (int32_t)(seq - pos);
+
+    if (diff == 0) {
+      // Platz frei: reservieren (schlaegt fehl, wenn ein anderer Producer schneller war)
+      if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        c.ev.source = source;
+        c.ev.type = type;
+        c.ev.us = us;
+        c.ev.value = value;
+        c.seq.store(pos + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (diff < 0) {
+      // Zelle noch nicht vom Consumer freigegeben => voll
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    } else {
+      pos = enqueuePos.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+bool inputPop(InputEvent &out) {
+  const uint32_t pos = dequeuePos.load(std::memory_order_relaxed);
+  Cell &c = cells[pos & (INPUT_QUEUE_SIZE - 1)];
+
+  if (c.seq.load(std::memory_order_acquire) != pos + 1) return false;
+
+  out = c.ev;
+  c.seq.store(pos + INPUT_QUEUE_SIZE, std::memory_order_release);
+  dequeuePos.store(pos + 1, std::memory_order_relaxed);
+  return true;
+}
+
+bool inputPending() {
+  const uint32_t pos = dequeuePos.load(std::memory_order_relaxed);
+  return cells[pos & (INPUT_QUEUE_SIZE - 1)].seq.load(std::memory_order_acquire) == pos + 1;
+}
+
+uint8_t inputDrain(InputEvent* out, uint8_t max) {
+  uint8_t n = 0;
+  while (n < max && inputPop(out[n])) n++;
+  return n;
+}
+
+uint32_t inputDroppedCount() {
+  return dropped.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,61 @@
+// lib/InputEvents/InputEvents.h
+//
+// Gemeinsame Eingabe-Queue fuer alle Input-Module (Encoder, Taster, spaeter Remote).
+//
+// Idee:
+// - Jedes Ereignis ist ein Eintrag {source, type, us, value} mit micros()-Zeitstempel.
+// - Producer (RotaryEncoder, NavButtons, ...) haengen an, die GUI leert die Queue
+//   gesammelt pro Durchlauf. Reihenfolge bleibt exakt erhalten, nichts kollabiert,
+//   auch wenn guiUpdate() wegen Renderlast spaet dran ist.
+// - Ring fester Groesse, lock-frei (Sequenznummer pro Zelle): mehrere Producer
+//   (loop(), andere Tasks) und ein Consumer. Voll => Ereignis wird verworfen
+//   und gezaehlt. Die Encoder-ISR schreibt weiterhin in ihren IRAM-Ring
+//   (StepRing.h); updateRotaryEncoder() uebertraegt die Schritte hierher.
+//
+// Kein Arduino-Include: laeuft unveraendert auf dem Host.
+
+#pragma once
+#include <stdint.h>
+
+// Kapazitaet (Zweierpotenz)
+#ifndef INPUT_QUEUE_SIZE
+#define INPUT_QUEUE_SIZE 64
+#endif
+
+enum InputSource : uint8_t {
+  INPUT_SRC_ENCODER = 0,   // Drehimpuls
+  INPUT_SRC_ENC_BUTTON,    // Encoder-Taster
+  INPUT_SRC_LEFT,          // Nav-Taster links
+  INPUT_SRC_RIGHT          // Nav-Taster rechts
+};
+
+enum InputType : uint8_t {
+  INPUT_ROTATE = 0,        // value = +1/-1 (ein Schritt)
+  INPUT_PRESS,             // Short-Press (beim Loslassen, nur ohne Long-Press)
+  INPUT_LONG_PRESS         // Long-Press (einmalig nach Haltezeit)
+};
+
+struct InputEvent {
+  uint8_t source;          // InputSource
+  uint8_t type;            // InputType
+  uint32_t us;             // micros() beim Auftreten
+  int32_t value;
+};
+
+// Leert die Queue und setzt die Zaehler zurueck (einmal in setup(), vor den Input-Modulen)
+void inputQueueInit();
+
+// Ereignis anhaengen (lock-frei, beliebiger Kontext). false => Queue voll
+bool inputPush(uint8_t source, uint8_t type, uint32_t us, int32_t value);
+
+// Aeltestes Ereignis entnehmen (nur ein Consumer). false => leer
+bool inputPop(InputEvent &out);
+
+// true, wenn mindestens ein Ereignis abholbereit ist (nur Consumer-Seite)
+bool inputPending();
+
+// Bis zu max Ereignisse am Stueck entnehmen (in Reihenfolge), liefert die Anzahl
+uint8_t inputDrain(InputEvent* out, uint8_t max);
+
+// Diagnose: wegen voller Queue verworfene Ereignisse
+uint32_t inputDroppedCount();
@@ -0,0 +1,159 @@
+// lib/LatencyTrace/LatencyTrace.cpp
+//
+// Histogramme + Zustandsmaschine fuer die Latenzmessung (siehe LatencyTrace.h).
+//
+// Zwei Messplaetze:
+// - pending:  Eingabe angewendet, Frame noch nicht geoeffnet
+// - inflight: Frame geoeffnet, Flush noch nicht fertig
+// Render-Start schiebt pending -> inflight, Flush-Ende wertet inflight aus.
+// So wird eine Eingabe, die waehrend eines laufenden Flushs kommt, dem
+// naechsten Frame zugeordnet.
+
+#include "LatencyTrace.h"
+
+#if LATENCY_TRACE
+
+#include <Arduino.h>
+
+// Fachaufteilung: 0..3 exakt, darueber 4 Faecher je Zweierpotenz bis 2^24 us (16 s)
+static const uint8_t LAT_SUB_BITS = 2;
+static const uint8_t LAT_MAX_BITS = 24;
+static const uint8_t LAT_BINS = (1 << LAT_SUB_BITS) * (LAT_MAX_BITS - LAT_SUB_BITS + 1);
+
+struct LatencyHistogram {
+  uint32_t bins[LAT_BINS];
+  uint32_t count;
+  uint32_t max;
+};
+
+struct LatencySlot {
+  bool active;
+  uint32_t edgeUs;
+  uint32_t stateUs;
+  uint32_t renderUs;
+};
+
+static LatencyHistogram hist[LAT_STAGE_COUNT];
+static LatencySlot pending;
+static LatencySlot inflight;
+
+static const char* const STAGE_NAME[LAT_STAGE_COUNT] = {
+  "input->state",
+  "state->render",
+  "render->flush",
+  "input->photon"
+};
+
+/**
+ * @brief Fach fuer einen Wert (log-linear, Werte >= 2^24 landen im letzten Fach).
+ */
+static uint8_t binOf(uint32_t v) {
+  const uint32_t sub = 1u << LAT_SUB_BITS;
+  if (v < sub) return (uint8_t)v;
+  if (v >= (1u << LAT_MAX_BITS)) return LAT_BINS - 1;
+
+  const uint8_t msb = (uint8_t)(31 - __builtin_clz(v));
+  const uint8_t frac = (uint8_t)((v >> (msb - LAT_SUB_BITS)) & (sub - 1));
+  return (uint8_t)(sub + (msb - LAT_SUB_BITS) * sub + frac);
+}
+
+/**
+ * @brief Groesster Wert, der in Fach b faellt.
+ */
+static uint32_t binUpper(uint8_t b) {
+  const uint32_t sub = 1u << LAT_SUB_BITS;
+  if (b < sub) return b;
+  if (b >= LAT_BINS - 1) return 0xFFFFFFFFu;
+
+  const uint8_t msb = (uint8_t)((b - sub) / sub + LAT_SUB_BITS);
+  const uint32_t frac = (b - sub) % sub;
+  const uint32_t lower = (sub + frac) << (msb - LAT_SUB_BITS);
+  return lower + (1u << (msb - LAT_SUB_BITS)) - 1;
+}
+
+static void record(uint8_t stage, uint32_t us) {
+  LatencyHistogram &h = hist[stage];
+  h.bins[binOf(us)]++;
+  h.count++;
+  if (us > h.max) h.max = us;
+}
+
+static uint32_t percentile(const LatencyHistogram &h, uint32_t pct) {
+  if (h.count == 0) return 0;
+
+  // Rang aufgerundet: p99 von 10 Werten = 10. Wert
+  const uint32_t rank = (uint32_t)(((uint64_t)h.count * pct + 99) / 100);
+  uint32_t seen = 0;
+  for (uint8_t b = 0; b < LAT_BINS; b++) {
+    seen += h.bins[b];
+    if (seen >= rank) {
+      const uint32_t upper = binUpper(b);
+      return (upper < h.max) ? upper : h.max;
+    }
+  }
+  return h.max;
+}
+
+void latencyReset() {
+  for (uint8_t s = 0; s < LAT_STAGE_COUNT; s++) {
+    for (uint8_t b = 0; b < LAT_BINS; b++) hist[s].bins[b] = 0;
+    hist[s].count = 0;
+    hist[s].max = 0;
+  }
+  pending.active = false;
+  inflight.active = false;
+}
+
+void latencyInput(uint32_t edgeUs, uint32_t nowUs) {
+  if (pending.active) return;   // aelteste Flanke behalten
+
+  pending.active = true;
+  pending.edgeUs = edgeUs;
+  pending.stateUs = nowUs;
+}
+
+void latencyDiscardPending() {
+  pending.active = false;
+}
+
+void latencyRenderStart(uint32_t nowUs) {
+  if (!pending.active) return;
+
+  inflight = pending;
+  inflight.renderUs = nowUs;
+  pending.active = false;
+}
+
+void latencyFlushDone(uint32_t nowUs) {
+  if (!inflight.active) return;
+
+  record(LAT_INPUT_TO_STATE,  inflight.stateUs - inflight.edgeUs);
+  record(LAT_STATE_TO_RENDER, inflight.renderUs - inflight.stateUs);
+  record(LAT_RENDER_TO_FLUSH, nowUs - inflight.renderUs);
+  record(LAT_INPUT_TO_PHOTON, nowUs - inflight.edgeUs);
+  inflight.active = false;
+}
+
+LatencySummary latencySummary(uint8_t stage) {
+  LatencySummary s = {0, 0, 0, 0};
+  if (stage >= LAT_STAGE_COUNT) return s;
+
+  const LatencyHistogram &h = hist[stage];
+  s.count = h.count;
+  s.p50 = percentile(h, 50);
+  s.p99 = percentile(h, 99);
+  s.max = h.max;
+  return s;
+}
+
+void latencyDump() {
+  Serial.printf("latency [us]    %8s %8s %8s %8s\n", "count", "p50", "p99", "max");
+  for (uint8_t i = 0; i < LAT_STAGE_COUNT; i++) {
+    const LatencySummary s = latencySummary(i);
+    Serial.printf("%-15s %8lu %8lu %8lu %8lu\n", STAGE_NAME[i],
+                  (unsigned long)s.count, (unsigned long)s.p50,
+                  (unsigned long)s.p99, (unsigned long)s.max);
+  }
+}
+
+#endif
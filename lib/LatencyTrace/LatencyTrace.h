@@ -0,0 +1,77 @@
+// lib/LatencyTrace/LatencyTrace.h
+//
+// Messung der Eingabe-Latenz ("Input-to-Photon"): von der Encoder-Rastung bzw.
+// dem Tastendruck bis die geaenderten Pixel auf dem ST7735 sind.
+//
+// Messpunkte (alle in micros()):
+//   Flanke      InputEvent.us (Encoder-ISR / NavButtons beim Erkennen)
+//   State       guiUpdate() hat das Event angewendet         -> latencyInput()
+//   Render      Frame mit der Aenderung wird geoeffnet       -> latencyRenderStart()
+//   Photon      SPI-Flush dieses Frames ist abgeschlossen    -> latencyFlushDone()
+//
+// - Mehrere Eingaben bis zum naechsten Frame zaehlen als eine Messung
+//   (gemessen ab der aeltesten Flanke = schlechtester Fall).
+// - Ergebnisse landen in Histogrammen fester Groesse (4 Stufen je Zweierpotenz,
+//   ca. 20 % Aufloesung), daraus p50/p99/max. Kein Heap.
+// - Abschaltbar per LATENCY_TRACE 0 (config.h): alle Aufrufe werden zu No-Ops.
+//
+// Laeuft unveraendert auf dem Host (gleiche Hooks in TFTDisplayHost/gui_sim).
+
+#pragma once
+#include <stdint.h>
+
+#include <config.h>
+
+#ifndef LATENCY_TRACE
+#define LATENCY_TRACE 1
+#endif
+
+// Teilstrecken (je ein Histogramm)
+enum LatencyStage : uint8_t {
+  LAT_INPUT_TO_STATE = 0,   // Flanke  -> State
+  LAT_STATE_TO_RENDER,      // State   -> Render-Start
+  LAT_RENDER_TO_FLUSH,      // Render  -> Flush fertig
+  LAT_INPUT_TO_PHOTON,      // Flanke  -> Flush fertig (gesamt)
+  LAT_STAGE_COUNT
+};
+
+struct LatencySummary {
+  uint32_t count;
+  uint32_t p50;   // us (Obergrenze des Histogramm-Fachs)
+  uint32_t p99;
+  uint32_t max;   // exakt
+};
+
+#if LATENCY_TRACE
+
+// Histogramme und laufende Messungen leeren
+void latencyReset();
+
+// Eingabe angewendet: edgeUs = Zeitstempel der Flanke, nowUs = jetzt
+void latencyInput(uint32_t edgeUs, uint32_t nowUs);
+
+// Eingabe hat nichts sichtbar geaendert => offene Messung verwerfen
+void latencyDiscardPending();
+
+// Frame geoeffnet (GUI-Render-Scheduler)
+void latencyRenderStart(uint32_t nowUs);
+
+// Flush abgeschlossen (TFTDisplay; auch wenn nichts zu senden war)
+void latencyFlushDone(uint32_t nowUs);
+
+LatencySummary latencySummary(uint8_t stage);
+
+// Alle Teilstrecken als Tabelle ueber Serial ausgeben
+void latencyDump();
+
+#else
+
+static inline void latencyReset() {}
+static inline void latencyInput(uint32_t, uint32_t) {}
+static inline void latencyDiscardPending() {}
+static inline void latencyRenderStart(uint32_t) {}
+static inline void latencyFlushDone(uint32_t) {}
+static inline LatencySummary latencySummary(uint8_t) { return LatencySummary{0, 0, 0, 0}; }
+static inline void latencyDump() {}
+
+#endif
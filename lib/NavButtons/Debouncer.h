@@ -0,0 +1,175 @@
+// lib/NavButtons/Debouncer.h
+//
+// Entprellung fuer eine feste Gruppe von Tastern (Taster gegen GND, INPUT_PULLUP).
+//
+// Prinzip:
+// - Die Pinliste ist Template-Parameter: DebouncerBank<ENC_SW, BTN_LEFT, ...>.
+//   Taste i = Bit i in allen Zustandsworten, Groesse steht zur Compile-Zeit fest.
+// - Pro Tick (DEBOUNCE_TICK_MS) werden alle Pegel auf einmal uebergeben
+//   (64-Bit-Wort, Bit n = GPIO n, z.B. direkt aus GPIO_IN_REG/GPIO_IN1_REG).
+// - Vertikaler 2-Bit-Zaehler je Taste: ein Pegel gilt erst als stabil, wenn er
+//   DEBOUNCE_SAMPLES Ticks in Folge vom alten Zustand abweicht. Alle Tasten
+//   werden mit denselben Bit-Operationen gleichzeitig behandelt, ohne Schleife.
+// - Short-Press beim Loslassen (nur ohne Long-Press), Long-Press einmalig nach
+//   DEBOUNCE_LONGPRESS_MS. Nur die (seltenen) Flanken und gehaltenen Tasten
+//   kosten eine Schleife ueber die gesetzten Bits.
+// - Ticks sind nur noetig, solange ein Pegel prellt (debouncerBusy()); den
+//   Long-Press-Zeitpunkt liefert debouncerLongPressDueMs() fuer einen Timer.
+//
+// Header-only und ohne Arduino-Include: laeuft unveraendert auf dem Host
+// (Pegelwort kommt dann aus einem nachgebildeten Register oder direkt aus dem Test).
+
+#pragma once
+#include <stdint.h>
+#include <initializer_list>
+
+// Abtastraster der Taster
+#ifndef DEBOUNCE_TICK_MS
+#define DEBOUNCE_TICK_MS 8
+#endif
+
+// Long-Press: wenn Taste so lange gehalten wird, gibt es genau EIN Long-Event
+#ifndef DEBOUNCE_LONGPRESS_MS
+#define DEBOUNCE_LONGPRESS_MS 700
+#endif
+
+// Der 2-Bit-Zaehler kippt beim 4. abweichenden Tick => 24..32 ms Entprellzeit
+#define DEBOUNCE_SAMPLES 4
+
+// Ereignisse eines Ticks (Bit i = Taste i)
+struct DebounceEvents {
+  uint32_t press;       // Short-Press (beim Loslassen)
+  uint32_t longPress;   // Long-Press (einmalig nach Haltezeit)
+};
+
+/**
+ * @brief Bitmaske der benutzten GPIOs (Bit n = GPIO n).
+ */
+static constexpr uint64_t debouncePinMask() { return 0; }
+
+template <typename... Rest>
+static constexpr uint64_t debouncePinMask(uint8_t pin, Rest... rest) {
+  return (1ULL << pin) | debouncePinMask(rest...);
+}
+
+template <uint8_t... Pins>
+struct DebouncerBank {
+  static const uint8_t COUNT = sizeof...(Pins);
+  static_assert(COUNT > 0 && COUNT <= 32, "DebouncerBank: 1..32 Taster");
+
+  // Benutzte GPIOs, getrennt nach Eingangsregister (GPIO 0..31 / 32..39)
+  static constexpr uint64_t PIN_MASK = debouncePinMask(Pins...);
+  static constexpr bool USES_LOW  = (PIN_MASK & 0xFFFFFFFFULL) != 0;
+  static constexpr bool USES_HIGH = (PIN_MASK >> 32) != 0;
+
+  uint32_t down;        // stabiler Zustand (1 = gedrueckt)
+  uint32_t cnt0;        // vertikaler Zaehler, Bit 0
+  uint32_t cnt1;        // vertikaler Zaehler, Bit 1
+  uint32_t longFired;   // Long-Press bereits gemeldet (unterdrueckt Short-Press)
+  uint32_t lastTickMs;
+  uint32_t downMs[COUNT];
+
+  /**
+   * @brief Pegelwort (Bit n = GPIO n) => Tastenbits (1 = gedrueckt, also LOW).
+   */
+  static uint32_t keysFromLevels(uint64_t levels) {
+    uint32_t keys = 0;
+    uint8_t i = 0;
+    (void)std::initializer_list<int>{ (keys |= (uint32_t)((levels >> Pins) & 1u) << i++, 0)... };
+    return ~keys & (uint32_t)((1ULL << COUNT) - 1);
+  }
+};
+
+/**
+ * @brief Startzustand aus den aktuellen Pegeln.
+ *        Beim Start bereits gedrueckte Tasten erzeugen kein Event.
+ */
+template <uint8_t... Pins>
+static inline void debouncerInit(DebouncerBank<Pins...> &b, uint64_t levels, uint32_t nowMs) {
+  b.down = DebouncerBank<Pins...>::keysFromLevels(levels);
+  b.cnt0 = 0;
+  b.cnt1 = 0;
+  b.longFired = b.down;
+  b.lastTickMs = nowMs;
+  for (uint8_t i = 0; i < DebouncerBank<Pins...>::COUNT; i++) b.downMs[i] = nowMs;
+}
+
+/**
+ * @brief true, wenn seit dem letzten Tick DEBOUNCE_TICK_MS vergangen sind
+ *        (erst dann lohnt sich das Einlesen der Pegel).
+ */
+template <uint8_t... Pins>
+static inline bool debouncerTickDue(const DebouncerBank<Pins...> &b, uint32_t nowMs) {
+  return (nowMs - b.lastTickMs) >= DEBOUNCE_TICK_MS;
+}
+
+/**
+ * @brief true, solange weitere Ticks noetig sind (Pegelwechsel in der Entprellung).
+ *        Sonst reicht ein Pin-Interrupt fuer die naechste Flanke.
+ */
+template <uint8_t... Pins>
+static inline bool debouncerBusy(const DebouncerBank<Pins...> &b) {
+  return (b.cnt0 | b.cnt1) != 0;
+}
+
+/**
+ * @brief Langes Halten pruefen (einmalig je Druck, unterdrueckt dann den Short-Press).
+ * @return Bits der Tasten, deren Long-Press jetzt faellig wurde
+ */
+template <uint8_t... Pins>
+static inline uint32_t debouncerLongPress(DebouncerBank<Pins...> &b, uint32_t nowMs) {
+  uint32_t fired = 0;
+  for (uint32_t held = b.down & ~b.longFired; held; held &= held - 1) {
+    const uint8_t i = (uint8_t)__builtin_ctz(held);
+    if (nowMs - b.downMs[i] >= DEBOUNCE_LONGPRESS_MS) fired |= 1u << i;
+  }
+  b.longFired |= fired;
+  return fired;
+}
+
+/**
+ * @brief Millisekunden bis zum naechsten Long-Press (0xFFFFFFFF = keine Taste gehalten).
+ */
+template <uint8_t... Pins>
+static inline uint32_t debouncerLongPressDueMs(const DebouncerBank<Pins...> &b, uint32_t nowMs) {
+  uint32_t due = 0xFFFFFFFFUL;
+  for (uint32_t held = b.down & ~b.longFired; held; held &= held - 1) {
+    const uint32_t since = nowMs - b.downMs[__builtin_ctz(held)];
+    const uint32_t left = (since >= DEBOUNCE_LONGPRESS_MS) ? 0 : DEBOUNCE_LONGPRESS_MS - since;
+    if (left < due) due = left;
+  }
+  return due;
+}
+
+/**
+ * @brief Ein Tick: Pegel aller Tasten auswerten, Ereignisse liefern.
+ */
+template <uint8_t... Pins>
+static inline DebounceEvents debouncerUpdate(DebouncerBank<Pins...> &b, uint64_t levels, uint32_t nowMs) {
+  DebounceEvents ev = {0, 0};
+  b.lastTickMs = nowMs;
+
+  // Abweichung vom stabilen Zustand zaehlen, sonst Zaehler auf 0
+  const uint32_t delta = DebouncerBank<Pins...>::keysFromLevels(levels) ^ b.down;
+  const uint32_t toggle = delta & b.cnt0 & b.cnt1;   // Zaehler stand auf 3 => 4. Abweichung
+  b.cnt1 = (b.cnt1 ^ b.cnt0) & delta & ~toggle;
+  b.cnt0 = ~b.cnt0 & delta & ~toggle;
+
+  if (toggle) {
+    b.down ^= toggle;
+
+    // Losgelassen: Short nur, wenn kein Long-Press passiert ist
+    ev.press = toggle & ~b.down & ~b.longFired;
+    b.longFired &= ~toggle;
+
+    // Gedrueckt: Zeitpunkt fuer Long-Press merken
+    for (uint32_t pressed = toggle & b.down; pressed; pressed &= pressed - 1) {
+      b.downMs[__builtin_ctz(pressed)] = nowMs;
+    }
+  }
+
+  // Long-Press nur fuer gehaltene Tasten pruefen, die noch nicht gemeldet wurden
+  ev.longPress = debouncerLongPress(b, nowMs);
+
+  return ev;
+}
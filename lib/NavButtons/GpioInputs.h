@@ -0,0 +1,36 @@
+// lib/NavButtons/GpioInputs.h
+//
+// Pegel aller GPIOs mit einem Registerzugriff je Bank einlesen
+// (statt digitalRead() pro Pin).
+//
+// - ESP32: GPIO_IN_REG (GPIO 0..31), GPIO_IN1_REG (GPIO 32..39)
+// - Host:  nachgebildete Register aus lib/HostSim (hostGpioInReg)
+//
+// gpioReadInputs<Bank>() liest nur die Register, in denen die Bank Pins hat.
+
+#pragma once
+#include <stdint.h>
+
+#ifdef ESP32
+#include <soc/soc.h>        // REG_READ
+#include <soc/gpio_reg.h>   // GPIO_IN_REG, GPIO_IN1_REG
+
+static inline uint32_t gpioReadInLow()  { return REG_READ(GPIO_IN_REG); }
+static inline uint32_t gpioReadInHigh() { return REG_READ(GPIO_IN1_REG); }
+#else
+#include <HostSim.h>
+
+static inline uint32_t gpioReadInLow()  { return hostGpioInReg(0); }
+static inline uint32_t gpioReadInHigh() { return hostGpioInReg(1); }
+#endif
+
+/**
+ * @brief Pegelwort fuer eine DebouncerBank (Bit n = GPIO n, 1 = HIGH).
+ */
+template <typename Bank>
+static inline uint64_t gpioReadInputs() {
+  uint64_t levels = 0;
+  if (Bank::USES_LOW)  levels |= gpioReadInLow();
+  if (Bank::USES_HIGH) levels |= (uint64_t)gpioReadInHigh() << 32;
+  return levels;
+}
@@ -1,135 +1,150 @@
 // lib/NavButtons/NavButtons.cpp
 //
-// Zwei Navigationstaster (LEFT/RIGHT) mit:
+// Front-Panel-Taster (LEFT/RIGHT + Encoder-Taster, Pinliste FRONT_KEY_PINS) mit:
 // - INPUT_PULLUP (Taster gegen GND)
-// - Entprellung (Debounce)
+// - Entprellung (Debounce) aller Taster gemeinsam (Debouncer.h)
 // - Short-Press Event (bei Loslassen)
 // - Long-Press Event (einmalig nach Haltezeit)
 // - Garantie: Long-Press loest KEIN Short-Press aus
 //
+// Pro Tick (DEBOUNCE_TICK_MS) werden alle Pegel mit einem Registerzugriff je
+// GPIO-Bank gelesen (GpioInputs.h). Weitere Taster kosten damit praktisch nichts.
+// Ticks und Long-Press laufen ueber Timer (lib/TimerWheel): Ticks nur, solange
+// ein Pegel prellt, der Long-Press-Timer nur, solange eine Taste gehalten wird.
+// In Ruhe weckt ein Pin-Interrupt die Hauptschleife (EventLoop).
+//
 // Designziel:
-// - GUI und main.cpp sollen nur Events abfragen ("getLeftPressed()"),
+// - GUI und main.cpp sollen nur Events verarbeiten (Input-Queue, InputEvents.h),
 //   nicht selbst entprellen oder Timings verwalten.
 
 #include "NavButtons.h"
 #include <Arduino.h>
 #include <config.h>
 
-// --------------------
-// Tuning-Parameter
-// --------------------
-// Debounce: stabiler Zustand muss mindestens so lange unveraendert sein
-static const uint32_t BTN_DEBOUNCE_MS  = 30;
+#include <InputEvents.h>
+#include <EventLoop.h>
+#include <TimerWheel.h>
 
-// Long-Press: wenn Taste so lange gehalten wird, gibt es genau EIN Long-Event
-static const uint32_t BTN_LONGPRESS_MS = 700;
+#include "Debouncer.h"
+#include "GpioInputs.h"
 
 // --------------------
 // Interner Button-State
 // --------------------
-struct ButtonState {
-  int lastStable;         // letzter stabiler Zustand (HIGH/LOW)
-  int lastReading;        // letzter Rohwert von digitalRead()
-  uint32_t lastChangeMs;  // Zeitpunkt der letzten Rohwert-Aenderung
-
-  bool shortEvent;        // wird gesetzt, wenn Short-Press erkannt
-  bool longEvent;         // wird gesetzt, wenn Long-Press erkannt
+typedef DebouncerBank<FRONT_KEY_PINS> KeyBank;
 
-  uint32_t downMs;        // Zeitpunkt, wann stabil "pressed" erkannt wurde
-  bool longFired;         // damit Long-Press nur einmal feuert
+// Event-Quelle je Taste (gleiche Reihenfolge wie FRONT_KEY_PINS)
+static const uint8_t KEY_SOURCE[] = {
+  INPUT_SRC_ENC_BUTTON,
+  INPUT_SRC_LEFT,
+  INPUT_SRC_RIGHT
 };
 
-static ButtonState leftBtn;
-static ButtonState rightBtn;
+static_assert(sizeof(KEY_SOURCE) == KeyBank::COUNT, "KEY_SOURCE passt nicht zu FRONT_KEY_PINS");
+
+// Bitnummern in KeyBank (Reihenfolge in FRONT_KEY_PINS)
+enum : uint8_t { KEY_ENC = 0, KEY_LEFT = 1, KEY_RIGHT = 2 };
+
+static KeyBank keys;
+
+// Pegelwechsel seit dem letzten Tick (aus keyIsr): naechster Tick ist noetig,
+// auch wenn der Wechsel kurz nach einem Tick in Ruhe kam
+static volatile bool keyEdge = false;
+
+static Timer tickTimer;   // naechster Entprell-Tick
+static Timer longTimer;   // naechster Long-Press
 
 /**
- * @brief Initialisiert einen ButtonState und den zugehoerigen GPIO.
+ * @brief Gesetzte Bits als Events in die Input-Queue legen.
  */
-static void initOne(ButtonState &b, int pin) {
-  pinMode(pin, INPUT_PULLUP);
-
-  int r = digitalRead(pin);
-  b.lastReading = r;
-  b.lastStable = r;
-  b.lastChangeMs = millis();
+static void pushKeyEvents(uint32_t bits, uint8_t type, uint32_t us) {
+  for (; bits; bits &= bits - 1) {
+    inputPush(KEY_SOURCE[__builtin_ctz(bits)], type, us, 0);
+  }
+}
 
-  b.shortEvent = false;
-  b.longEvent = false;
+/**
+ * @brief Pegelwechsel an einem Taster: Hauptschleife wecken (Entprellung laeuft dort).
+ */
+static void IRAM_ATTR keyIsr() {
+  keyEdge = true;
+  eventLoopSignal();
+}
 
-  b.downMs = 0;
-  b.longFired = false;
+/**
+ * @brief Long-Press-Timer auf die naechste gehaltene Taste stellen (oder stoppen).
+ */
+static void armLongPress(uint32_t now) {
+  const uint32_t due = debouncerLongPressDueMs(keys, now);
+  if (due == 0xFFFFFFFFUL) timerCancel(longTimer);
+  else timerArm(longTimer, now, due);
 }
 
 /**
- * @brief Aktualisiert einen Button (Debounce + Event-Generierung).
+ * @brief Entprell-Tick: Pegel aller Taster auswerten, Events erzeugen.
  *
  * Logik (wichtig):
  * - Short-Press wird beim LOSLASSEN erzeugt, aber nur wenn kein Long-Press war.
  * - Long-Press wird erzeugt, sobald die Taste lange genug gehalten wird (einmalig).
  */
-static void updateOne(ButtonState &b, int pin) {
-  int r = digitalRead(pin);
-
-  // Rohwert-Aenderung merken
-  if (r != b.lastReading) {
-    b.lastReading = r;
-    b.lastChangeMs = millis();
-  }
-
-  // Nach Debounce-Zeit: stabilen Zustand uebernehmen
-  if ((millis() - b.lastChangeMs) > BTN_DEBOUNCE_MS) {
-    if (b.lastStable != b.lastReading) {
-      b.lastStable = b.lastReading;
-
-      if (b.lastStable == LOW) {
-        // Taste wurde stabil gedrueckt
-        b.downMs = millis();
-        b.longFired = false;
-      } else {
-        // Taste wurde stabil losgelassen
-        // -> Short nur, wenn kein Long-Press passiert ist
-        if (b.downMs != 0 && !b.longFired) {
-          b.shortEvent = true;
-        }
-        b.downMs = 0;
-        b.longFired = false;
-      }
-    }
+static void debounceTick(void*) {
+  const uint32_t now = millis();
+
+  keyEdge = false;
+  const DebounceEvents ev = debouncerUpdate(keys, gpioReadInputs<KeyBank>(), now);
+  if (ev.press | ev.longPress) {
+    const uint32_t us = micros();
+    pushKeyEvents(ev.longPress, INPUT_LONG_PRESS, us);
+    pushKeyEvents(ev.press, INPUT_PRESS, us);
   }
 
-  // Long-Press pruefen, solange gedrueckt
-  if (b.lastStable == LOW && b.downMs != 0 && !b.longFired) {
-    if (millis() - b.downMs >= BTN_LONGPRESS_MS) {
-      b.longFired = true;
-      b.longEvent = true;   // Wichtig: dadurch wird spaeter KEIN Short-Press erzeugt
-    }
-  }
+  // Weiter ticken, solange ein Pegel prellt; sonst weckt die naechste Flanke
+  if (debouncerBusy(keys)) timerArm(tickTimer, now, DEBOUNCE_TICK_MS);
+  armLongPress(now);
 }
 
 /**
- * @brief "Consume" eines Event-Flags: gibt aktuellen Wert zurueck und setzt Flag auf false.
+ * @brief Long-Press faellig: ohne neuen Tick melden (Pegel ist stabil).
  */
-static bool take(bool &flag) {
-  bool v = flag;
-  flag = false;
-  return v;
+static void longPressDue(void*) {
+  const uint32_t now = millis();
+  pushKeyEvents(debouncerLongPress(keys, now), INPUT_LONG_PRESS, micros());
+  armLongPress(now);
 }
 
 void initNavButtons() {
-  initOne(leftBtn,  BTN_LEFT);
-  initOne(rightBtn, BTN_RIGHT);
+  const uint8_t pins[] = { FRONT_KEY_PINS };
+  for (uint8_t pin : pins) {
+    pinMode(pin, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(pin), keyIsr, CHANGE);
+  }
+
+  timerInit(tickTimer, debounceTick, nullptr);
+  timerInit(longTimer, longPressDue, nullptr);
+  debouncerInit(keys, gpioReadInputs<KeyBank>(), millis());
 }
 
+/**
+ * @brief Flanke aus der ISR in einen Entprell-Tick umsetzen
+ *        (sofort, wenn der letzte Tick lange genug her ist, sonst per Timer).
+ */
 void updateNavButtons() {
-  updateOne(leftBtn,  BTN_LEFT);
-  updateOne(rightBtn, BTN_RIGHT);
-}
+  if (!keyEdge || timerArmed(tickTimer)) return;
 
-bool getLeftPressed()       { return take(leftBtn.shortEvent); }
-bool getRightPressed()      { return take(rightBtn.shortEvent); }
+  const uint32_t now = millis();
+  if (debouncerTickDue(keys, now)) debounceTick(nullptr);
+  else timerArm(tickTimer, now, DEBOUNCE_TICK_MS - (now - keys.lastTickMs));
+}
 
-bool getLeftLongPressed()   { return take(leftBtn.longEvent); }
-bool getRightLongPressed()  { return take(rightBtn.longEvent); }
+/**
+ * @brief Pegel neu einlesen, als waere eine Flanke gekommen.
+ *
+ * Nach dem Light Sleep: der Tastendruck, der geweckt hat, kam ohne keyIsr().
+ */
+void resyncNavButtons() {
+  keyEdge = true;
+}
 
-bool isLeftDown()           { return (leftBtn.lastStable == LOW); }
-bool isRightDown()          { return (rightBtn.lastStable == LOW); }
+bool isLeftDown()           { return (keys.down >> KEY_LEFT) & 1u; }
+bool isRightDown()          { return (keys.down >> KEY_RIGHT) & 1u; }
+bool isEncoderButtonDown()  { return (keys.down >> KEY_ENC) & 1u; }
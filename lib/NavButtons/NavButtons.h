@@ -2,17 +2,22 @@
 #include <Arduino.h>
 #include <stdint.h>
 
+// Initialisieren (alle Front-Panel-Taster aus FRONT_KEY_PINS, config.h)
 void initNavButtons();
-void updateNavButtons();
 
-// Short Press (nur wenn KEIN Long-Press)
-bool getLeftPressed();
-bool getRightPressed();
+// Muss zyklisch in loop() aufgerufen werden (setzt Taster-Interrupts in Entprell-
+// Ticks um); Ticks und Long-Press laufen als Timer (TimerWheel.h, timerRun()).
+// Erzeugt Events in der Input-Queue (InputEvents.h),
+// Quelle INPUT_SRC_LEFT / INPUT_SRC_RIGHT / INPUT_SRC_ENC_BUTTON:
+//   INPUT_PRESS      : Short Press (nur wenn KEIN Long-Press)
+//   INPUT_LONG_PRESS : Long Press (einmalig nach Haltezeit)
+void updateNavButtons();
 
-// Long Press (einmalig nach Haltezeit)
-bool getLeftLongPressed();
-bool getRightLongPressed();
+// Nach dem Light Sleep: Taster-ISR lief nicht => Pegel beim naechsten
+// updateNavButtons() neu entprellen, als waere eine Flanke gekommen
+void resyncNavButtons();
 
 // Optional: aktueller stabiler Zustand
 bool isLeftDown();
 bool isRightDown();
+bool isEncoderButtonDown();
@@ -0,0 +1,110 @@
+// lib/NetMux/NetMux.cpp
+//
+// Socket-Multiplexer (siehe NetMux.h).
+//
+// Je Platz eine Generation: Abmelden/Anmelden zaehlt sie hoch. netMuxPoll()
+// merkt sich vor dem poll(), welche Generation es abgefragt hat, und ruft nur
+// auf, wenn sie noch stimmt (Rueckrufe schliessen/oeffnen Sockets).
+
+#include "NetMux.h"
+
+#ifdef ESP32
+#include <lwip/sockets.h>
+#endif
+#include <sys/poll.h>
+
+struct NetMuxSlot {
+  int fd;
+  uint8_t interest;
+  uint8_t gen;
+  NetMuxFn fn;   // nullptr = frei
+  void* arg;
+};
+
+static NetMuxSlot slots[NET_MUX_SLOTS];
+static NetMuxStats stats = {};
+
+int8_t netMuxAdd(int fd, uint8_t interest, NetMuxFn fn, void* arg) {
+  if (fd < 0 || !fn) return -1;
+
+  for (uint8_t i = 0; i < NET_MUX_SLOTS; i++) {
+    NetMuxSlot &s = slots[i];
+    if (s.fn) continue;
+
+    s.fd = fd;
+    s.interest = interest;
+    s.gen++;
+    s.fn = fn;
+    s.arg = arg;
+
+    stats.sockets++;
+    if (stats.sockets > stats.maxSockets) stats.maxSockets = stats.sockets;
+    return (int8_t)i;
+  }
+  return -1;
+}
+
+void netMuxInterest(int8_t slot, uint8_t interest) {
+  if (slot < 0 || slot >= NET_MUX_SLOTS) return;
+  slots[slot].interest = interest;
+}
+
+void netMuxRemove(int8_t slot) {
+  if (slot < 0 || slot >= NET_MUX_SLOTS || !slots[slot].fn) return;
+  slots[slot].fn = nullptr;
+  slots[slot].gen++;
+  stats.sockets--;
+}
+
+uint8_t netMuxPoll() {
+  if (stats.sockets == 0) return 0;
+
+  // Dichte Liste der belegten Plaetze (poll() auf lwIP kennt keine Luecken mit fd < 0)
+  struct pollfd fds[NET_MUX_SLOTS];
+  uint8_t slotOf[NET_MUX_SLOTS];
+  uint8_t genOf[NET_MUX_SLOTS];
+  uint8_t n = 0;
+
+  for (uint8_t i = 0; i < NET_MUX_SLOTS; i++) {
+    const NetMuxSlot &s = slots[i];
+    if (!s.fn) continue;
+
+    short events = 0;
+    if (s.interest & NET_MUX_READ) events |= POLLIN;
+    if (s.interest & NET_MUX_WRITE) events |= POLLOUT;
+    fds[n].fd = s.fd;
+    fds[n].events = events;
+    fds[n].revents = 0;
+    slotOf[n] = i;
+    genOf[n] = s.gen;
+    n++;
+  }
+
+  stats.polls++;
+  const int r = poll(fds, n, 0);
+  if (r <= 0) return 0;
+  stats.ready += (uint32_t)r;
+
+  uint8_t calls = 0;
+  for (uint8_t k = 0; k < n; k++) {
+    const short re = fds[k].revents;
+    if (re == 0) continue;
+
+    const NetMuxSlot &s = slots[slotOf[k]];
+    if (!s.fn || s.gen != genOf[k]) continue;   // inzwischen abgemeldet/neu belegt
+
+    uint8_t ready = 0;
+    if (re & POLLIN) ready |= NET_MUX_READ;
+    if (re & POLLOUT) ready |= NET_MUX_WRITE;
+    if (re & (POLLERR | POLLHUP | POLLNVAL)) ready |= NET_MUX_ERROR;
+
+    s.fn(ready, s.arg);
+    calls++;
+  }
+  stats.dispatched += calls;
+  return calls;
+}
+
+NetMuxStats netMuxStats() {
+  return stats;
+}
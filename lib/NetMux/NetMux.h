@@ -0,0 +1,68 @@
+// lib/NetMux/NetMux.h
+//
+// Ein poll() fuer alle TCP-Verbindungen (Steuerung + Telemetrie aller Radios).
+//
+// Idee:
+// - Module melden ihre Sockets mit Interesse (lesen/schreiben) und Rueckruf an
+//   (lib/RadioTCP, lib/RadioTelemetry, lib/WebMirror).
+// - netMuxPoll() fragt alle Sockets in einem einzigen poll() ohne Warten ab und
+//   ruft nur die Rueckrufe der bereiten Sockets auf. Ohne Verkehr kostet ein
+//   Durchlauf genau einen Systemaufruf, egal wie viele Radios verbunden sind
+//   (statt je Socket ein recv()/poll(), das meist EAGAIN liefert).
+// - Feste Tabelle (NET_MUX_SLOTS), keine Allokation.
+// - Ein Rueckruf darf Sockets ab- und anmelden; ein Platz, der im selben
+//   Durchlauf neu belegt wurde, bekommt die alte Bereitschaft nicht gemeldet.
+//
+// Nicht thread-sicher: alle Aufrufe aus demselben Kontext wie radioPoll()
+// (loop() bzw. mit GUI_TASKS der Netz-Task).
+
+#pragma once
+#include <stdint.h>
+
+// Plaetze: je Radio Steuerung + Telemetrie (2 * RADIO_MAX, include/radio_config.h),
+// Web-Spiegel: Listener + WEB_CLIENTS_MAX (include/web_config.h)
+#ifndef NET_MUX_SLOTS
+#define NET_MUX_SLOTS 24
+#endif
+
+// Interesse bzw. Bereitschaft (Bitmaske)
+enum NetMuxEvent : uint8_t {
+  NET_MUX_READ  = 1 << 0,   // Daten da (bzw. Gegenstelle hat geschlossen)
+  NET_MUX_WRITE = 1 << 1,   // beschreibbar (auch: Verbindungsaufbau fertig)
+  NET_MUX_ERROR = 1 << 2    // nur Bereitschaft: Fehler/aufgelegt, immer gemeldet
+};
+
+/**
+ * @brief Rueckruf fuer einen bereiten Socket.
+ * @param ready  NetMuxEvent-Bits
+ */
+typedef void (*NetMuxFn)(uint8_t ready, void* arg);
+
+struct NetMuxStats {
+  uint32_t polls;        // poll()-Aufrufe
+  uint32_t ready;        // gemeldete bereite Sockets (Summe)
+  uint32_t dispatched;   // Rueckrufe
+  uint8_t sockets;       // derzeit angemeldet
+  uint8_t maxSockets;    // hoechstens gleichzeitig angemeldet
+};
+
+/**
+ * @brief Socket anmelden.
+ * @param interest  NET_MUX_READ / NET_MUX_WRITE
+ * @return Platz (fuer netMuxInterest/netMuxRemove) oder -1 = Tabelle voll
+ */
+int8_t netMuxAdd(int fd, uint8_t interest, NetMuxFn fn, void* arg);
+
+// Interesse aendern (z.B. WRITE nur, solange ungesendete Bytes warten)
+void netMuxInterest(int8_t slot, uint8_t interest);
+
+// Abmelden (-1 wird ignoriert); den Socket schliesst der Aufrufer
+void netMuxRemove(int8_t slot);
+
+/**
+ * @brief Alle angemeldeten Sockets abfragen (ohne Warten), Rueckrufe der bereiten aufrufen.
+ * @return Anzahl Rueckrufe
+ */
+uint8_t netMuxPoll();
+
+NetMuxStats netMuxStats();
@@ -0,0 +1,196 @@
+// lib/RadioCodec/RadioCodec.cpp
+//
+// Kommando-Encoder und inkrementeller Antwort-Parser (siehe RadioCodec.h).
+
+#include "RadioCodec.h"
+
+#include <string.h>
+
+static const char PARAM_NAME[RADIO_PARAM_COUNT][3] = { { 'F', 'R', 'Q' }, { 'M', 'O', 'D' }, { 'P', 'W', 'R' } };
+
+// Parser-Zustaende
+enum : uint8_t {
+  P_SEQ = 0,     // Ziffern der Sequenznummer
+  P_STATUS,      // "OK" bzw. "ERR"
+  P_VALUE,       // Wert nach "OK " (Vorzeichen, Ziffern)
+  P_TEXT         // Fehlertext nach "ERR ", wird ueberlesen
+};
+
+// --------------------
+// Encoder
+// --------------------
+
+/**
+ * @brief Dezimalzahl rueckwaerts ab end schreiben. @return Anfang der Ziffern
+ */
+static char* putDigitsRev(char* end, uint32_t u) {
+  do {
+    *--end = (char)('0' + u % 10);
+    u /= 10;
+  } while (u);
+  return end;
+}
+
+/**
+ * @brief "<seq> <verb> <name>" vor p setzen (p zeigt auf den bereits gebauten Rest).
+ */
+static char* putHeadRev(char* p, uint16_t seq, const char verb[5], RadioParam param) {
+  p -= 3;
+  memcpy(p, PARAM_NAME[param], 3);
+  p -= 5;
+  memcpy(p, verb, 5);
+  return putDigitsRev(p, seq);
+}
+
+/**
+ * @brief Fertige Zeile [p, end) nach out kopieren, wenn sie passt.
+ */
+static uint8_t emit(uint8_t* out, size_t cap, const char* p, const char* end) {
+  const uint8_t len = (uint8_t)(end - p);
+  if (len > cap) return 0;
+  memcpy(out, p, len);
+  return len;
+}
+
+uint8_t radioEncodeSet(uint8_t* out, size_t cap, uint16_t seq, RadioParam param, int32_t value) {
+  if (param >= RADIO_PARAM_COUNT) return 0;
+
+  // Zeile von hinten in einen Stapelpuffer bauen, dann in einem Stueck kopieren
+  char tmp[RADIO_CMD_MAX];
+  char* const end = tmp + sizeof(tmp);
+  char* p = end;
+
+  *--p = '\n';
+  const uint32_t u = (value < 0) ? 0u - (uint32_t)value : (uint32_t)value;
+  p = putDigitsRev(p, u);
+  if (value < 0) *--p = '-';
+  *--p = ' ';
+  p = putHeadRev(p, seq, " SET ", param);
+  return emit(out, cap, p, end);
+}
+
+uint8_t radioEncodeGet(uint8_t* out, size_t cap, uint16_t seq, RadioParam param) {
+  if (param >= RADIO_PARAM_COUNT) return 0;
+
+  char tmp[RADIO_CMD_MAX];
+  char* const end = tmp + sizeof(tmp);
+  char* p = end;
+
+  *--p = '\n';
+  p = putHeadRev(p, seq, " GET ", param);
+  return emit(out, cap, p, end);
+}
+
+// --------------------
+// Parser
+// --------------------
+
+void radioParserReset(RadioParser &p) {
+  p.state = P_SEQ;
+  p.lineLen = 0;
+  p.statusLen = 0;
+  p.bad = false;
+  p.neg = false;
+  p.digits = false;
+  p.seq = 0;
+  p.value = 0;
+  p.status[0] = p.status[1] = p.status[2] = 0;
+}
+
+/**
+ * @brief Zeilenende: Antwort bewerten, Parser fuer die naechste Zeile zuruecksetzen.
+ */
+static RadioParseResult endLine(RadioParser &p, RadioReply &reply) {
+  RadioParseResult r = RADIO_PARSE_ERROR;
+
+  if (!p.bad && p.state != P_SEQ) {
+    reply.seq = (uint16_t)p.seq;
+    reply.hasValue = false;
+    if (p.state == P_VALUE) {
+      if (p.digits) {
+        reply.ok = true;
+        reply.hasValue = true;
+        reply.value = (int32_t)(p.neg ? 0u - p.value : p.value);
+        r = RADIO_PARSE_REPLY;
+      }
+    } else if (p.state == P_TEXT) {
+      reply.ok = false;
+      r = RADIO_PARSE_REPLY;
+    } else if (p.statusLen == 2 && p.status[0] == 'O' && p.status[1] == 'K') {
+      reply.ok = true;
+      r = RADIO_PARSE_REPLY;
+    } else if (p.statusLen == 3 && memcmp(p.status, "ERR", 3) == 0) {
+      reply.ok = false;
+      r = RADIO_PARSE_REPLY;
+    }
+  }
+
+  radioParserReset(p);
+  return r;
+}
+
+RadioParseResult radioParse(RadioParser &p, const uint8_t* data, size_t len, size_t &used,
+                            RadioReply &reply) {
+  for (size_t i = 0; i < len; i++) {
+    const char ch = (char)data[i];
+    if (ch == '\n') {
+      used = i + 1;
+      return endLine(p, reply);
+    }
+    if (ch == '\r') continue;
+
+    // Ueberlange Zeile: Rest bis '\n' nur noch ueberlesen
+    if (p.lineLen >= RADIO_REPLY_MAX) {
+      p.bad = true;
+      continue;
+    }
+    p.lineLen++;
+    if (p.bad) continue;
+
+    switch (p.state) {
+      case P_SEQ:
+        if (ch >= '0' && ch <= '9') {
+          p.seq = p.seq * 10 + (uint32_t)(ch - '0');
+          if (p.seq > 0xFFFF) p.bad = true;
+        } else if (ch == ' ' && p.lineLen > 1) {
+          p.state = P_STATUS;
+        } else {
+          p.bad = true;
+        }
+        break;
+
+      case P_STATUS:
+        if (ch == ' ' && p.statusLen == 2 && p.status[0] == 'O' && p.status[1] == 'K') {
+          p.state = P_VALUE;
+        } else if (ch == ' ' && p.statusLen == 3 && memcmp(p.status, "ERR", 3) == 0) {
+          p.state = P_TEXT;
+        } else if (p.statusLen < 3 && ch != ' ') {
+          p.status[p.statusLen++] = ch;
+        } else {
+          p.bad = true;
+        }
+        break;
+
+      case P_VALUE:
+        if (ch == '-' && !p.neg && !p.digits) {
+          p.neg = true;
+        } else if (ch >= '0' && ch <= '9') {
+          // Betrag bis 2^31 - 1 bzw. 2^31 (negativ), darueber Protokollfehler
+          const uint32_t digit = (uint32_t)(ch - '0');
+          const uint32_t limit = p.neg ? 0x80000000u : 0x7FFFFFFFu;
+          if (p.value > (limit - digit) / 10) p.bad = true;
+          else p.value = p.value * 10 + digit;
+          p.digits = true;
+        } else {
+          p.bad = true;
+        }
+        break;
+
+      default:   // P_TEXT
+        break;
+    }
+  }
+
+  used = len;
+  return RADIO_PARSE_MORE;
+}
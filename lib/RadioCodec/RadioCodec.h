@@ -0,0 +1,88 @@
+// lib/RadioCodec/RadioCodec.h
+//
+// Kodierung der Radio-Kommandos und Dekodierung der Antworten (Protokoll siehe
+// include/radio_config.h), ohne Heap, String oder printf.
+//
+// - Encoder: schreibt "<seq> SET FRQ|MOD|PWR <wert>\n" bzw. "<seq> GET FRQ|MOD|PWR\n"
+//   in einen Puffer des Aufrufers. Passt die Zeile nicht ganz hinein, wird nichts
+//   geschrieben.
+// - Parser: Zustandsautomat Zeichen fuer Zeichen, ohne Zeilenpuffer. TCP liefert
+//   Antworten in beliebigen Stuecken; der Parser merkt sich den Stand zwischen
+//   zwei radioParse()-Aufrufen, eine Antwort darf also ueber Segmente verteilt sein.
+//
+// Wird von lib/RadioTCP benutzt; laeuft unveraendert auf dem Host
+// (Benchmark src/host/codec_bench.cpp, Fuzzer src/host/codec_fuzz.cpp).
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+enum RadioParam : uint8_t {
+  RADIO_FRQ = 0,           // Frequenz in Hz
+  RADIO_MOD,               // Index in GUI_MOD_LIST
+  RADIO_PWR,               // Index in GUI_PWR_LIST
+  RADIO_PARAM_COUNT
+};
+
+// Laengste Kommandozeile: 5 (seq) + 5 (" SET ") + 3 + 1 + 11 (int32) + 1 ('\n')
+static const uint8_t RADIO_CMD_MAX = 26;
+
+// Laengste zulaessige Antwortzeile (ohne '\n'), laengere gelten als Protokollfehler
+static const uint8_t RADIO_REPLY_MAX = 40;
+
+/**
+ * @brief SET-Kommando kodieren.
+ * @param out  Zielpuffer, cap Bytes frei (RADIO_CMD_MAX reicht immer)
+ * @return Laenge der Zeile inkl. '\n', 0 = passt nicht / ungueltiger Parameter
+ */
+uint8_t radioEncodeSet(uint8_t* out, size_t cap, uint16_t seq, RadioParam param, int32_t value);
+
+/**
+ * @brief GET-Kommando kodieren (Radio antwortet "<seq> OK <wert>").
+ * @return Laenge der Zeile inkl. '\n', 0 = passt nicht / ungueltiger Parameter
+ */
+uint8_t radioEncodeGet(uint8_t* out, size_t cap, uint16_t seq, RadioParam param);
+
+// Ergebnis von radioParse()
+enum RadioParseResult : uint8_t {
+  RADIO_PARSE_MORE = 0,    // Eingabe verbraucht, Antwort noch unvollstaendig
+  RADIO_PARSE_REPLY,       // vollstaendige Antwort in reply
+  RADIO_PARSE_ERROR        // Zeile passt nicht zum Protokoll (bis '\n' verworfen)
+};
+
+struct RadioReply {
+  uint16_t seq;
+  bool ok;                 // "OK" (true) oder "ERR ..." (false)
+  bool hasValue;           // "OK <wert>" (Antwort auf GET)
+  int32_t value;
+};
+
+// Zustand des Parsers zwischen zwei Segmenten (mit radioParserReset() anlegen)
+struct RadioParser {
+  uint8_t state;
+  uint8_t lineLen;
+  uint8_t statusLen;
+  char status[3];
+  bool bad;
+  bool neg;                // Wert nach "OK " ist negativ
+  bool digits;             // Wert hat mindestens eine Ziffer
+  uint32_t seq;
+  uint32_t value;          // Betrag des Werts
+};
+
+void radioParserReset(RadioParser &p);
+
+/**
+ * @brief Bytes einlesen, bis eine Antwort vollstaendig ist oder die Eingabe endet.
+ * @param used  verbrauchte Bytes (Rest beim naechsten Aufruf erneut uebergeben)
+ *
+ * Typische Schleife:
+ *   size_t pos = 0, used;
+ *   while (pos < n) {
+ *     const RadioParseResult r = radioParse(p, buf + pos, n - pos, used, reply);
+ *     pos += used;
+ *     if (r == RADIO_PARSE_REPLY) ...;
+ *   }
+ */
+RadioParseResult radioParse(RadioParser &p, const uint8_t* data, size_t len, size_t &used,
+                            RadioReply &reply);
@@ -0,0 +1,515 @@
+// lib/RadioStandIn/RadioStandIn.cpp
+//
+// Loopback-Stand-in fuer das Radio (siehe RadioStandIn.h), POSIX-Sockets + std::thread.
+//
+// Antworten laufen ueber eine Ausgangsliste mit Faelligkeitszeit je Stueck:
+// Latenz/Jitter/Teilsegmente verzoegern nur das Senden, gelesen wird weiter
+// (Pipeline des Clients bleibt gefuellt). Telemetrie-Zeilen ebenso.
+// Alle Radios (Steuer- + Telemetrie-Port) laufen in einem Thread mit einem
+// ppoll() ueber alle Sockets; gesendet wird nicht blockierend.
+
+#ifndef ARDUINO
+
+#include "RadioStandIn.h"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <errno.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+
+static const char* const PARAM_NAME[3] = { "FRQ", "MOD", "PWR" };
+
+// Vorwaertsleistung je PWR-Index (LOW/MED/HIGH) in 0.1 W
+static const int32_t FWD_BY_PWR_DW[3] = { 50, 200, 500 };
+
+// Telemetrie-Stuecke, die hoechstens auf einen langsamen Client warten
+static const size_t TLM_BACKLOG_MAX = 256;
+
+// Antwort-Stueck, das ab dueUs gesendet werden darf
+struct OutChunk {
+  uint64_t dueUs;
+  std::string bytes;
+};
+
+// Ein Radio: Steuer- und Telemetrie-Port mit je hoechstens einem Client
+struct Unit {
+  int listenFd = -1;
+  uint16_t port = 0;
+  int client = -1;
+  char line[128];
+  size_t lineLen = 0;
+  std::deque<OutChunk> out;
+  uint64_t lastDueUs = 0;
+  std::atomic<bool> dropRequested{false};
+
+  int tlmListenFd = -1;
+  uint16_t tlmPort = 0;
+  int tlmClient = -1;
+  std::deque<OutChunk> tlmOut;
+  uint64_t tlmNextUs = 0;
+  uint32_t tlmN = 0;
+
+  StandInState state = {};   // unter stateMutex
+};
+
+static Unit units[STANDIN_RADIOS_MAX];
+static uint8_t unitCount = 0;
+
+static std::thread worker;
+static std::atomic<bool> running(false);
+static std::mutex stateMutex;
+
+// Vor dem Start gesetzt, danach nur gelesen
+static StandInOptions options;
+
+// Nur im Server-Thread benutzt
+static std::mt19937 rng;
+static std::mt19937 tlmRng;
+
+static uint64_t nowUs() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Stuecke ab due einplanen, optional in Teilsegmente zerlegt (gap dazwischen).
+ * @return Faelligkeit des letzten Stuecks
+ */
+static uint64_t scheduleChunks(std::deque<OutChunk> &out, std::mt19937 &r, uint64_t due,
+                               const char* bytes, size_t len) {
+  size_t pos = 0;
+  while (pos < len) {
+    size_t n = len - pos;
+    if (options.segment_max && n > options.segment_max) n = 1 + r() % options.segment_max;
+    out.push_back(OutChunk{ due, std::string(bytes + pos, n) });
+    pos += n;
+    if (pos < len) due += options.segment_gap_us;
+  }
+  return due;
+}
+
+/**
+ * @brief Antwort einplanen: Latenz + Jitter, optional in Teilsegmente zerlegt.
+ *        Nie vor der vorherigen Antwort faellig (Reihenfolge bleibt).
+ */
+static void scheduleReply(Unit &u, const char* reply, size_t len) {
+  uint64_t due = nowUs() + options.latency_us;
+  if (options.jitter_us) due += rng() % (options.jitter_us + 1);
+  if (due < u.lastDueUs) due = u.lastDueUs;
+  u.lastDueUs = scheduleChunks(u.out, rng, due, reply, len);
+}
+
+/**
+ * @brief Eine Kommandozeile auswerten, Antwort nach reply schreiben.
+ * @return Laenge der Antwort
+ */
+static int handleLine(StandInState &state, const char* line, char* reply, size_t replySize) {
+  char seq[12] = {0};
+  char verb[8] = {0};
+  char name[8] = {0};
+  long value = 0;
+  const int n = sscanf(line, "%11s %7s %7s %ld", seq, verb, name, &value);
+
+  std::lock_guard<std::mutex> lock(stateMutex);
+  state.commands++;
+
+  for (uint8_t p = 0; p < 3 && n >= 3; p++) {
+    if (strcmp(name, PARAM_NAME[p]) != 0) continue;
+
+    if (n == 4 && strcmp(verb, "SET") == 0) {
+      state.value[p] = (int32_t)value;
+      return snprintf(reply, replySize, "%s OK\n", seq);
+    }
+    if (n == 3 && strcmp(verb, "GET") == 0) {
+      state.reads++;
+      return snprintf(reply, replySize, "%s OK %ld\n", seq, (long)state.value[p]);
+    }
+  }
+
+  state.rejected++;
+  return snprintf(reply, replySize, "%s ERR syntax\n", seq[0] ? seq : "0");
+}
+
+static void closeClient(Unit &u) {
+  if (u.client >= 0) close(u.client);
+  u.client = -1;
+  u.out.clear();
+}
+
+static void closeTelemetry(Unit &u) {
+  if (u.tlmClient >= 0) close(u.tlmClient);
+  u.tlmClient = -1;
+  u.tlmOut.clear();
+}
+
+static int acceptClient(int listenFd) {
+  const int fd = accept(listenFd, nullptr, nullptr);
+  if (fd < 0) return -1;
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));   // Teilsegmente einzeln
+  return fd;
+}
+
+/**
+ * @brief Empfangene Bytes des Steuer-Clients zeilenweise abarbeiten.
+ */
+static void receiveCommands(Unit &u) {
+  char buf[512];
+  const ssize_t n = recv(u.client, buf, sizeof(buf), MSG_DONTWAIT);
+  if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+    closeClient(u);
+    return;
+  }
+
+  for (ssize_t i = 0; i < n; i++) {
+    if (buf[i] != '\n') {
+      if (u.lineLen < sizeof(u.line) - 1) u.line[u.lineLen++] = buf[i];
+      continue;
+    }
+    u.line[u.lineLen] = '\0';
+    u.lineLen = 0;
+
+    char reply[64];
+    const int len = handleLine(u.state, u.line, reply, sizeof(reply));
+
+    // Abbruch nach jedem n-ten Kommando: ausgefuehrt, aber ohne Antwort
+    bool drop = false;
+    {
+      std::lock_guard<std::mutex> lock(stateMutex);
+      if (options.drop_every && u.state.commands % options.drop_every == 0) {
+        u.state.drops++;
+        drop = true;
+      }
+    }
+    if (drop) {
+      closeClient(u);
+      return;
+    }
+    scheduleReply(u, reply, (size_t)len);
+  }
+}
+
+/**
+ * @brief Faellige Stuecke senden, jedes mit eigenem send() (eigenes Segment).
+ *        Nicht blockierend: ein Rest bleibt vorn stehen.
+ * @return false = Verbindung kaputt
+ */
+static bool sendDue(int fd, std::deque<OutChunk> &out, uint64_t now, uint32_t &sends) {
+  while (!out.empty() && out.front().dueUs <= now) {
+    std::string &b = out.front().bytes;
+    const ssize_t n = send(fd, b.data(), b.size(), MSG_NOSIGNAL | MSG_DONTWAIT);
+    if (n < 0) return errno == EAGAIN || errno == EWOULDBLOCK;
+    sends++;
+    if ((size_t)n < b.size()) {
+      b.erase(0, (size_t)n);
+      return true;
+    }
+    out.pop_front();
+  }
+  return true;
+}
+
+/**
+ * @brief Dreieck lo..hi..lo ueber period Rahmen.
+ */
+static int32_t triangle(uint32_t n, uint32_t period, int32_t lo, int32_t hi) {
+  const uint32_t half = period / 2;
+  const uint32_t p = n % period;
+  const uint32_t k = (p < half) ? p : period - p;
+  return lo + (int32_t)((int64_t)(hi - lo) * k / half);
+}
+
+/**
+ * @brief Telemetrie-Zeile Nummer n: S ueber 2 s, SWR ueber 3 s (bei 20 Hz), FWD aus PWR.
+ */
+static int formatTelemetry(const Unit &u, uint32_t n, char* out, size_t size) {
+  int32_t pwr;
+  {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    pwr = u.state.value[2];
+  }
+  const int32_t fwd = (pwr >= 0 && pwr < 3) ? FWD_BY_PWR_DW[pwr] : 0;
+  return snprintf(out, size, "TLM S=%ld SWR=%ld FWD=%ld\n", (long)triangle(n, 40, -127, -33),
+                  (long)triangle(n, 60, 100, 300), (long)fwd);
+}
+
+/**
+ * @brief Faellige Telemetrie-Zeilen einplanen (telemetry_hz Zeilen/s), stueckweise
+ *        wie die Antworten (Zeilen ueber Segment- und Ringgrenzen).
+ */
+static void produceTelemetry(Unit &u, uint64_t now) {
+  const uint64_t periodUs = 1000000ULL / options.telemetry_hz;
+
+  while (u.tlmNextUs <= now) {
+    const uint64_t due = u.tlmNextUs;
+    u.tlmNextUs += periodUs;
+    if (u.tlmOut.size() > TLM_BACKLOG_MAX) continue;   // Client liest nicht: Zeile faellt aus
+
+    char line[64];
+    const size_t len = (size_t)formatTelemetry(u, u.tlmN++, line, sizeof(line));
+    scheduleChunks(u.tlmOut, tlmRng, due, line, len);
+
+    std::lock_guard<std::mutex> lock(stateMutex);
+    u.state.tlmFrames++;
+  }
+}
+
+/**
+ * @brief Lauschenden Socket oeffnen.
+ * @param port  0 = frei waehlen, bound = tatsaechlicher Port
+ * @return Deskriptor oder -1
+ */
+static int openListener(uint16_t port, bool any, uint16_t &bound) {
+  const int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) return -1;
+
+  int one = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(any ? INADDR_ANY : INADDR_LOOPBACK);
+  socklen_t len = sizeof(addr);
+  if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(fd, 1) < 0 ||
+      getsockname(fd, (struct sockaddr*)&addr, &len) < 0) {
+    close(fd);
+    return -1;
+  }
+  bound = ntohs(addr.sin_port);
+  return fd;
+}
+
+static void closeListeners() {
+  for (Unit &u : units) {
+    if (u.listenFd >= 0) close(u.listenFd);
+    if (u.tlmListenFd >= 0) close(u.tlmListenFd);
+    u.listenFd = u.tlmListenFd = -1;
+    u.port = u.tlmPort = 0;
+  }
+}
+
+// Rolle eines Eintrags in der poll()-Liste
+enum PollRole : uint8_t { ROLE_LISTEN, ROLE_CLIENT, ROLE_TLM_LISTEN, ROLE_TLM_CLIENT };
+
+/**
+ * @brief Alle Radios in einem Thread: ein ppoll() ueber alle Sockets, dann
+ *        Eingaben abarbeiten und faellige Stuecke senden.
+ *
+ * Je Port wird entweder der lauschende Socket (kein Client) oder der Client
+ * abgefragt: weitere Verbindungen warten im Backlog, bis der Client weg ist.
+ */
+static void serverLoop() {
+  struct pollfd fds[STANDIN_RADIOS_MAX * 2];
+  uint8_t unitOf[STANDIN_RADIOS_MAX * 2];
+  uint8_t roleOf[STANDIN_RADIOS_MAX * 2];
+
+  while (running.load()) {
+    // Warten bis Eingabe oder naechstes faelliges Stueck (hoechstens 10 ms)
+    const uint64_t start = nowUs();
+    uint64_t wakeUs = start + 10000;
+    nfds_t n = 0;
+
+    for (uint8_t i = 0; i < unitCount; i++) {
+      Unit &u = units[i];
+      if (u.dropRequested.exchange(false)) closeClient(u);
+
+      fds[n] = { u.client >= 0 ? u.client : u.listenFd, POLLIN, 0 };
+      unitOf[n] = i;
+      roleOf[n++] = u.client >= 0 ? ROLE_CLIENT : ROLE_LISTEN;
+      if (!u.out.empty() && u.out.front().dueUs < wakeUs) wakeUs = u.out.front().dueUs;
+
+      if (u.tlmListenFd < 0) continue;
+      fds[n] = { u.tlmClient >= 0 ? u.tlmClient : u.tlmListenFd, POLLIN, 0 };
+      unitOf[n] = i;
+      roleOf[n++] = u.tlmClient >= 0 ? ROLE_TLM_CLIENT : ROLE_TLM_LISTEN;
+      if (u.tlmClient >= 0 && u.tlmNextUs < wakeUs) wakeUs = u.tlmNextUs;
+      if (!u.tlmOut.empty() && u.tlmOut.front().dueUs < wakeUs) wakeUs = u.tlmOut.front().dueUs;
+    }
+
+    const uint64_t waitUs = (wakeUs > start) ? wakeUs - start : 0;
+    const struct timespec ts = { 0, (long)(waitUs * 1000) };
+    const int ready = ppoll(fds, n, &ts, nullptr);
+    if (ready < 0 && errno != EINTR) break;
+
+    for (nfds_t k = 0; ready > 0 && k < n; k++) {
+      if (fds[k].revents == 0) continue;
+      Unit &u = units[unitOf[k]];
+
+      switch (roleOf[k]) {
+        case ROLE_LISTEN:
+          u.client = acceptClient(u.listenFd);
+          if (u.client < 0) break;
+          u.lineLen = 0;
+          u.lastDueUs = 0;
+          u.dropRequested.store(false);
+          {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            u.state.connections++;
+          }
+          break;
+
+        case ROLE_CLIENT:
+          if (u.client >= 0) receiveCommands(u);
+          break;
+
+        case ROLE_TLM_LISTEN:
+          u.tlmClient = acceptClient(u.tlmListenFd);
+          if (u.tlmClient < 0) break;
+          u.tlmNextUs = nowUs();
+          u.tlmN = 0;
+          {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            u.state.tlmConnections++;
+          }
+          break;
+
+        case ROLE_TLM_CLIENT: {
+          // Panel sendet nichts: nur Ende/Fehler erkennen
+          char buf[64];
+          const ssize_t r = recv(u.tlmClient, buf, sizeof(buf), MSG_DONTWAIT);
+          if (r == 0 || (r < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) closeTelemetry(u);
+          break;
+        }
+      }
+    }
+
+    const uint64_t now = nowUs();
+    for (uint8_t i = 0; i < unitCount; i++) {
+      Unit &u = units[i];
+      uint32_t sends = 0;
+
+      if (u.client >= 0 && !sendDue(u.client, u.out, now, sends)) closeClient(u);
+      if (u.tlmClient >= 0) {
+        produceTelemetry(u, now);
+        uint32_t tlmSends = 0;
+        if (!sendDue(u.tlmClient, u.tlmOut, now, tlmSends)) closeTelemetry(u);
+      }
+      if (sends) {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        u.state.segments += sends;
+      }
+    }
+  }
+
+  for (uint8_t i = 0; i < unitCount; i++) {
+    closeClient(units[i]);
+    closeTelemetry(units[i]);
+  }
+}
+
+bool standInParseArg(StandInOptions &opt, const char* arg) {
+  static const struct {
+    const char* name;
+    uint32_t StandInOptions::*field;
+  } NUMERIC[] = {
+    { "latency=", &StandInOptions::latency_us },
+    { "jitter=", &StandInOptions::jitter_us },
+    { "drop=", &StandInOptions::drop_every },
+    { "gap=", &StandInOptions::segment_gap_us },
+    { "seed=", &StandInOptions::seed },
+    { "telemetry=", &StandInOptions::telemetry_hz },
+    { "radios=", &StandInOptions::radios },
+  };
+
+  if (strcmp(arg, "any") == 0) {
+    opt.bind_any = true;
+    return true;
+  }
+  if (strncmp(arg, "segment=", 8) == 0) {
+    opt.segment_max = (uint16_t)strtoul(arg + 8, nullptr, 10);
+    return true;
+  }
+  for (const auto &o : NUMERIC) {
+    const size_t n = strlen(o.name);
+    if (strncmp(arg, o.name, n) == 0) {
+      opt.*o.field = (uint32_t)strtoul(arg + n, nullptr, 10);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool standInStart(uint16_t port, const StandInOptions &opt) {
+  standInStop();
+  options = opt;
+  rng.seed(opt.seed);
+  tlmRng.seed(opt.seed + 1);
+
+  unitCount = (uint8_t)((opt.radios == 0) ? 1 : (opt.radios < STANDIN_RADIOS_MAX) ? opt.radios
+                                                                                 : STANDIN_RADIOS_MAX);
+  for (uint8_t i = 0; i < unitCount; i++) {
+    Unit &u = units[i];
+    const uint16_t base = port ? (uint16_t)(port + 2 * i) : 0;
+
+    u.listenFd = openListener(base, opt.bind_any, u.port);
+    if (u.listenFd >= 0 && opt.telemetry_hz > 0) {
+      u.tlmListenFd = openListener(port ? (uint16_t)(base + 1) : 0, opt.bind_any, u.tlmPort);
+    }
+    if (u.listenFd < 0 || (opt.telemetry_hz > 0 && u.tlmListenFd < 0)) {
+      closeListeners();
+      unitCount = 0;
+      return false;
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(stateMutex);
+    for (Unit &u : units) u.state = StandInState{};
+  }
+  running.store(true);
+  worker = std::thread(serverLoop);
+  return true;
+}
+
+uint8_t standInRadios() {
+  return unitCount;
+}
+
+uint16_t standInPort(uint8_t radio) {
+  return (radio < unitCount) ? units[radio].port : 0;
+}
+
+uint16_t standInTelemetryPort(uint8_t radio) {
+  return (radio < unitCount) ? units[radio].tlmPort : 0;
+}
+
+void standInSetValue(uint8_t param, int32_t value, uint8_t radio) {
+  if (param >= 3 || radio >= unitCount) return;
+  std::lock_guard<std::mutex> lock(stateMutex);
+  units[radio].state.value[param] = value;
+}
+
+void standInDropConnection(uint8_t radio) {
+  if (radio >= unitCount) return;
+  units[radio].dropRequested.store(true);
+  std::lock_guard<std::mutex> lock(stateMutex);
+  units[radio].state.drops++;
+}
+
+void standInStop() {
+  if (!running.exchange(false)) return;
+  worker.join();
+  closeListeners();
+}
+
+StandInState standInState(uint8_t radio) {
+  std::lock_guard<std::mutex> lock(stateMutex);
+  return (radio < unitCount) ? units[radio].state : StandInState{};
+}
+
+#endif
@@ -0,0 +1,90 @@
+// lib/RadioStandIn/RadioStandIn.h
+//
+// Stand-in fuer den TCP-Steuerendpunkt des Radios (nur Host/Linux).
+//
+// - Lauscht auf 127.0.0.1 (bzw. allen Interfaces), bedient je Radio eine
+//   Verbindung nach der anderen; alle Sockets in einem Thread (ein poll())
+// - Mehrere Radios (radios=n, bis STANDIN_RADIOS_MAX): jedes mit eigenen Ports,
+//   eigenen Werten und eigenen Zaehlern (Index = Radio, wie RadioTCP)
+// - Versteht das Protokoll aus include/radio_config.h:
+//     "<seq> SET FRQ|MOD|PWR <wert>\n" => Wert uebernehmen, "<seq> OK\n"
+//     "<seq> GET FRQ|MOD|PWR\n"        => "<seq> OK <wert>\n"
+//     alles andere                     => "<seq> ERR <grund>\n"
+// - Zaehlt Kommandos und merkt sich den zuletzt gesetzten Wert je Parameter,
+//   damit Host-Tests den Endzustand des Radios pruefen koennen.
+// - standInSetValue() verstellt einen Wert "am Geraet" (ohne Kommando).
+// - Ports: Radio u lauscht auf port + 2u (bei Port 0 frei gewaehlt)
+// - Telemetrie (telemetry_hz > 0): zweiter Port je Radio (Steuerport + 1, bei
+//   Port 0 frei gewaehlt), sendet synthetische Zeilen "TLM S=.. SWR=.. FWD=..\n":
+//   S und SWR laufen als Dreieck durch ihren Bereich, FWD folgt dem gesetzten
+//   PWR-Index (LOW/MED/HIGH = 5/20/50 W).
+//
+// Stoerungen (StandInOptions), um das Netz eines echten Radios nachzubilden:
+// - Antwortlatenz + Jitter je Kommando (Reihenfolge der Antworten bleibt)
+// - Verbindungsabbruch nach jedem n-ten Kommando (ohne dessen Antwort)
+// - Antworten in Teilsegmenten (zufaellig 1..segment_max Bytes, mit Pause),
+//   Telemetrie-Zeilen ebenso
+
+#pragma once
+#include <stdint.h>
+
+// Max. Radios je Stand-in
+static const uint8_t STANDIN_RADIOS_MAX = 8;
+
+struct StandInOptions {
+  uint32_t latency_us = 0;       // Kommando empfangen -> Antwort faellig
+  uint32_t jitter_us = 0;        // + zufaellig 0..jitter_us
+  uint32_t drop_every = 0;       // Verbindung nach jedem n-ten Kommando trennen (0 = nie)
+  uint16_t segment_max = 0;      // Antworten in Stuecken von 1..segment_max Bytes (0 = am Stueck)
+  uint32_t segment_gap_us = 0;   // Pause zwischen zwei Stuecken
+  bool bind_any = false;         // auf allen Interfaces lauschen (echtes Panel im LAN)
+  uint32_t seed = 1;             // Zufall fuer Jitter/Stueckgroessen
+  uint32_t telemetry_hz = 0;     // Telemetrie-Zeilen pro Sekunde (0 = kein Telemetrie-Port)
+  uint32_t radios = 1;           // Anzahl Radios (1..STANDIN_RADIOS_MAX)
+};
+
+// Zustand je Radio
+struct StandInState {
+  uint32_t connections;    // angenommene Verbindungen
+  uint32_t commands;       // verarbeitete Zeilen
+  uint32_t rejected;       // davon mit ERR beantwortet
+  uint32_t reads;          // davon GET
+  uint32_t drops;          // per drop_every/standInDropConnection() getrennt
+  uint32_t segments;       // gesendete Antwort-Stuecke (send()-Aufrufe)
+  uint32_t tlmConnections; // angenommene Telemetrie-Verbindungen
+  uint32_t tlmFrames;      // gesendete Telemetrie-Zeilen
+  int32_t value[3];        // zuletzt gesetzt: FRQ, MOD, PWR (RadioParam-Reihenfolge)
+};
+
+/**
+ * @brief Eine Option als "name=wert" in opt uebernehmen (Kommandozeile der Host-Tools).
+ *
+ * latency=<us> jitter=<us> drop=<n> segment=<bytes> gap=<us> seed=<n> telemetry=<hz> radios=<n> any
+ * @return false = keine Stand-in-Option
+ */
+bool standInParseArg(StandInOptions &opt, const char* arg);
+
+/**
+ * @brief Server starten.
+ * @param port  Steuerport von Radio 0 (Radio u: port + 2u), 0 = freie Ports waehlen (standInPort())
+ * @return false, wenn ein Port nicht gebunden werden konnte
+ */
+bool standInStart(uint16_t port, const StandInOptions &opt = StandInOptions{});
+
+// Anzahl Radios (opt.radios, begrenzt)
+uint8_t standInRadios();
+
+uint16_t standInPort(uint8_t radio = 0);
+
+// Telemetrie-Port (0 = aus)
+uint16_t standInTelemetryPort(uint8_t radio = 0);
+
+// Wert am Radio verstellen (wie von anderer Stelle, Panel erfaehrt es per GET)
+void standInSetValue(uint8_t param, int32_t value, uint8_t radio = 0);
+
+// Aktuelle Verbindung eines Radios trennen (Verbindungsabbruch simulieren)
+void standInDropConnection(uint8_t radio = 0);
+
+void standInStop();
+
+StandInState standInState(uint8_t radio = 0);
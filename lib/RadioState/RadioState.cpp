@@ -0,0 +1,64 @@
+// lib/RadioState/RadioState.cpp
+//
+// Spiegel des Radio-Zustands (siehe RadioState.h).
+
+#include "RadioState.h"
+
+void radioMirrorClear(RadioMirror &m) {
+  for (uint8_t p = 0; p < RADIO_PARAM_COUNT; p++) m.param[p] = RadioParamState{};
+}
+
+bool radioMirrorSubscribe(RadioMirror &m, RadioChangeFn fn, void* arg) {
+  for (uint8_t i = 0; i < m.subscribers; i++) {
+    if (m.fn[i] == fn && m.arg[i] == arg) return true;
+  }
+  if (m.subscribers >= RADIO_STATE_SUBSCRIBERS) return false;
+
+  m.fn[m.subscribers] = fn;
+  m.arg[m.subscribers] = arg;
+  m.subscribers++;
+  return true;
+}
+
+bool radioMirrorSetDesired(RadioMirror &m, RadioParam param, int32_t value) {
+  if (param >= RADIO_PARAM_COUNT) return false;
+
+  RadioParamState &s = m.param[param];
+  if (s.desiredValid && s.desired == value) return false;
+
+  s.desired = value;
+  s.desiredValid = true;
+  s.desiredGen++;
+  return true;
+}
+
+void radioMirrorConfirm(RadioMirror &m, RadioParam param, int32_t value, bool adopt) {
+  if (param >= RADIO_PARAM_COUNT) return;
+
+  RadioParamState &s = m.param[param];
+
+  // Fremder Wert wird Sollwert, sonst wuerde er beim naechsten Senden ueberschrieben
+  bool external = false;
+  if (adopt && (!s.desiredValid || s.desired != value)) {
+    s.desired = value;
+    s.desiredValid = true;
+    s.desiredGen++;
+    external = true;
+  }
+
+  const bool changed = !s.confirmedValid || s.confirmed != value;
+  if (changed) {
+    s.confirmed = value;
+    s.confirmedValid = true;
+    s.confirmedGen++;
+  }
+  if (!changed && !external) return;
+
+  for (uint8_t i = 0; i < m.subscribers; i++) m.fn[i](param, value, external, m.arg[i]);
+}
+
+bool radioMirrorInSync(const RadioMirror &m, RadioParam param) {
+  if (param >= RADIO_PARAM_COUNT) return false;
+  const RadioParamState &s = m.param[param];
+  return s.desiredValid && s.confirmedValid && s.desired == s.confirmed;
+}
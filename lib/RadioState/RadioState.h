@@ -0,0 +1,68 @@
+// lib/RadioState/RadioState.h
+//
+// Spiegel des Radio-Zustands: je Parameter Sollwert (was das Panel will) und
+// bestaetigter Wert (was das Radio zuletzt quittiert bzw. gemeldet hat).
+//
+// - Generationszaehler je Parameter: desiredGen zaehlt jede Aenderung des
+//   Sollwerts, confirmedGen jede Aenderung des bestaetigten Werts. Wer sich eine
+//   Generation merkt, sieht ohne Vergleich der Werte, ob sich etwas getan hat.
+// - Abonnenten werden nur benachrichtigt, wenn sich ein bestaetigter Wert
+//   wirklich aendert (bzw. ein fremder Wert uebernommen wurde), nicht bei
+//   jeder Quittung.
+// - "Fremd" (external): das Radio meldet beim Zuruecklesen einen anderen Wert,
+//   ohne dass vom Panel noch etwas unterwegs ist (am Geraet oder von anderer
+//   Stelle verstellt, oder ein Sollwert wurde abgelehnt). Der Spiegel uebernimmt
+//   ihn dann auch als Sollwert, damit er nicht zurueckgeschrieben wird.
+//
+// Reine Datenhaltung ohne Netzwerk; Senden/Zuruecklesen macht lib/RadioTCP.
+// Nicht thread-sicher (Kontext wie RadioTCP).
+
+#pragma once
+#include <stdint.h>
+
+#include <RadioCodec.h>   // RadioParam
+
+// Max. Abonnenten je Spiegel
+static const uint8_t RADIO_STATE_SUBSCRIBERS = 4;
+
+struct RadioParamState {
+  int32_t desired;
+  int32_t confirmed;
+  uint32_t desiredGen;       // +1 je Aenderung von desired
+  uint32_t confirmedGen;     // +1 je Aenderung von confirmed
+  bool desiredValid;         // false = Panel hat noch keinen Wert vorgegeben
+  bool confirmedValid;       // false = vom Radio noch nichts bekannt
+};
+
+/**
+ * @brief Benachrichtigung bei geaendertem bestaetigtem Wert.
+ * @param external  true = Wert kam vom Radio (Zuruecklesen) und ist jetzt auch Sollwert
+ */
+typedef void (*RadioChangeFn)(RadioParam param, int32_t value, bool external, void* arg);
+
+struct RadioMirror {
+  RadioParamState param[RADIO_PARAM_COUNT];
+
+  RadioChangeFn fn[RADIO_STATE_SUBSCRIBERS];
+  void* arg[RADIO_STATE_SUBSCRIBERS];
+  uint8_t subscribers;
+};
+
+// Werte und Generationen loeschen (Abonnenten bleiben)
+void radioMirrorClear(RadioMirror &m);
+
+// Abonnent eintragen (doppelt eingetragen zaehlt einmal). false = kein Platz
+bool radioMirrorSubscribe(RadioMirror &m, RadioChangeFn fn, void* arg);
+
+// Neuer Sollwert. @return false, wenn er dem bisherigen entspricht
+bool radioMirrorSetDesired(RadioMirror &m, RadioParam param, int32_t value);
+
+/**
+ * @brief Wert vom Radio eintragen (Quittung eines SET oder Antwort auf GET).
+ * @param adopt  true = vom Panel ist fuer param nichts unterwegs; weicht der
+ *               Wert vom Sollwert ab, wird er als Sollwert uebernommen (external)
+ */
+void radioMirrorConfirm(RadioMirror &m, RadioParam param, int32_t value, bool adopt);
+
+// Sollwert == bestaetigter Wert (beide bekannt)
+bool radioMirrorInSync(const RadioMirror &m, RadioParam param);
@@ -0,0 +1,151 @@
+// lib/RadioTCP/RadioConn.cpp
+//
+// Gemeinsame Verbindungsverwaltung der Radio-Clients (siehe RadioConn.h).
+
+#include "RadioConn.h"
+
+#include <Arduino.h>
+
+#include <EventLoop.h>
+
+#include "RadioSocket.h"
+
+void radioNetInit(RadioNet &n) {
+  n.up = true;
+  n.upRequest = n.downRequest = false;
+}
+
+void radioNetRequest(RadioNet &n, bool up) {
+  // Nur vormerken; uebernommen wird im naechsten Poll des Clients
+  if (up) n.upRequest = true;
+  else n.downRequest = true;
+  eventLoopSignal();
+}
+
+uint8_t radioNetTake(RadioNet &n) {
+  uint8_t ev = 0;
+  if (n.downRequest) {
+    n.downRequest = false;
+    n.up = false;
+    ev |= RADIO_NET_DOWN;
+  }
+  if (n.upRequest) {
+    n.upRequest = false;
+    n.up = true;
+    ev |= RADIO_NET_UP;
+  }
+  return ev;
+}
+
+static void setSleepInhibit(RadioConn &c, bool on) {
+  if (on == c.sleepInhibited) return;
+  c.sleepInhibited = on;
+  eventLoopInhibitSleep(on);
+}
+
+static void setState(RadioConn &c, uint8_t s) {
+  if (s == c.state) return;
+  c.state = s;
+  if (c.ops->onState) c.ops->onState(s, c.arg);
+}
+
+/**
+ * @brief Naechsten Verbindungsversuch planen (exponentieller Backoff mit Zufall).
+ */
+static void scheduleRetry(RadioConn &c) {
+  if (!c.net->up) return;   // kommt mit dem naechsten "up"
+
+  // +-12.5%: mehrere Panels/Radios nach Stromausfall nicht im Gleichschritt
+  const uint32_t spread = c.backoffMs / 4;
+  const uint32_t delay = c.backoffMs - spread / 2 + (spread ? micros() % (spread + 1) : 0);
+  timerArm(c.timer, millis(), delay);
+
+  const uint32_t maxMs = RADIO_CONFIG.retry_max_ms;
+  c.backoffMs = (c.backoffMs >= maxMs / 2) ? maxMs : c.backoffMs * 2;
+}
+
+void radioConnInit(RadioConn &c, const char* host, uint16_t port, RadioNet &net,
+                   const RadioConnOps* ops, void* arg, TimerFn timerFn) {
+  c.host = host;
+  c.port = port;
+  c.ops = ops;
+  c.arg = arg;
+  c.net = &net;
+  c.sock = -1;
+  c.muxSlot = -1;
+  c.state = RADIO_LINK_DOWN;
+  c.sleepInhibited = false;
+  c.backoffMs = RADIO_CONFIG.retry_ms;
+  c.failures = 0;
+  timerInit(c.timer, timerFn, arg);
+}
+
+void radioConnStart(RadioConn &c) {
+  if (c.port == 0) return;
+
+  c.sock = radioSockConnect(c.host, c.port);
+  if (c.sock >= 0) {
+    c.muxSlot = netMuxAdd(c.sock, NET_MUX_WRITE, c.ops->onSocket, c.arg);
+    if (c.muxSlot < 0) {
+      radioSockClose(c.sock);   // NET_MUX_SLOTS zu klein
+      c.sock = -1;
+    }
+  }
+  if (c.sock < 0) {
+    c.failures++;
+    scheduleRetry(c);
+    return;
+  }
+  setState(c, RADIO_LINK_CONNECTING);
+  setSleepInhibit(c, true);
+  timerArm(c.timer, millis(), RADIO_CONFIG.connect_timeout_ms);
+}
+
+void radioConnClose(RadioConn &c) {
+  if (c.ops->onClose) c.ops->onClose(c.arg);
+
+  netMuxRemove(c.muxSlot);
+  c.muxSlot = -1;
+  radioSockClose(c.sock);
+  c.sock = -1;
+  setSleepInhibit(c, false);
+
+  timerCancel(c.timer);
+  setState(c, RADIO_LINK_DOWN);
+}
+
+void radioConnFail(RadioConn &c) {
+  radioConnClose(c);
+  c.failures++;
+  scheduleRetry(c);
+}
+
+void radioConnTimer(RadioConn &c) {
+  if (c.state == RADIO_LINK_DOWN) radioConnStart(c);
+  else radioConnFail(c);   // Verbindungsaufbau zu langsam bzw. Timeout des Clients
+}
+
+bool radioConnFinish(RadioConn &c) {
+  if (!radioSockConnectOk(c.sock)) {
+    radioConnFail(c);
+    return false;
+  }
+  timerCancel(c.timer);
+  setState(c, RADIO_LINK_UP);
+  return true;
+}
+
+void radioConnAlive(RadioConn &c) {
+  c.backoffMs = RADIO_CONFIG.retry_ms;
+}
+
+void radioConnNetDown(RadioConn &c) {
+  if (c.sock >= 0) c.failures++;
+  radioConnClose(c);   // keine Versuche bis zum naechsten "up"
+}
+
+void radioConnNetUp(RadioConn &c) {
+  if (c.state != RADIO_LINK_DOWN) return;
+  c.backoffMs = RADIO_CONFIG.retry_ms;
+  radioConnStart(c);
+}
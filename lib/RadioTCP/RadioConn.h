@@ -0,0 +1,108 @@
+// lib/RadioTCP/RadioConn.h
+//
+// Verbindungsverwaltung, die Radio-Client (RadioTCP) und Telemetrie
+// (lib/RadioTelemetry) gemeinsam nutzen: eine nicht blockierende TCP-Verbindung
+// je Radio mit Verbindungsaufbau, Backoff und Sperre des Light Sleep.
+//
+// Zustaende (RadioLinkState):
+//   DOWN        -> (timer: backoffMs, verdoppelt je Fehlschlag, +-12.5% Zufall) -> Verbindungsaufbau
+//   CONNECTING  -> Socket beschreibbar (NetMux) => radioConnFinish() => UP,
+//                  (timer: connect_timeout_ms) => DOWN
+//   UP          -> Fehler bzw. Timeout des Clients (timer) => DOWN
+//   Netz weg (RadioNet): alle DOWN ohne Versuche, bis das Netz wieder da ist.
+//
+// Der Client behaelt sein Protokoll: er meldet den Socket bei NetMux mit eigenem
+// Rueckruf an (onSocket), stellt den Timer im Zustand UP selbst und raeumt in
+// onClose() seinen Empfangs-/Sendezustand auf. Solange ein Socket offen ist,
+// bleibt Light Sleep gesperrt (EMAC steht sonst).
+//
+// Nicht thread-sicher bis auf radioNetRequest() (vormerken, wirkt im naechsten
+// radioNetTake()). Kontext wie der Client (radioPoll()/telemetryPoll()).
+
+#pragma once
+#include <stdint.h>
+
+#include <TimerWheel.h>
+#include <NetMux.h>
+#include "RadioTCP.h"   // RadioLinkState
+
+// Netz (Link/IP) vorhanden; Anforderungen aus anderem Kontext (Netzwerk-Events)
+struct RadioNet {
+  bool up;
+  volatile bool upRequest;
+  volatile bool downRequest;
+};
+
+// Rueckgabe von radioNetTake()
+enum : uint8_t {
+  RADIO_NET_DOWN = 1u << 0,   // erst alle Verbindungen schliessen ...
+  RADIO_NET_UP = 1u << 1      // ... dann neu aufbauen
+};
+
+// Rueckrufe in den Client (arg wie in radioConnInit())
+struct RadioConnOps {
+  NetMuxFn onSocket;                               // Socket bereit (NetMux)
+  void (*onState)(uint8_t state, void* arg);       // Zustand gewechselt, nullptr = egal
+  void (*onClose)(void* arg);                      // vor dem Schliessen, nullptr = nichts aufzuraeumen
+};
+
+struct RadioConn {
+  const char* host;
+  uint16_t port;                 // 0 = keine Verbindung (nur Spiegel bzw. aus)
+  const RadioConnOps* ops;
+  void* arg;
+  RadioNet* net;
+
+  int sock;
+  int8_t muxSlot;                // Platz in lib/NetMux, -1 = nicht angemeldet
+  uint8_t state;                 // RadioLinkState
+  bool sleepInhibited;
+  Timer timer;                   // DOWN: neuer Versuch, CONNECTING: Abbruch, UP: Client
+  uint32_t backoffMs;            // Wartezeit bis zum naechsten Versuch (waechst bis retry_max_ms)
+  uint32_t failures;             // Abbrueche (Fehler, Timeout, Protokoll)
+};
+
+void radioNetInit(RadioNet &n);
+
+// Netz da/weg vormerken (darf aus anderem Kontext kommen, weckt die Hauptschleife)
+void radioNetRequest(RadioNet &n, bool up);
+
+/**
+ * @brief Vorgemerkte Netz-Ereignisse uebernehmen (down vor up: kurzer Ausfall
+ *        zwischen zwei Polls endet mit frischen Verbindungen).
+ * @return RADIO_NET_DOWN / RADIO_NET_UP => je Verbindung radioConnNetDown() / radioConnNetUp()
+ */
+uint8_t radioNetTake(RadioNet &n);
+
+/**
+ * @brief Verbindung initialisieren (DOWN, ohne Versuch). Timer-Rueckruf ist
+ *        timerFn(arg), der Client ruft darin radioConnTimer().
+ */
+void radioConnInit(RadioConn &c, const char* host, uint16_t port, RadioNet &net,
+                   const RadioConnOps* ops, void* arg, TimerFn timerFn);
+
+// Verbindungsaufbau starten; ohne Socket naechster Versuch per Backoff
+void radioConnStart(RadioConn &c);
+
+// Schliessen (onClose, Timer stoppen, DOWN), ohne neuen Versuch
+void radioConnClose(RadioConn &c);
+
+// Verbindung verwerfen, Abbruch zaehlen, naechsten Versuch planen
+void radioConnFail(RadioConn &c);
+
+/**
+ * @brief Abgelaufener Timer: DOWN => neuer Versuch, sonst Abbruch.
+ */
+void radioConnTimer(RadioConn &c);
+
+/**
+ * @brief Socket im Zustand CONNECTING beschreibbar: Ergebnis pruefen.
+ * @return true = jetzt UP, false = fehlgeschlagen (bereits radioConnFail())
+ */
+bool radioConnFinish(RadioConn &c);
+
+// Gegenstelle antwortet bzw. Strom laeuft: Backoff zuruecksetzen
+void radioConnAlive(RadioConn &c);
+
+void radioConnNetDown(RadioConn &c);
+void radioConnNetUp(RadioConn &c);
@@ -0,0 +1,133 @@
+// lib/RadioTCP/RadioSocket.h
+//
+// Nicht blockierende TCP-Sockets fuer den Radio-Client (und den Web-Server,
+// lib/WebMirror: lauschen + annehmen).
+//
+// - ESP32: lwIP-Socket-API (gleiche Aufrufe wie POSIX, Ethernet-Interface)
+// - Host:  POSIX-Sockets (Linux), damit der Client gegen einen lokalen
+//          Stand-in-Server laeuft
+//
+// Alle Funktionen kehren sofort zurueck: connect() meldet "in Arbeit",
+// Senden/Empfangen liefern 0 statt zu warten. Ob ein Socket bereit ist, fragt
+// lib/NetMux fuer alle Sockets gemeinsam ab.
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+
+#ifdef ESP32
+#include <lwip/sockets.h>
+#include <lwip/inet.h>
+#else
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#endif
+#include <fcntl.h>
+#include <unistd.h>
+
+/**
+ * @brief Socket oeffnen und Verbindungsaufbau starten.
+ * @return Deskriptor oder -1 (ungueltige Adresse, keine Ressourcen, sofort abgelehnt)
+ */
+static inline int radioSockConnect(const char* host, uint16_t port) {
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  if (inet_pton(AF_INET, host, &addr.sin_addr) != 1) return -1;
+
+  const int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (fd < 0) return -1;
+
+  // Kurze Kommandos sofort senden (kein Nagle)
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+
+  if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 && errno != EINPROGRESS) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+/**
+ * @brief Ergebnis des Verbindungsaufbaus, sobald der Socket beschreibbar bzw.
+ *        mit Fehler gemeldet ist (lib/NetMux). @return true = verbunden
+ */
+static inline bool radioSockConnectOk(int fd) {
+  int err = 0;
+  socklen_t len = sizeof(err);
+  return getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) == 0 && err == 0;
+}
+
+/**
+ * @brief Senden ohne Warten. @return gesendete Bytes (0 = Puffer voll), -1 = Fehler
+ */
+static inline int radioSockSend(int fd, const uint8_t* buf, size_t len) {
+#ifdef MSG_NOSIGNAL
+  const int n = (int)send(fd, buf, len, MSG_DONTWAIT | MSG_NOSIGNAL);
+#else
+  const int n = (int)send(fd, buf, len, MSG_DONTWAIT);
+#endif
+  if (n >= 0) return n;
+  return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+}
+
+/**
+ * @brief Empfangen ohne Warten. @return Bytes (0 = nichts da), -1 = Fehler/geschlossen
+ */
+static inline int radioSockRecv(int fd, uint8_t* buf, size_t len) {
+  const int n = (int)recv(fd, buf, len, MSG_DONTWAIT);
+  if (n > 0) return n;
+  if (n == 0) return -1;   // Gegenstelle hat geschlossen
+  return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+}
+
+/**
+ * @brief Lauschenden Socket auf allen Interfaces oeffnen (nicht blockierend).
+ * @param port   0 = frei waehlen
+ * @param bound  tatsaechlicher Port
+ * @return Deskriptor oder -1
+ */
+static inline int radioSockListen(uint16_t port, uint8_t backlog, uint16_t &bound) {
+  const int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (fd < 0) return -1;
+
+  int one = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  socklen_t len = sizeof(addr);
+  if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(fd, backlog) < 0 ||
+      getsockname(fd, (struct sockaddr*)&addr, &len) < 0) {
+    close(fd);
+    return -1;
+  }
+  bound = ntohs(addr.sin_port);
+  return fd;
+}
+
+/**
+ * @brief Wartende Verbindung annehmen (nicht blockierend, ohne Nagle).
+ * @return Deskriptor oder -1 (keine wartend / Fehler)
+ */
+static inline int radioSockAccept(int listenFd) {
+  const int fd = accept(listenFd, nullptr, nullptr);
+  if (fd < 0) return -1;
+
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+  return fd;
+}
+
+static inline void radioSockClose(int fd) {
+  if (fd >= 0) close(fd);
+}
@@ -0,0 +1,610 @@
+// lib/RadioTCP/RadioTCP.cpp
+//
+// Radio-Client (siehe RadioTCP.h): je Radio ein RadioLink mit Sende-Slots,
+// Pipeline mit Quittungen in Reihenfolge, Verbindungsaufbau/Timeouts ueber
+// einen Timer und Soll-/Ist-Werten im Spiegel (lib/RadioState).
+//
+// Zustaende je Radio (Verbindungsaufbau, Backoff, Netz: RadioConn.h, gemeinsam
+// mit lib/RadioTelemetry):
+//   DOWN        -> (Timer: Backoff) -> Verbindungsaufbau
+//   CONNECTING  -> Socket beschreibbar (NetMux) => UP, (Timer: connect_timeout_ms) => DOWN
+//   UP          -> Fehler/Protokollfehler/Quittungs-Timeout (Timer) => DOWN
+//   Netz weg (radioNetworkUp(false)): alle DOWN ohne Versuche, bis das Netz wieder da ist.
+//
+// Sockets sind bei lib/NetMux angemeldet, solange sie offen sind. Interesse:
+// CONNECTING schreiben, UP lesen (+ schreiben, solange ein Rest im Sendepuffer
+// wartet). Radios ohne Verkehr kosten so keinen eigenen Systemaufruf.
+//
+// Offline-Journal: dirty[] + Sollwert im Spiegel. Je Parameter ein Eintrag,
+// ein neuer Wert ersetzt den alten; mehr als RADIO_PARAM_COUNT Eintraege gibt
+// es nicht, egal wie lange die Verbindung fehlt. Nach dem Verbinden sendet
+// fillPipeline() alle Eintraege in einem Rutsch (ein Sendepuffer, ein send()).
+//
+// Grenze zur GUI (mit GUI_TASKS ein anderer Task): radioRequest() legt Sollwerte
+// in einen atomaren Slot je Parameter, radioPoll() uebernimmt sie per radioSet().
+// Zurueck geht je Radio ein RadioView-Snapshot, neu veroeffentlicht bei jedem
+// Wechsel von Sollwert, bestaetigtem Wert oder Verbindungszustand.
+
+#include "RadioTCP.h"
+
+#include <Arduino.h>
+#include <string.h>
+#include <atomic>
+
+#include <EventLoop.h>
+#include <TimerWheel.h>
+#include <Snapshot.h>
+#include <RadioState.h>
+#include <NetMux.h>
+
+#include "RadioConn.h"
+#include "RadioSocket.h"
+
+// Abfrage der Sockets, solange Verbindungsaufbau oder Quittungen ausstehen
+static const uint32_t RADIO_POLL_US = 1000;
+
+// Gesendetes, noch nicht quittiertes Kommando
+struct RadioPending {
+  uint16_t seq;
+  uint8_t param;
+  bool get;         // GET (Zuruecklesen) statt SET
+  int32_t value;    // SET: gesendeter Wert
+  uint32_t sentUs;
+};
+
+// Verbindung + Zustand eines Radios
+struct RadioLink {
+  const RadioEndpoint* ep;
+  uint8_t index;                 // Radio-Nummer (Rueckrufe)
+
+  RadioConn conn;                // Socket + Zustand; conn.timer im Zustand UP: Quittungs-Timeout
+  Timer readbackTimer;           // UP: alle Parameter zuruecklesen (RADIO_CONFIG.readback_ms)
+
+  // Soll-/Ist-Werte, Generationen, Abonnenten
+  RadioMirror mirror;
+
+  // Sende-Slot je Parameter
+  bool dirty[RADIO_PARAM_COUNT];          // Sollwert noch nicht gesendet
+  bool queryPending[RADIO_PARAM_COUNT];   // GET faellig
+
+  // Pipeline (FIFO in Sendereihenfolge)
+  RadioPending window[RADIO_PIPELINE_DEPTH];
+  uint8_t winHead;
+  uint8_t winCount;
+  uint16_t nextSeq;
+
+  // Ungesendeter Rest (Socket-Puffer war voll)
+  uint8_t txBuf[RADIO_PIPELINE_DEPTH * RADIO_CMD_MAX];
+  uint16_t txLen;
+
+  // Stand der angefangenen Antwortzeile
+  RadioParser rx;
+
+  RadioStats stats;   // failures fuehrt conn
+
+  // Erste Fuellung nach dem Verbinden zaehlt als Nachholen des Journals
+  bool replayPending;
+
+  // Veroeffentlichter Stand fuer die GUI
+  RadioView view;
+  Snapshot<RadioView> viewSnapshot;
+};
+
+// Sollwerte aus anderem Kontext (radioRequest()), je Radio
+struct RadioRequests {
+  std::atomic<int32_t> value[RADIO_PARAM_COUNT];
+  std::atomic<uint32_t> pending;   // Bit p: value[p] noch nicht uebernommen
+};
+
+static RadioLink links[RADIO_MAX];
+static RadioRequests requests[RADIO_MAX];
+static uint8_t linkCount = 0;
+static bool active = false;
+
+static RadioAckFn ackFn = nullptr;
+static void* ackArg = nullptr;
+
+static RadioLinkFn linkFn = nullptr;
+static void* linkArg = nullptr;
+
+// Netz (Link/IP) vorhanden; Anforderungen aus anderem Kontext (Netzwerk-Events)
+static RadioNet net;
+
+static RadioLink* linkAt(uint8_t radio) {
+  return (radio < linkCount) ? &links[radio] : nullptr;
+}
+
+// --------------------
+// Verbindung
+// --------------------
+
+/**
+ * @brief Spiegel und Verbindungszustand als RadioView veroeffentlichen.
+ */
+static void publishView(RadioLink &l) {
+  RadioView &v = l.view;
+  v.valid = 0;
+  for (uint8_t p = 0; p < RADIO_PARAM_COUNT; p++) {
+    const RadioParamState &s = l.mirror.param[p];
+    v.value[p] = s.desiredValid ? s.desired : s.confirmed;
+    if (s.desiredValid || s.confirmedValid) v.valid |= (uint8_t)(1u << p);
+  }
+  v.link = l.conn.state;
+  snapshotPublish(l.viewSnapshot, v);
+}
+
+/**
+ * @brief Spiegel meldet einen geaenderten bestaetigten bzw. uebernommenen Wert.
+ */
+static void onMirrorChange(RadioParam param, int32_t, bool external, void* arg) {
+  RadioLink &l = *(RadioLink*)arg;
+  if (external) l.view.externalGen[param]++;
+  publishView(l);
+}
+
+/**
+ * @brief RadioConn: Verbindungszustand gewechselt.
+ */
+static void onLinkState(uint8_t s, void* arg) {
+  RadioLink &l = *(RadioLink*)arg;
+  publishView(l);
+  if (linkFn) linkFn(l.index, s, linkArg);
+}
+
+/**
+ * @brief Quittungs-Timeout fuer das aelteste unbestaetigte Kommando stellen.
+ */
+static void armAckTimeout(RadioLink &l) {
+  if (l.winCount == 0) {
+    timerCancel(l.conn.timer);
+    return;
+  }
+  const uint32_t ageMs = (micros() - l.window[l.winHead].sentUs) / 1000;
+  const uint32_t left = (ageMs >= RADIO_CONFIG.ack_timeout_ms) ? 0 : RADIO_CONFIG.ack_timeout_ms - ageMs;
+  timerArm(l.conn.timer, millis(), left);
+}
+
+/**
+ * @brief RadioConn schliesst den Socket: Unbestaetigtes kommt zurueck ins
+ *        Journal, Empfangs-/Sendezustand wird verworfen.
+ */
+static void onLinkClose(void* arg) {
+  RadioLink &l = *(RadioLink*)arg;
+  for (uint8_t i = 0; i < l.winCount; i++) {
+    const RadioPending &c = l.window[(l.winHead + i) % RADIO_PIPELINE_DEPTH];
+    if (c.get) l.queryPending[c.param] = true;
+    else l.dirty[c.param] = true;
+  }
+  l.winHead = l.winCount = 0;
+  l.txLen = 0;
+  radioParserReset(l.rx);
+  l.replayPending = false;
+  timerCancel(l.readbackTimer);
+}
+
+static void onSocket(uint8_t ready, void* arg);
+
+static const RadioConnOps LINK_OPS = { onSocket, onLinkState, onLinkClose };
+
+/**
+ * @brief conn.timer: je nach Zustand neuer Versuch oder Abbruch.
+ */
+static void onLinkTimer(void* arg) {
+  RadioLink &l = *(RadioLink*)arg;
+  if (!active) return;
+  radioConnTimer(l.conn);   // Verbindungsaufbau bzw. Quittung zu langsam => Abbruch
+}
+
+static void queryAll(RadioLink &l) {
+  for (uint8_t p = 0; p < RADIO_PARAM_COUNT; p++) l.queryPending[p] = true;
+}
+
+/**
+ * @brief readbackTimer: Stand des Radios abfragen (am Geraet verstellt?).
+ */
+static void onReadbackTimer(void* arg) {
+  RadioLink &l = *(RadioLink*)arg;
+  if (!active || l.conn.state != RADIO_LINK_UP) return;
+  queryAll(l);
+  timerArm(l.readbackTimer, millis(), RADIO_CONFIG.readback_ms);
+}
+
+// --------------------
+// Senden / Empfangen
+// --------------------
+
+static bool anyWork(const RadioLink &l) {
+  for (uint8_t p = 0; p < RADIO_PARAM_COUNT; p++) {
+    if (l.dirty[p] || l.queryPending[p]) return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Juengstes unquittiertes Kommando fuer param (nullptr = keins).
+ */
+static const RadioPending* lastInFlight(const RadioLink &l, uint8_t param, bool get) {
+  for (uint8_t i = l.winCount; i > 0; i--) {
+    const RadioPending &c = l.window[(l.winHead + i - 1) % RADIO_PIPELINE_DEPTH];
+    if (c.param == param && c.get == get) return &c;
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Kommando kodieren, in den Sendepuffer und die Pipeline legen.
+ * @return false = Pipeline oder Sendepuffer voll
+ */
+static bool queueCommand(RadioLink &l, uint8_t param, bool get, int32_t value) {
+  if (l.winCount >= RADIO_PIPELINE_DEPTH) return false;
+
+  uint8_t* const out = l.txBuf + l.txLen;
+  const size_t cap = sizeof(l.txBuf) - l.txLen;
+  const uint8_t n = get ? radioEncodeGet(out, cap, l.nextSeq, (RadioParam)param)
+                        : radioEncodeSet(out, cap, l.nextSeq, (RadioParam)param, value);
+  if (n == 0) return false;
+  l.txLen = (uint16_t)(l.txLen + n);
+
+  RadioPending &c = l.window[(l.winHead + l.winCount) % RADIO_PIPELINE_DEPTH];
+  c.seq = l.nextSeq++;
+  c.param = param;
+  c.get = get;
+  c.value = value;
+  c.sentUs = micros();
+
+  if (++l.winCount == 1) armAckTimeout(l);
+  return true;
+}
+
+/**
+ * @brief Freie Pipeline-Plaetze fuellen: erst geaenderte Sollwerte, dann GETs.
+ *
+ * Gesendet wird nur, was sich vom erwarteten Stand des Radios unterscheidet
+ * (letzter unterwegs befindlicher Wert, sonst der bestaetigte).
+ */
+static void fillPipeline(RadioLink &l) {
+  for (uint8_t p = 0; p < RADIO_PARAM_COUNT; p++) {
+    if (!l.dirty[p]) continue;
+
+    const RadioParamState &s = l.mirror.param[p];
+    const RadioPending* last = lastInFlight(l, p, false);
+    const bool known = last || s.confirmedValid;
+    const int32_t expected = last ? last->value : s.confirmed;
+    if (known && expected == s.desired) {
+      l.dirty[p] = false;   // z.B. hin und zurueck gedreht, bevor gesendet wurde
+      l.stats.skipped++;
+      continue;
+    }
+
+    if (!queueCommand(l, p, false, s.desired)) return;   // Rest im naechsten Durchlauf
+    l.dirty[p] = false;
+    l.queryPending[p] = false;   // Quittung bestaetigt den Wert ohnehin
+    l.stats.sent++;
+    if (l.replayPending) l.stats.replayed++;
+  }
+
+  for (uint8_t p = 0; p < RADIO_PARAM_COUNT; p++) {
+    if (!l.queryPending[p] || lastInFlight(l, p, false) || lastInFlight(l, p, true)) continue;
+    if (!queueCommand(l, p, true, 0)) return;
+    l.queryPending[p] = false;
+    l.stats.readbacks++;
+  }
+}
+
+/**
+ * @brief Sendepuffer abschicken; ein Rest wartet, bis NetMux "beschreibbar" meldet.
+ */
+static bool flushTx(RadioLink &l) {
+  if (l.txLen > 0) {
+    const int n = radioSockSend(l.conn.sock, l.txBuf, l.txLen);
+    if (n < 0) {
+      radioConnFail(l.conn);   // Unbestaetigtes wird nach dem Wiederverbinden neu gesendet
+      return false;
+    }
+    if (n > 0) {
+      memmove(l.txBuf, l.txBuf + n, l.txLen - n);
+      l.txLen = (uint16_t)(l.txLen - n);
+    }
+  }
+  netMuxInterest(l.conn.muxSlot, l.txLen ? (NET_MUX_READ | NET_MUX_WRITE) : NET_MUX_READ);
+  return true;
+}
+
+/**
+ * @brief Pipeline fuellen und senden.
+ */
+static void pump(RadioLink &l) {
+  fillPipeline(l);
+  l.replayPending = false;
+  flushTx(l);
+}
+
+/**
+ * @brief Eine Antwort muss zum aeltesten Kommando passen. Sonst ist der Strom
+ *        nicht mehr synchron => neu verbinden.
+ */
+static bool handleReply(RadioLink &l, const RadioReply &r) {
+  if (l.winCount == 0) return false;
+
+  const RadioPending c = l.window[l.winHead];
+  if (r.seq != c.seq) return false;
+  if (c.get && r.ok && !r.hasValue) return false;   // GET ohne Wert
+
+  const uint32_t rtt = micros() - c.sentUs;
+  l.stats.lastRttUs = rtt;
+  if (rtt > l.stats.maxRttUs) l.stats.maxRttUs = rtt;
+
+  l.winHead = (uint8_t)((l.winHead + 1) % RADIO_PIPELINE_DEPTH);
+  l.winCount--;
+  armAckTimeout(l);
+  radioConnAlive(l.conn);   // Radio antwortet, Verbindung taugt
+
+  const RadioParam p = (RadioParam)c.param;
+  if (ackFn) ackFn(l.index, p, c.get, r.ok, rtt, ackArg);
+  if (!r.ok) {
+    l.stats.rejected++;
+    // Abgelehnter Sollwert: tatsaechlichen Stand holen (Spiegel uebernimmt ihn)
+    if (!c.get) l.queryPending[p] = true;
+    return true;
+  }
+
+  if (c.get) {
+    // Nur uebernehmen, wenn vom Panel nichts mehr fuer p unterwegs ist
+    const bool idle = !l.dirty[p] && !lastInFlight(l, p, false);
+    if (idle && l.mirror.param[p].desiredValid && l.mirror.param[p].desired != r.value) l.stats.external++;
+    radioMirrorConfirm(l.mirror, p, r.value, idle);
+  } else {
+    l.stats.acked++;
+    radioMirrorConfirm(l.mirror, p, c.value, false);
+  }
+  return true;
+}
+
+static bool readAcks(RadioLink &l) {
+  uint8_t buf[64];
+  for (;;) {
+    const int n = radioSockRecv(l.conn.sock, buf, sizeof(buf));
+    if (n == 0) return true;
+    if (n < 0) {
+      radioConnFail(l.conn);
+      return false;
+    }
+
+    // Antworten koennen ueber Segmente verteilt sein, der Parser merkt sich den Stand
+    size_t pos = 0;
+    while (pos < (size_t)n) {
+      RadioReply reply;
+      size_t used = 0;
+      const RadioParseResult r = radioParse(l.rx, buf + pos, (size_t)n - pos, used, reply);
+      pos += used;
+      if (r == RADIO_PARSE_MORE) continue;
+      if (r == RADIO_PARSE_ERROR || !handleReply(l, reply)) {
+        radioConnFail(l.conn);
+        return false;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Verbindungsaufbau fertig: Stand des Radios holen, Journal nachholen.
+ */
+static void onConnected(RadioLink &l) {
+  l.stats.connects++;
+  l.replayPending = true;
+
+  // Stand des Radios holen, danach zyklisch (0 = nur beim Verbinden)
+  queryAll(l);
+  if (RADIO_CONFIG.readback_ms > 0) timerArm(l.readbackTimer, millis(), RADIO_CONFIG.readback_ms);
+  pump(l);
+}
+
+/**
+ * @brief NetMux: Socket eines Radios ist bereit.
+ */
+static void onSocket(uint8_t ready, void* arg) {
+  RadioLink &l = *(RadioLink*)arg;
+
+  if (l.conn.state == RADIO_LINK_CONNECTING) {
+    if (radioConnFinish(l.conn)) onConnected(l);
+    return;
+  }
+  if (l.conn.state != RADIO_LINK_UP) return;
+
+  // Quittungen geben Pipeline-Plaetze frei => gleich nachfuellen
+  if ((ready & (NET_MUX_READ | NET_MUX_ERROR)) && !readAcks(l)) return;
+  pump(l);
+}
+
+// --------------------
+// Public API
+// --------------------
+
+void radioInit(const RadioEndpoint* radios, uint8_t count) {
+  radioStop();
+
+  linkCount = (count < RADIO_MAX) ? count : RADIO_MAX;
+  radioNetInit(net);
+
+  for (uint8_t i = 0; i < linkCount; i++) {
+    RadioLink &l = links[i];
+    l.ep = &radios[i];
+    l.index = i;
+    // Port 0 = nur Spiegel (Host-Simulation)
+    radioConnInit(l.conn, l.ep->host, l.ep->port, net, &LINK_OPS, &l, onLinkTimer);
+    radioMirrorClear(l.mirror);   // Abonnenten bleiben
+    for (uint8_t p = 0; p < RADIO_PARAM_COUNT; p++) l.dirty[p] = l.queryPending[p] = false;
+    l.winHead = l.winCount = 0;
+    l.nextSeq = 1;
+    l.txLen = 0;
+    radioParserReset(l.rx);
+    l.stats = RadioStats{};
+    l.replayPending = false;
+
+    requests[i].pending.store(0, std::memory_order_relaxed);
+    radioMirrorSubscribe(l.mirror, onMirrorChange, &l);
+    l.view = RadioView{};
+    snapshotInit(l.viewSnapshot, l.view);
+    publishView(l);
+
+    timerInit(l.readbackTimer, onReadbackTimer, &l);
+  }
+
+  active = true;
+  for (uint8_t i = 0; i < linkCount; i++) radioConnStart(links[i].conn);
+}
+
+void radioStop() {
+  for (uint8_t i = 0; i < linkCount; i++) radioConnClose(links[i].conn);
+  active = false;
+}
+
+uint8_t radioCount() {
+  return linkCount;
+}
+
+const char* radioName(uint8_t radio) {
+  const RadioLink* l = linkAt(radio);
+  return (l && l->ep->name) ? l->ep->name : "";
+}
+
+void radioSet(uint8_t radio, RadioParam param, int32_t value) {
+  RadioLink* l = linkAt(radio);
+  if (!l || param >= RADIO_PARAM_COUNT) return;
+  if (!radioMirrorSetDesired(l->mirror, param, value)) return;
+
+  // Noch ungesendeter Wert wird ersetzt (last writer wins)
+  if (l->dirty[param]) l->stats.coalesced++;
+  if (l->conn.state != RADIO_LINK_UP) l->stats.offline++;
+  l->dirty[param] = true;
+  publishView(*l);
+}
+
+void radioRequest(uint8_t radio, RadioParam param, int32_t value) {
+  if (radio >= linkCount || param >= RADIO_PARAM_COUNT) return;
+
+  RadioRequests &r = requests[radio];
+  r.value[param].store(value, std::memory_order_relaxed);
+  r.pending.fetch_or(1u << param, std::memory_order_release);
+  eventLoopSignal();
+}
+
+/**
+ * @brief Vorgemerkte radioRequest()-Werte uebernehmen (neuester je Parameter).
+ */
+static void applyRequests(uint8_t radio) {
+  RadioRequests &r = requests[radio];
+  uint32_t bits = r.pending.exchange(0, std::memory_order_acquire);
+  for (; bits; bits &= bits - 1) {
+    const uint8_t p = (uint8_t)__builtin_ctz(bits);
+    radioSet(radio, (RadioParam)p, r.value[p].load(std::memory_order_relaxed));
+  }
+}
+
+uint32_t radioViewVersion(uint8_t radio) {
+  return (radio < linkCount) ? snapshotVersion(links[radio].viewSnapshot) : 0;
+}
+
+uint32_t radioReadView(uint8_t radio, RadioView &out) {
+  if (radio >= linkCount) {
+    out = RadioView{};
+    return 0;
+  }
+  const uint32_t version = snapshotRead(links[radio].viewSnapshot, out);
+
+  // Eigene, noch nicht uebernommene Sollwerte gelten schon
+  RadioRequests &r = requests[radio];
+  for (uint32_t bits = r.pending.load(std::memory_order_acquire); bits; bits &= bits - 1) {
+    const uint8_t p = (uint8_t)__builtin_ctz(bits);
+    out.value[p] = r.value[p].load(std::memory_order_relaxed);
+    out.valid |= (uint8_t)(1u << p);
+  }
+  return version;
+}
+
+bool radioSubscribe(uint8_t radio, RadioChangeFn fn, void* arg) {
+  // Auch vor radioInit() (Spiegel und Abonnenten ueberleben radioInit())
+  if (radio >= RADIO_MAX) return false;
+  return radioMirrorSubscribe(links[radio].mirror, fn, arg);
+}
+
+void radioOnAck(RadioAckFn fn, void* arg) {
+  ackFn = fn;
+  ackArg = arg;
+}
+
+void radioOnLink(RadioLinkFn fn, void* arg) {
+  linkFn = fn;
+  linkArg = arg;
+}
+
+void radioNetworkUp(bool up) {
+  // Nur vormerken; uebernommen wird im naechsten radioPoll()
+  radioNetRequest(net, up);
+}
+
+void radioPoll() {
+  if (!active) return;
+
+  const uint8_t netEvents = radioNetTake(net);
+  for (uint8_t i = 0; i < linkCount && netEvents; i++) {
+    if (netEvents & RADIO_NET_DOWN) radioConnNetDown(links[i].conn);
+    if (netEvents & RADIO_NET_UP) radioConnNetUp(links[i].conn);
+  }
+
+  // Neue Sollwerte/faellige GETs sofort senden, Quittungen kommen ueber NetMux
+  for (uint8_t i = 0; i < linkCount; i++) {
+    RadioLink &l = links[i];
+    if (requests[i].pending.load(std::memory_order_relaxed)) applyRequests(i);
+    if (l.conn.state == RADIO_LINK_UP && anyWork(l)) pump(l);
+  }
+}
+
+uint32_t radioIdleUs() {
+  if (!active) return EVENT_NO_DEADLINE;
+
+  uint32_t idle = EVENT_NO_DEADLINE;
+  for (uint8_t i = 0; i < linkCount; i++) {
+    const RadioLink &l = links[i];
+    if (requests[i].pending.load(std::memory_order_relaxed)) return 0;
+    if (l.conn.state == RADIO_LINK_DOWN) continue;   // Versuch per Timer
+    if (l.conn.state == RADIO_LINK_CONNECTING) {
+      idle = eventDeadlineMin(idle, RADIO_POLL_US);
+      continue;
+    }
+    if (l.txLen > 0 || (l.winCount < RADIO_PIPELINE_DEPTH && anyWork(l))) return 0;
+    if (l.winCount > 0) idle = eventDeadlineMin(idle, RADIO_POLL_US);
+  }
+  return idle;
+}
+
+uint8_t radioLinkState(uint8_t radio) {
+  const RadioLink* l = linkAt(radio);
+  return l ? l->conn.state : (uint8_t)RADIO_LINK_DOWN;
+}
+
+bool radioSettled(uint8_t radio) {
+  const RadioLink* l = linkAt(radio);
+  return l && !anyWork(*l) && l->winCount == 0 && l->txLen == 0 &&
+         requests[radio].pending.load(std::memory_order_relaxed) == 0;
+}
+
+bool radioConfirmed(uint8_t radio, RadioParam param, int32_t &value) {
+  const RadioLink* l = linkAt(radio);
+  if (!l || param >= RADIO_PARAM_COUNT || !l->mirror.param[param].confirmedValid) return false;
+  value = l->mirror.param[param].confirmed;
+  return true;
+}
+
+RadioParamState radioParamState(uint8_t radio, RadioParam param) {
+  const RadioLink* l = linkAt(radio);
+  return (l && param < RADIO_PARAM_COUNT) ? l->mirror.param[param] : RadioParamState{};
+}
+
+RadioStats radioStats(uint8_t radio) {
+  const RadioLink* l = linkAt(radio);
+  if (!l) return RadioStats{};
+  RadioStats s = l->stats;
+  s.failures = l->conn.failures;
+  return s;
+}
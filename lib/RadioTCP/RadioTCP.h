@@ -0,0 +1,167 @@
+// lib/RadioTCP/RadioTCP.h
+//
+// Nicht blockierender TCP-Client fuer die Steuerung der Radios (FRQ/MOD/PWR).
+//
+// Idee:
+// - Bis zu RADIO_MAX Radios (RADIO_LIST), jedes mit eigener Verbindung, eigenen
+//   Sende-Slots, eigener Pipeline und eigenem Spiegel. Alle bleiben verbunden
+//   und synchron, auch wenn die GUI gerade ein anderes bedient: Umschalten
+//   liest nur den Spiegel, es wartet nie auf einen Verbindungsaufbau.
+// - Alle Sockets laufen ueber einen poll() (lib/NetMux): Verbindungsaufbau und
+//   Quittungen werden nur bearbeitet, wenn der Socket bereit ist.
+// - Die GUI meldet jeden neuen Wert per radioSet(); gesendet wird in radioPoll()
+//   bzw. sobald Quittungen die Pipeline freigeben (netMuxPoll()).
+// - Pro Parameter gibt es genau einen Sende-Slot: solange ein Wert noch nicht
+//   gesendet ist, ersetzt ein neuerer ihn (last writer wins). Beim schnellen
+//   Drehen entsteht so kein Rueckstau, das Radio bekommt immer den neuesten Wert.
+// - Pipeline: bis zu RADIO_PIPELINE_DEPTH Kommandos ohne Quittung unterwegs,
+//   Quittungen kommen in Reihenfolge ("<seq> OK" / "<seq> ERR ...").
+// - Verbindungsabbruch/Timeout: unbestaetigte Parameter werden nach dem
+//   Wiederverbinden mit ihrem neuesten Wert erneut gesendet.
+// - Offline: die Sende-Slots sind das Journal (ein Eintrag je Parameter, feste
+//   Groesse). Beim Wiederverbinden geht der verdichtete Stand in einem Rutsch
+//   durch die Pipeline. Neue Versuche mit exponentiellem Backoff
+//   (RADIO_CONFIG.retry_ms .. retry_max_ms); ohne Netz (radioNetworkUp(false))
+//   gar keine.
+// - Soll-/Ist-Spiegel (lib/RadioState): gesendet wird nur, was vom erwarteten
+//   Stand des Radios abweicht. Nach dem Verbinden und alle RADIO_CONFIG.readback_ms
+//   wird zurueckgelesen (GET); am Radio verstellte Werte landen im Spiegel, und
+//   Abonnenten (GUI) erfahren nur von echten Aenderungen.
+// - Nichts blockiert: Sockets (RadioSocket.h) kehren sofort zurueck,
+//   Timeouts/Wiederholung sind Timer (lib/TimerWheel).
+//
+// Protokoll und Endpunkte: include/radio_config.h, Kodierung: lib/RadioCodec.
+// Radios werden ueber ihren Index in der Liste aus radioInit() angesprochen.
+// Nicht thread-sicher: alles ausser radioRequest()/radioReadView()/
+// radioViewVersion()/radioNetworkUp() aus demselben Kontext aufrufen wie
+// radioPoll()/netMuxPoll() (loop() bzw. mit GUI_TASKS der Netz-Task).
+// Die GUI spricht nur ueber diese vier: Sollwerte per radioRequest() (lock-freier
+// Slot je Parameter), Werte und Verbindungsstatus per RadioView (Snapshot.h).
+
+#pragma once
+#include <stdint.h>
+
+#include <RadioCodec.h>     // RadioParam, Kodierung der Zeilen
+#include <RadioState.h>     // RadioParamState, RadioChangeFn
+#include <radio_config.h>   // RadioEndpoint, RADIO_MAX
+
+enum RadioLinkState : uint8_t {
+  RADIO_LINK_DOWN = 0,     // getrennt, naechster Versuch per Timer (bzw. wenn das Netz kommt)
+  RADIO_LINK_CONNECTING,   // Verbindungsaufbau laeuft
+  RADIO_LINK_UP            // verbunden
+};
+
+// Stand eines Radios fuer die GUI (aus jedem Kontext lesbar, radioReadView())
+struct RadioView {
+  int32_t value[RADIO_PARAM_COUNT];          // Sollwert, sonst vom Radio bestaetigter Wert
+  uint32_t externalGen[RADIO_PARAM_COUNT];   // +1 je vom Radio uebernommenem fremden Wert
+  uint8_t valid;                             // Bit p: value[p] bekannt
+  uint8_t link;                              // RadioLinkState
+};
+
+// Statistik je Radio
+struct RadioStats {
+  uint32_t sent;           // gesendete SET-Kommandos
+  uint32_t acked;          // SET mit OK quittiert
+  uint32_t rejected;       // mit ERR quittiert
+  uint32_t coalesced;      // ungesendete Werte, die ein neuerer ersetzt hat
+  uint32_t skipped;        // nicht gesendet, Radio hat den Wert schon
+  uint32_t readbacks;      // gesendete GETs
+  uint32_t external;       // vom Radio uebernommene fremde Werte
+  uint32_t offline;        // radioSet() ohne Verbindung (landet im Journal)
+  uint32_t replayed;       // SETs aus dem Journal direkt nach dem Verbinden
+  uint32_t connects;       // erfolgreiche Verbindungen
+  uint32_t failures;       // Abbrueche (Fehler, Timeout, Protokoll)
+  uint32_t lastRttUs;      // Senden -> Quittung, letztes Kommando
+  uint32_t maxRttUs;
+};
+
+/**
+ * @brief Client initialisieren und alle Verbindungen anstossen.
+ * @param radios  Endpunkte (muessen gueltig bleiben), Index = Radio-Nummer
+ * @param count   hoechstens RADIO_MAX; Port 0 = nur Spiegel, keine Verbindung
+ */
+void radioInit(const RadioEndpoint* radios, uint8_t count);
+
+// Verbindungen schliessen, nichts mehr senden (Host/Tests)
+void radioStop();
+
+// Anzahl Radios aus radioInit()
+uint8_t radioCount();
+
+// Anzeigename (RadioEndpoint::name), "" bei ungueltigem Index
+const char* radioName(uint8_t radio);
+
+// Neuer Sollwert (ersetzt einen noch nicht gesendeten Wert desselben Parameters)
+void radioSet(uint8_t radio, RadioParam param, int32_t value);
+
+/**
+ * @brief Neuer Sollwert aus einem anderen Kontext (GUI). Lock-frei: je Radio und
+ *        Parameter zaehlt nur der neueste Wert; radioPoll() uebernimmt ihn wie radioSet().
+ */
+void radioRequest(uint8_t radio, RadioParam param, int32_t value);
+
+// Version des veroeffentlichten Stands (aendert sich bei Wert- und Statuswechseln)
+uint32_t radioViewVersion(uint8_t radio);
+
+/**
+ * @brief Stand eines Radios lesen (beliebiger Kontext). Noch nicht uebernommene
+ *        radioRequest()-Werte sind schon enthalten.
+ * @return Version (wie radioViewVersion())
+ */
+uint32_t radioReadView(uint8_t radio, RadioView &out);
+
+/**
+ * @brief Benachrichtigung bei geaendertem bestaetigtem Wert eines Radios
+ *        (siehe RadioState.h). Aufruf aus radioPoll()/netMuxPoll(), also im selben Kontext.
+ */
+bool radioSubscribe(uint8_t radio, RadioChangeFn fn, void* arg);
+
+/**
+ * @brief Beobachter fuer jede Quittung (Messung, z.B. RTT-Verteilung im Lastgenerator).
+ * @param rttUs  Senden -> Quittung
+ */
+typedef void (*RadioAckFn)(uint8_t radio, RadioParam param, bool get, bool ok, uint32_t rttUs, void* arg);
+
+// Einen Beobachter setzen (nullptr = keiner)
+void radioOnAck(RadioAckFn fn, void* arg);
+
+/**
+ * @brief Beobachter fuer Wechsel des Verbindungszustands (RadioLinkState) eines
+ *        Radios, z.B. Statusanzeige. Aufruf aus radioPoll()/netMuxPoll()/Timern.
+ */
+typedef void (*RadioLinkFn)(uint8_t radio, uint8_t state, void* arg);
+
+// Einen Beobachter setzen (nullptr = keiner)
+void radioOnLink(RadioLinkFn fn, void* arg);
+
+/**
+ * @brief Netz (Ethernet-Link/IP) da oder weg (gilt fuer alle Radios).
+ *
+ * Darf aus anderem Kontext kommen (Netzwerk-Event-Task); wirkt im naechsten
+ * radioPoll(). Weg: Verbindungen schliessen, keine Versuche mehr. Da: Backoff
+ * zuruecksetzen und sofort verbinden.
+ */
+void radioNetworkUp(bool up);
+
+/**
+ * @brief Zyklisch aufrufen: Netz-Ereignisse uebernehmen, neue Sollwerte senden.
+ *        Verbindungsaufbau und Quittungen laufen ueber netMuxPoll() (lib/NetMux).
+ */
+void radioPoll();
+
+// Zeit in µs bis zum naechsten noetigen radioPoll()/netMuxPoll() (EventLoop-Deadline)
+uint32_t radioIdleUs();
+
+uint8_t radioLinkState(uint8_t radio);
+
+// true, wenn nichts mehr zu senden ist und keine Quittung aussteht
+bool radioSettled(uint8_t radio);
+
+// Zuletzt vom Radio quittierter/gemeldeter Wert (false = noch keiner)
+bool radioConfirmed(uint8_t radio, RadioParam param, int32_t &value);
+
+// Soll-/Ist-Wert und Generationen eines Parameters
+RadioParamState radioParamState(uint8_t radio, RadioParam param);
+
+RadioStats radioStats(uint8_t radio);
@@ -0,0 +1,233 @@
+// lib/RadioTelemetry/RadioTelemetry.cpp
+//
+// Telemetrie-Empfaenger (siehe RadioTelemetry.h), je Radio ein TelemetryLink.
+//
+// Verbindungsaufbau, Backoff, Netz und Light-Sleep-Sperre wie RadioTCP ueber
+// die gemeinsame Verbindungsverwaltung (lib/RadioTCP/RadioConn.h):
+//   DOWN        -> (Timer: Backoff) -> Verbindungsaufbau
+//   CONNECTING  -> Socket beschreibbar (NetMux) => UP, (Timer: connect_timeout_ms) => DOWN
+//   UP          -> Fehler / kein Rahmen in telemetry_timeout_ms (Timer) => DOWN
+//
+// Sockets sind bei lib/NetMux angemeldet, solange sie offen sind (CONNECTING:
+// schreiben, UP: lesen).
+
+#include "RadioTelemetry.h"
+
+#include <Arduino.h>
+
+#include <EventLoop.h>
+#include <TimerWheel.h>
+#include <Snapshot.h>
+#include <NetMux.h>
+#include <RadioConn.h>
+#include <RadioSocket.h>
+
+// Verbindung + Empfangszustand eines Radios
+struct TelemetryLink {
+  const RadioEndpoint* ep;
+  RadioConn conn;           // Socket + Zustand; conn.timer im Zustand UP: kein Rahmen
+
+  // Empfang direkt in den Ring, Auswertung dort
+  TelemetryRing ring;
+  TelemetryFrame frame;
+
+  // Schreiber: nur netMuxPoll() bzw. telemetryPublish()
+  RadioTelemetry current;
+  Snapshot<RadioTelemetry> snapshot;
+
+  TelemetryStats stats;     // failures fuehrt conn
+};
+
+static TelemetryLink links[RADIO_MAX];
+static uint8_t linkCount = 0;
+static bool active = false;
+
+static RadioNet net;
+
+// --------------------
+// Verbindung
+// --------------------
+
+static void publish(TelemetryLink &l) {
+  snapshotPublish(l.snapshot, l.current);
+  l.stats.publishes++;
+}
+
+/**
+ * @brief RadioConn schliesst den Socket: Werte gelten bis zum naechsten Rahmen
+ *        als ungueltig.
+ */
+static void onLinkClose(void* arg) {
+  TelemetryLink &l = *(TelemetryLink*)arg;
+  tlmRingReset(l.ring);
+
+  if (l.current.valid) {
+    l.current.valid = false;
+    publish(l);
+  }
+}
+
+static void onSocket(uint8_t ready, void* arg);
+
+static const RadioConnOps LINK_OPS = { onSocket, nullptr, onLinkClose };
+
+/**
+ * @brief conn.timer: je nach Zustand neuer Versuch oder Abbruch.
+ */
+static void onLinkTimer(void* arg) {
+  TelemetryLink &l = *(TelemetryLink*)arg;
+  if (!active) return;
+  radioConnTimer(l.conn);   // Verbindungsaufbau zu langsam bzw. Strom steht => Abbruch
+}
+
+// --------------------
+// Empfangen
+// --------------------
+
+/**
+ * @brief Alles Verfuegbare in den Ring lesen und die vollstaendigen Zeilen auswerten.
+ */
+static void receive(TelemetryLink &l) {
+  bool gotFrame = false;
+
+  for (;;) {
+    size_t space = 0;
+    uint8_t* const dst = tlmRingWritePtr(l.ring, space);
+
+    if (space > 0) {
+      const int n = radioSockRecv(l.conn.sock, dst, space);
+      if (n < 0) {
+        radioConnFail(l.conn);
+        return;
+      }
+      if (n == 0) break;
+      tlmRingCommit(l.ring, (size_t)n);
+      l.stats.bytes += (uint32_t)n;
+      l.stats.reads++;
+    }
+
+    TelemetryParseResult r;
+    while ((r = tlmRingNext(l.ring, l.frame)) != TLM_PARSE_MORE) {
+      if (r == TLM_PARSE_BAD) {
+        l.stats.bad++;
+        continue;
+      }
+      l.stats.frames++;
+      gotFrame = true;
+      l.current.fields |= l.frame.fields;
+      l.current.frames++;
+    }
+    l.stats.overruns = l.ring.overruns;
+  }
+
+  if (!gotFrame) return;
+
+  // Nur den neuesten Stand veroeffentlichen
+  l.current.sDbm = l.frame.sDbm;
+  l.current.swr100 = l.frame.swr100;
+  l.current.fwdDw = l.frame.fwdDw;
+  l.current.valid = true;
+  publish(l);
+
+  radioConnAlive(l.conn);   // Strom laeuft
+  timerArm(l.conn.timer, millis(), RADIO_CONFIG.telemetry_timeout_ms);
+}
+
+/**
+ * @brief NetMux: Telemetrie-Socket eines Radios ist bereit.
+ */
+static void onSocket(uint8_t, void* arg) {
+  TelemetryLink &l = *(TelemetryLink*)arg;
+
+  if (l.conn.state == RADIO_LINK_CONNECTING) {
+    if (!radioConnFinish(l.conn)) return;
+    l.stats.connects++;
+    l.current.fields = 0;
+    l.frame = TelemetryFrame{};
+    netMuxInterest(l.conn.muxSlot, NET_MUX_READ);
+    timerArm(l.conn.timer, millis(), RADIO_CONFIG.telemetry_timeout_ms);
+    return;
+  }
+  if (l.conn.state == RADIO_LINK_UP) receive(l);
+}
+
+// --------------------
+// Public API
+// --------------------
+
+void telemetryInit(const RadioEndpoint* radios, uint8_t count) {
+  telemetryStop();
+
+  linkCount = (count < RADIO_MAX) ? count : RADIO_MAX;
+  radioNetInit(net);
+
+  for (uint8_t i = 0; i < linkCount; i++) {
+    TelemetryLink &l = links[i];
+    l.ep = &radios[i];
+    // telemetry_port 0 = fuer dieses Radio aus
+    radioConnInit(l.conn, l.ep->host, l.ep->telemetry_port, net, &LINK_OPS, &l, onLinkTimer);
+    tlmRingReset(l.ring);
+    l.ring.overruns = 0;
+    l.frame = TelemetryFrame{};
+    l.current = RadioTelemetry{};
+    snapshotInit(l.snapshot, l.current);
+    l.stats = TelemetryStats{};
+  }
+
+  active = true;
+  for (uint8_t i = 0; i < linkCount; i++) radioConnStart(links[i].conn);
+}
+
+void telemetryStop() {
+  for (uint8_t i = 0; i < linkCount; i++) radioConnClose(links[i].conn);
+  active = false;
+}
+
+void telemetryNetworkUp(bool up) {
+  radioNetRequest(net, up);
+}
+
+void telemetryPoll() {
+  if (!active) return;
+
+  const uint8_t netEvents = radioNetTake(net);
+  for (uint8_t i = 0; i < linkCount && netEvents; i++) {
+    if (netEvents & RADIO_NET_DOWN) radioConnNetDown(links[i].conn);
+    if (netEvents & RADIO_NET_UP) radioConnNetUp(links[i].conn);
+  }
+}
+
+uint32_t telemetryIdleUs() {
+  if (!active) return EVENT_NO_DEADLINE;
+
+  // Solange ein Strom verbunden ist bzw. aufgebaut wird: Sockets regelmaessig abfragen
+  for (uint8_t i = 0; i < linkCount; i++) {
+    if (links[i].conn.state != RADIO_LINK_DOWN) return RADIO_CONFIG.telemetry_poll_ms * 1000;
+  }
+  return EVENT_NO_DEADLINE;   // Versuche per Timer
+}
+
+uint32_t telemetryRead(uint8_t radio, RadioTelemetry &out) {
+  if (radio >= RADIO_MAX) {
+    out = RadioTelemetry{};
+    return 0;
+  }
+  return snapshotRead(links[radio].snapshot, out);
+}
+
+uint32_t telemetryVersion(uint8_t radio) {
+  return (radio < RADIO_MAX) ? snapshotVersion(links[radio].snapshot) : 0;
+}
+
+void telemetryPublish(uint8_t radio, const RadioTelemetry &t) {
+  if (radio >= RADIO_MAX) return;
+  links[radio].current = t;
+  publish(links[radio]);
+}
+
+TelemetryStats telemetryStats(uint8_t radio) {
+  if (radio >= linkCount) return TelemetryStats{};
+  TelemetryStats s = links[radio].stats;
+  s.failures = links[radio].conn.failures;
+  return s;
+}
@@ -0,0 +1,84 @@
+// lib/RadioTelemetry/RadioTelemetry.h
+//
+// Empfaenger fuer den Telemetrie-Strom der Radios (S-Meter, SWR, Vorwaertsleistung).
+//
+// Idee:
+// - Je Radio eine eigene TCP-Verbindung zum Telemetrie-Port
+//   (RadioEndpoint::telemetry_port), das Radio schickt 10..20 Zeilen/s ohne
+//   Aufforderung. Alle Radios empfangen dauernd, nicht nur das angezeigte:
+//   nach dem Umschalten stehen die Balken sofort.
+// - Gelesen wird nur, wenn der gemeinsame poll() (lib/NetMux) Daten meldet.
+// - Empfangen wird direkt in einen festen Ring, die Zeilen werden dort
+//   ausgewertet (TelemetryRing.h): keine Kopie, keine Allokation je Rahmen.
+// - Der neueste Stand je Radio liegt in einem Snapshot (Seqlock, lib/TaskRuntime):
+//   netMuxPoll() schreibt (Netz-Task bzw. loop()), die GUI liest beim
+//   Rendern ohne Sperre. Mehrere Rahmen in einem Poll ergeben ein Publish.
+// - Nichts blockiert; Verbindungsaufbau, Timeout und neue Versuche (Backoff wie
+//   RadioTCP) laufen ueber einen Timer.
+//
+// Nicht thread-sicher bis auf telemetryRead()/telemetryVersion() (beliebiger
+// Kontext) und telemetryNetworkUp() (vormerken, wirkt im naechsten Poll).
+// Radios ueber ihren Index in der Liste aus telemetryInit() (wie RadioTCP).
+
+#pragma once
+#include <stdint.h>
+
+#include <radio_config.h>    // RadioEndpoint, RADIO_MAX
+#include "TelemetryRing.h"   // TelemetryField
+
+struct RadioTelemetry {
+  int16_t sDbm;        // Empfangspegel in dBm
+  uint16_t swr100;     // SWR x100 (100 = 1.00)
+  uint16_t fwdDw;      // Vorwaertsleistung in 0.1 W
+  uint8_t fields;      // seit dem Verbinden gemeldet (TelemetryField)
+  bool valid;          // Strom laeuft (verbunden, letzter Rahmen nicht zu alt)
+  uint32_t frames;     // empfangene Rahmen seit telemetryInit()
+};
+
+// Statistik je Radio
+struct TelemetryStats {
+  uint32_t frames;       // gueltige Rahmen
+  uint32_t bad;          // verworfene Zeilen (Format)
+  uint32_t overruns;     // Zeilen laenger als der Ring
+  uint32_t publishes;    // Snapshot-Aktualisierungen
+  uint32_t bytes;        // empfangen
+  uint32_t reads;        // recv()-Aufrufe mit Daten
+  uint32_t connects;
+  uint32_t failures;     // Abbrueche (Fehler, Timeout)
+};
+
+/**
+ * @brief Empfaenger initialisieren und Verbindungsaufbau anstossen.
+ * @param radios  Endpunkte wie radioInit() (muessen gueltig bleiben);
+ *                telemetry_port 0 = fuer dieses Radio aus
+ * @param count   hoechstens RADIO_MAX
+ */
+void telemetryInit(const RadioEndpoint* radios, uint8_t count);
+
+// Verbindungen schliessen (Host/Tests)
+void telemetryStop();
+
+// Netz da/weg (wie radioNetworkUp(), darf aus anderem Kontext kommen)
+void telemetryNetworkUp(bool up);
+
+/**
+ * @brief Zyklisch aufrufen: Netz-Ereignisse uebernehmen. Verbindungsaufbau und
+ *        Empfang laufen ueber netMuxPoll() (lib/NetMux).
+ */
+void telemetryPoll();
+
+// Zeit in µs bis zum naechsten noetigen netMuxPoll() fuer die Telemetrie (EventLoop-Deadline)
+uint32_t telemetryIdleUs();
+
+/**
+ * @brief Neuesten Stand eines Radios lesen (lock-free, aus jedem Kontext).
+ * @return Version (aendert sich mit jedem Publish)
+ */
+uint32_t telemetryRead(uint8_t radio, RadioTelemetry &out);
+
+uint32_t telemetryVersion(uint8_t radio);
+
+// Stand von aussen veroeffentlichen (Host-Simulation ohne Netzwerk)
+void telemetryPublish(uint8_t radio, const RadioTelemetry &t);
+
+TelemetryStats telemetryStats(uint8_t radio);
@@ -0,0 +1,187 @@
+// lib/RadioTelemetry/TelemetryRing.h
+//
+// Empfangsring fuer den Telemetrie-Strom des Radios mit Parser, der die Zeilen
+// direkt im Ring auswertet (keine Zeilenkopie, keine Allokation).
+//
+// - recv() schreibt direkt in den freien, zusammenhaengenden Teil des Rings
+//   (tlmRingWritePtr/tlmRingCommit), hoechstens zweimal pro Umlauf.
+// - tlmRingNext() sucht ab der zuletzt geprueften Stelle nach '\n' und liest
+//   die Felder der Zeile zeichenweise ueber die Ring-Indizes (auch ueber das
+//   Ringende hinweg). Danach ist die Zeile freigegeben.
+// - Zeile laenger als der Ring: Inhalt wird verworfen, bis zum naechsten '\n'
+//   wird uebersprungen (Strom synchronisiert sich an der Zeilengrenze neu).
+//
+// Format (include/radio_config.h): "TLM S=<dBm> SWR=<x100> FWD=<0.1 W>\n"
+// Felder in beliebiger Reihenfolge und Anzahl, unbekannte werden uebersprungen.
+//
+// Header-only, ohne Arduino-Include: laeuft unveraendert auf dem Host.
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Ringgroesse (Zweierpotenz), mehrere Rahmen zu ~30 Bytes
+static const uint16_t TLM_RING_SIZE = 256;
+static const uint16_t TLM_RING_MASK = TLM_RING_SIZE - 1;
+
+// Max. Ziffern eines Feldwerts
+static const uint8_t TLM_VALUE_DIGITS = 6;
+
+// Bits in TelemetryFrame::fields
+enum TelemetryField : uint8_t {
+  TLM_S   = 1 << 0,   // Empfangspegel (S-Meter)
+  TLM_SWR = 1 << 1,   // Stehwellenverhaeltnis
+  TLM_FWD = 1 << 2    // Vorwaertsleistung
+};
+
+struct TelemetryFrame {
+  int16_t sDbm;        // Empfangspegel in dBm
+  uint16_t swr100;     // SWR x100 (100 = 1.00)
+  uint16_t fwdDw;      // Vorwaertsleistung in 0.1 W
+  uint8_t fields;      // in dieser Zeile enthalten (TelemetryField)
+};
+
+enum TelemetryParseResult : uint8_t {
+  TLM_PARSE_MORE = 0,   // keine vollstaendige Zeile mehr im Ring
+  TLM_PARSE_FRAME,      // frame gefuellt
+  TLM_PARSE_BAD         // Zeile ist kein gueltiger Rahmen (verworfen)
+};
+
+struct TelemetryRing {
+  uint8_t buf[TLM_RING_SIZE];
+  uint16_t head;       // Beginn der angefangenen Zeile  (frei laufende Indizes,
+  uint16_t scan;       // bis hier nach '\n' gesucht      Position = Index & MASK)
+  uint16_t tail;       // Ende der empfangenen Daten
+  bool skip;           // ueberlange Zeile: bis zum naechsten '\n' verwerfen
+  uint32_t overruns;   // verworfene ueberlange Zeilen (bleibt bei tlmRingReset)
+};
+
+static inline void tlmRingReset(TelemetryRing &r) {
+  r.head = r.scan = r.tail = 0;
+  r.skip = false;
+}
+
+/**
+ * @brief Freier, zusammenhaengender Platz ab tail (Ziel fuer recv()).
+ * @param len  Groesse (0 = Ring voll)
+ */
+static inline uint8_t* tlmRingWritePtr(TelemetryRing &r, size_t &len) {
+  const uint16_t used = (uint16_t)(r.tail - r.head);
+  const uint16_t pos = r.tail & TLM_RING_MASK;
+  const uint16_t toEnd = (uint16_t)(TLM_RING_SIZE - pos);
+  const uint16_t space = (uint16_t)(TLM_RING_SIZE - used);
+  len = (space < toEnd) ? space : toEnd;
+  return r.buf + pos;
+}
+
+// n empfangene Bytes uebernehmen (n <= len aus tlmRingWritePtr)
+static inline void tlmRingCommit(TelemetryRing &r, size_t n) {
+  r.tail = (uint16_t)(r.tail + n);
+}
+
+/**
+ * @brief Eine Zeile [from, to) im Ring auswerten.
+ */
+static inline bool tlmParseLine(const TelemetryRing &r, uint16_t from, uint16_t to, TelemetryFrame &f) {
+  // Optionales '\r' vor dem '\n'
+  if (to != from && r.buf[(uint16_t)(to - 1) & TLM_RING_MASK] == '\r') to--;
+
+  f.fields = 0;
+  uint16_t i = from;
+
+  // Kennung "TLM"
+  static const char TAG[3] = { 'T', 'L', 'M' };
+  for (uint8_t k = 0; k < 3; k++, i++) {
+    if (i == to || r.buf[i & TLM_RING_MASK] != (uint8_t)TAG[k]) return false;
+  }
+
+  for (;;) {
+    // Leerzeichen zwischen den Feldern
+    if (i == to) break;
+    if (r.buf[i & TLM_RING_MASK] != ' ') return false;
+    while (i != to && r.buf[i & TLM_RING_MASK] == ' ') i++;
+    if (i == to) break;
+
+    // Name bis '=' (bis 4 Zeichen in ein Wort gepackt, laengere sind unbekannt)
+    uint32_t key = 0;
+    uint8_t keyLen = 0;
+    while (i != to && r.buf[i & TLM_RING_MASK] != '=') {
+      const uint8_t c = r.buf[i & TLM_RING_MASK];
+      if (c == ' ') return false;
+      if (keyLen < 4) key = (key << 8) | c;
+      keyLen++;
+      i++;
+    }
+    if (i == to || keyLen == 0) return false;
+    i++;   // '='
+
+    // Wert: optionales '-', 1..TLM_VALUE_DIGITS Ziffern
+    bool neg = false;
+    if (i != to && r.buf[i & TLM_RING_MASK] == '-') {
+      neg = true;
+      i++;
+    }
+    int32_t v = 0;
+    uint8_t digits = 0;
+    while (i != to && r.buf[i & TLM_RING_MASK] != ' ') {
+      const uint8_t c = r.buf[i & TLM_RING_MASK];
+      if (c < '0' || c > '9' || ++digits > TLM_VALUE_DIGITS) return false;
+      v = v * 10 + (c - '0');
+      i++;
+    }
+    if (digits == 0) return false;
+    if (neg) v = -v;
+    if (keyLen > 4) continue;
+
+    if (keyLen == 1 && key == 'S') {
+      if (v < INT16_MIN || v > INT16_MAX) return false;
+      f.sDbm = (int16_t)v;
+      f.fields |= TLM_S;
+    } else if (keyLen == 3 && key == (((uint32_t)'S' << 16) | ((uint32_t)'W' << 8) | 'R')) {
+      if (v < 0 || v > UINT16_MAX) return false;
+      f.swr100 = (uint16_t)v;
+      f.fields |= TLM_SWR;
+    } else if (keyLen == 3 && key == (((uint32_t)'F' << 16) | ((uint32_t)'W' << 8) | 'D')) {
+      if (v < 0 || v > UINT16_MAX) return false;
+      f.fwdDw = (uint16_t)v;
+      f.fields |= TLM_FWD;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Naechste vollstaendige Zeile auswerten und freigeben.
+ *
+ * Nacheinander aufrufen, bis TLM_PARSE_MORE kommt. Felder, die die Zeile nicht
+ * enthaelt, bleiben in frame unveraendert (fields zeigt, welche gesetzt wurden).
+ */
+static inline TelemetryParseResult tlmRingNext(TelemetryRing &r, TelemetryFrame &frame) {
+  for (;;) {
+    while (r.scan != r.tail && r.buf[r.scan & TLM_RING_MASK] != '\n') r.scan++;
+
+    if (r.scan == r.tail) {
+      // Ring voll ohne Zeilenende: Zeile passt nie hinein => verwerfen
+      if ((uint16_t)(r.tail - r.head) == TLM_RING_SIZE) {
+        if (!r.skip) r.overruns++;
+        r.skip = true;
+        r.head = r.tail;
+      }
+      return TLM_PARSE_MORE;
+    }
+
+    const uint16_t from = r.head;
+    const uint16_t to = r.scan;
+    r.head = r.scan = (uint16_t)(to + 1);
+
+    if (r.skip) {
+      r.skip = false;   // Rest der ueberlangen Zeile
+      continue;
+    }
+
+    TelemetryFrame f = frame;
+    if (!tlmParseLine(r, from, to, f)) return TLM_PARSE_BAD;
+    frame = f;
+    return TLM_PARSE_FRAME;
+  }
+}
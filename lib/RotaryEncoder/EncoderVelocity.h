@@ -0,0 +1,60 @@
+// lib/RotaryEncoder/EncoderVelocity.h
+//
+// Geschwindigkeitsschaetzung aus Schritt-Zeitstempeln (Schritte pro Sekunde).
+//
+// - Geglaetteter Schrittabstand (EMA, 1/4 neuer Wert)
+// - Richtungswechsel oder Pause > ENC_VELOCITY_IDLE_US startet die Schaetzung neu
+//
+// Header-only und ohne Arduino-Include: die GUI speist die ISR-Zeitstempel der
+// INPUT_ROTATE-Events aus der Input-Queue ein; laeuft auch auf dem Host.
+
+#pragma once
+#include <stdint.h>
+
+// Laengere Pause => Geschwindigkeit 0
+#ifndef ENC_VELOCITY_IDLE_US
+#define ENC_VELOCITY_IDLE_US 250000UL
+#endif
+
+struct EncoderVelocity {
+  uint32_t lastUs;       // Zeitstempel des letzten Schritts
+  uint32_t intervalUs;   // geglaetteter Schrittabstand (0 => keine Schaetzung)
+  int8_t lastDir;
+};
+
+static inline void encoderVelocityReset(EncoderVelocity &v) {
+  v.lastUs = 0;
+  v.intervalUs = 0;
+  v.lastDir = 0;
+}
+
+/**
+ * @brief Schritt einspeisen.
+ * @return geschaetzte Geschwindigkeit bei diesem Schritt (Schritte/s, 0 = keine)
+ */
+static inline uint32_t encoderVelocityFeed(EncoderVelocity &v, uint32_t us, int8_t dir) {
+  const uint32_t dt = us - v.lastUs;
+
+  if (v.lastDir != dir || dt > ENC_VELOCITY_IDLE_US) {
+    v.intervalUs = 0;                 // neu starten
+  } else if (dt == 0) {
+    // gleicher Zeitstempel: Schaetzung unveraendert
+  } else if (v.intervalUs == 0) {
+    v.intervalUs = dt;
+  } else {
+    // EMA: interval += (dt - interval) / 4
+    v.intervalUs = (uint32_t)((int32_t)v.intervalUs + (((int32_t)dt - (int32_t)v.intervalUs) >> 2));
+  }
+
+  v.lastUs = us;
+  v.lastDir = dir;
+  return (v.intervalUs > 0) ? (1000000UL / v.intervalUs) : 0;
+}
+
+/**
+ * @brief Geschwindigkeit zum Zeitpunkt nowUs (0 nach einer Pause).
+ */
+static inline uint32_t encoderVelocityAt(const EncoderVelocity &v, uint32_t nowUs) {
+  if (v.intervalUs == 0 || (nowUs - v.lastUs) > ENC_VELOCITY_IDLE_US) return 0;
+  return 1000000UL / v.intervalUs;
+}
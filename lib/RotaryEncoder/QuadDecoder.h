@@ -0,0 +1,87 @@
+// lib/RotaryEncoder/QuadDecoder.h
+//
+// Quadratur-Decoder (Gray-Code) als reine Zustandsmaschine.
+//
+// Prinzip:
+// - Jeder Pegelwechsel auf CLK (A) oder DT (B) liefert den neuen 2-Bit-Zustand (A<<1 | B).
+// - Eine 16er-Tabelle (alter Zustand, neuer Zustand) ergibt +1/-1 Viertelschritt,
+//   0 fuer "kein Wechsel" oder UNGUELTIG, wenn beide Bits gleichzeitig kippen
+//   (Prellen/verpasste Flanke). Ungueltige Uebergaenge werden verworfen und gezaehlt,
+//   statt Flanken zeitlich auszublenden.
+// - Viertelschritte werden aufsummiert; erst nach QUAD_QUARTERS_PER_STEP in eine
+//   Richtung entsteht ein Schritt. Prellen hin und zurueck hebt sich so auf.
+//
+// Wichtig:
+// - Header-only und ohne Arduino-Include: wird in die Encoder-ISR (IRAM) inlined
+//   und laeuft unveraendert auf dem Host (synthetische Flankenfolgen).
+// - Richtung wie bisher: nach einer CLK-Flanke gilt DT != CLK => +1.
+
+#pragma once
+#include <stdint.h>
+
+#ifdef ESP32
+#include <esp_attr.h>
+#define QUAD_DRAM_ATTR DRAM_ATTR   // Tabelle im RAM (ISR darf nicht aus dem Flash lesen)
+#else
+#define QUAD_DRAM_ATTR
+#endif
+
+// Viertelschritte pro gemeldetem Schritt (2 = Encoder mit Rastung pro halber Periode)
+#ifndef QUAD_QUARTERS_PER_STEP
+#define QUAD_QUARTERS_PER_STEP 2
+#endif
+
+// Markierung fuer ungueltige Uebergaenge in der Tabelle
+#define QUAD_INVALID 2
+
+struct QuadDecoder {
+  uint8_t state;       // letzter Zustand (A<<1 | B)
+  int8_t quarters;     // aufsummierte Viertelschritte seit dem letzten Schritt
+  uint32_t invalid;    // verworfene Uebergaenge (Diagnose)
+};
+
+/**
+ * @brief Startzustand setzen (aktuelle Pegel von A/B).
+ */
+static inline void quadDecoderInit(QuadDecoder &d, uint8_t ab) {
+  d.state = ab & 0x03;
+  d.quarters = 0;
+  d.invalid = 0;
+}
+
+/**
+ * @brief Neuen Pegelzustand einspeisen.
+ *
+ * @param ab  (A<<1 | B), A = CLK, B = DT
+ * @return +1/-1 wenn ein ganzer Schritt vollendet wurde, sonst 0
+ */
+static inline int8_t quadDecoderFeed(QuadDecoder &d, uint8_t ab) {
+  // Index = alter Zustand << 2 | neuer Zustand
+  // Vorwaerts: 11 -> 01 -> 00 -> 10 -> 11
+  static const int8_t QUAD_DRAM_ATTR table[16] = {
+     0, -1, +1, QUAD_INVALID,
+    +1,  0, QUAD_INVALID, -1,
+    -1, QUAD_INVALID,  0, +1,
+    QUAD_INVALID, +1, -1,  0
+  };
+
+  ab &= 0x03;
+  const int8_t q = table[(d.state << 2) | ab];
+  d.state = ab;
+
+  if (q == QUAD_INVALID) {
+    d.invalid++;
+    return 0;
+  }
+
+  d.quarters += q;
+  if (d.quarters >= QUAD_QUARTERS_PER_STEP) {
+    d.quarters -= QUAD_QUARTERS_PER_STEP;
+    return +1;
+  }
+  if (d.quarters <= -QUAD_QUARTERS_PER_STEP) {
+    d.quarters += QUAD_QUARTERS_PER_STEP;
+    return -1;
+  }
+  return 0;
+}
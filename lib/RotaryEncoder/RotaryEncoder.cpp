@@ -1,160 +1,76 @@
 // lib/RotaryEncoder/RotaryEncoder.cpp
 //
-// Rotary Encoder (CLK/DT) + Button (SW) als Eingabemodul.
+// Rotary Encoder (CLK/DT) als Eingabemodul.
 // Features:
-// - Robustere Auswertung des Drehimpulses (Quadratur-Encoder)
-// - Liefert "Delta" als Schrittanzahl seit letztem Update (z.B. -1 / +1)
-// - Button: Debounce + Short-Press + Long-Press
-// - Garantie: Long-Press loest KEIN Short-Press aus (analog zu NavButtons)
+// - Drehimpuls per Interrupt (CHANGE auf CLK und DT) + Quadratur-Tabelle (QuadDecoder.h)
+// - Jeder Schritt landet mit Zeitstempel in einem lock-freien SPSC-Ring (StepRing.h),
+//   Schritte gehen also nicht verloren, egal wie lange ein Frame dauert
+// - updateRotaryEncoder() überträgt die Schritte als INPUT_ROTATE-Events
+//   (Zeitstempel aus der ISR) in die gemeinsame Input-Queue (InputEvents.h)
+// - Der Encoder-Taster (SW) wird mit den anderen Front-Panel-Tastern in
+//   NavButtons entprellt (FRONT_KEY_PINS)
 //
 // Wichtige Hinweise fuer ESP32:
 // - CLK/DT sollten auf GPIOs liegen, die als Input geeignet sind.
-// - Manche Encoder sind "noisy": Entprellung/Filterung ist dann entscheidend.
-// - Diese Implementierung ist bewusst polling-basiert (kein Interrupt),
-//   um Komplexitaet zu reduzieren und in vielen Projekten stabil zu laufen.
+// - Prellen erzeugt ungueltige oder hin-und-zurueck-Uebergaenge; die Tabelle
+//   verwirft bzw. kompensiert diese (keine zeitliche Ausblendung mehr).
 
 #include "RotaryEncoder.h"
 #include <Arduino.h>
 #include <config.h>
 
-// --------------------
-// Tuning-Parameter
-// --------------------
-static const uint32_t ENC_DEBOUNCE_US = 800;   // Mindestzeit zwischen gültigen Encoder-Flanken (Noise-Filter)
-static const uint32_t BTN_DEBOUNCE_MS = 30;
-static const uint32_t BTN_LONGPRESS_MS = 700;
+#include <InputEvents.h>
+#include <EventLoop.h>
+
+#include "QuadDecoder.h"
+#include "StepRing.h"
 
 // --------------------
 // Interner Encoder-State
 // --------------------
-static int lastClk = HIGH;
-static int lastDt  = HIGH;
-
-static volatile int32_t deltaAccum = 0;   // akkumuliertes Delta seit letzter Abfrage
-
-static uint32_t lastEncUs = 0;            // Zeitstempel für Noise-Filter (micros())
-
-// Button-State (wie bei NavButtons)
-struct BtnState {
-  int lastStable;
-  int lastReading;
-  uint32_t lastChangeMs;
-
-  bool shortEvent;
-  bool longEvent;
-
-  uint32_t downMs;
-  bool longFired;
-};
-
-static BtnState btn;
-
-/**
- * @brief Initialisiert den Buttonstate und Pin.
- */
-static void initButton() {
-  pinMode(ENC_SW, INPUT_PULLUP);
-
-  int r = digitalRead(ENC_SW);
-  btn.lastReading = r;
-  btn.lastStable = r;
-  btn.lastChangeMs = millis();
-
-  btn.shortEvent = false;
-  btn.longEvent = false;
-
-  btn.downMs = 0;
-  btn.longFired = false;
-}
+// decoder: nur in der ISR, steps: ISR (Producer) -> loop() (Consumer)
+static QuadDecoder decoder;
+static StepRing steps;
 
 /**
- * @brief Pollt den Button und erzeugt Short-/Long-Events.
- *
- * Short-Press: beim Loslassen, nur wenn kein Long-Press
- * Long-Press : einmalig nach BTN_LONGPRESS_MS
+ * @brief Überträgt alle Schritte aus dem ISR-Ring als Events in die Input-Queue.
  */
-static void updateButton() {
-  int r = digitalRead(ENC_SW);
-
-  if (r != btn.lastReading) {
-    btn.lastReading = r;
-    btn.lastChangeMs = millis();
-  }
-
-  if ((millis() - btn.lastChangeMs) > BTN_DEBOUNCE_MS) {
-    if (btn.lastStable != btn.lastReading) {
-      btn.lastStable = btn.lastReading;
-
-      if (btn.lastStable == LOW) {
-        btn.downMs = millis();
-        btn.longFired = false;
-      } else {
-        if (btn.downMs != 0 && !btn.longFired) {
-          btn.shortEvent = true;
-        }
-        btn.downMs = 0;
-        btn.longFired = false;
-      }
-    }
-  }
-
-  if (btn.lastStable == LOW && btn.downMs != 0 && !btn.longFired) {
-    if (millis() - btn.downMs >= BTN_LONGPRESS_MS) {
-      btn.longFired = true;
-      btn.longEvent = true;
-    }
+static void transferSteps() {
+  EncoderStep s;
+  while (stepRingPop(steps, s)) {
+    inputPush(INPUT_SRC_ENCODER, INPUT_ROTATE, s.us, s.dir);
   }
 }
 
+// Decoder wird von der ISR und von resyncRotaryEncoder() gespeist
+#ifdef ESP32
+static portMUX_TYPE decoderMux = portMUX_INITIALIZER_UNLOCKED;
+#define DECODER_LOCK()   portENTER_CRITICAL_SAFE(&decoderMux)
+#define DECODER_UNLOCK() portEXIT_CRITICAL_SAFE(&decoderMux)
+#else
+#define DECODER_LOCK()
+#define DECODER_UNLOCK()
+#endif
+
 /**
- * @brief "Consume" eines Event-Flags.
+ * @brief Liest beide Pegel, speist den Decoder und legt einen vollendeten
+ *        Schritt mit Zeitstempel in den Ring (weckt dann die Hauptschleife).
  */
-static bool take(bool &flag) {
-  bool v = flag;
-  flag = false;
-  return v;
+static void IRAM_ATTR sampleEncoder() {
+  DECODER_LOCK();
+  const uint8_t ab = (uint8_t)((digitalRead(ENC_CLK) << 1) | digitalRead(ENC_DT));
+  const int8_t step = quadDecoderFeed(decoder, ab);
+  if (step != 0) stepRingPush(steps, micros(), step);
+  DECODER_UNLOCK();
+
+  if (step != 0) eventLoopSignal();
 }
 
 /**
- * @brief Encoder-Schritt berechnen (Quadratur).
- *
- * Vereinfachtes Prinzip:
- * - Wir werten eine Flanke auf CLK aus.
- * - Die Richtung ergibt sich aus dem Zustand von DT zur Flankenzeit.
- *
- * Wichtig:
- * - Manche Encoder liefern 2 oder 4 Flanken pro Rastung.
- *   Wenn dir das zu "schnell" ist, kann man die Auswertung anpassen.
+ * @brief Encoder-ISR: bei jedem Pegelwechsel auf CLK oder DT.
  */
-static void updateEncoder() {
-  int clk = digitalRead(ENC_CLK);
-  int dt  = digitalRead(ENC_DT);
-
-  // Noise-Filter: nur wenn ausreichend Zeit seit letztem Ereignis vergangen ist
-  uint32_t nowUs = micros();
-  if ((nowUs - lastEncUs) < ENC_DEBOUNCE_US) {
-    lastClk = clk;
-    lastDt = dt;
-    return;
-  }
-
-  // Erkennung: CLK hat eine Flanke (typisch FALLING)
-  // Du kannst auch RISING nutzen; wichtig ist konsistent.
-  if (clk != lastClk) {
-    lastEncUs = nowUs;
-
-    // Richtung:
-    // Bei vielen Encodern gilt: wenn DT != CLK -> eine Richtung, sonst die andere.
-    // Falls Richtung bei dir invertiert ist: Vorzeichen hier tauschen.
-    if (dt != clk) {
-      deltaAccum += 1;
-    } else {
-      deltaAccum -= 1;
-    }
-  }
-
-  lastClk = clk;
-  lastDt = dt;
+static void IRAM_ATTR encoderIsr() {
+  sampleEncoder();
 }
 
 // --------------------
@@ -162,70 +78,44 @@ static void updateEncoder() {
 // --------------------
 
 /**
- * @brief Initialisiert Pins für Rotary Encoder + Button.
+ * @brief Initialisiert die Pins des Rotary Encoders.
  *
  * Erwartete Verdrahtung:
  * - ENC_CLK und ENC_DT: Encoder-Ausgänge
- * - ENC_SW: Taster gegen GND
  * - Alle Eingänge mit INPUT_PULLUP (Ruhestand HIGH, gedrückt/aktiv LOW)
  */
 void initRotaryEncoder() {
   pinMode(ENC_CLK, INPUT_PULLUP);
   pinMode(ENC_DT,  INPUT_PULLUP);
 
-  lastClk = digitalRead(ENC_CLK);
-  lastDt  = digitalRead(ENC_DT);
-
-  deltaAccum = 0;
-  lastEncUs = micros();
+  stepRingInit(steps);
+  quadDecoderInit(decoder, (uint8_t)((digitalRead(ENC_CLK) << 1) | digitalRead(ENC_DT)));
 
-  initButton();
+  attachInterrupt(digitalPinToInterrupt(ENC_CLK), encoderIsr, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(ENC_DT),  encoderIsr, CHANGE);
 }
 
 /**
  * @brief Muss zyklisch in loop() aufgerufen werden.
- *        Pollt Encoder und Button und aktualisiert interne Events.
+ *        Überträgt die Drehschritte (kommen per Interrupt).
  */
 void updateRotaryEncoder() {
-  updateEncoder();
-  updateButton();
+  transferSteps();
 }
 
 /**
- * @brief Liefert die seit dem letzten Aufruf aufgelaufene Drehbewegung (Delta) und setzt sie zurück.
+ * @brief Pegel jetzt einlesen, als wäre eine Flanke gekommen.
  *
- * Beispiel:
- * - Rückgabe +1: eine Rastung im Uhrzeigersinn
- * - Rückgabe -1: eine Rastung gegen den Uhrzeigersinn
- *
- * Hinweis:
- * - Wenn dein Encoder "zu fein" ist (z.B. 2 oder 4 Schritte pro Rastung),
- *   kannst du hier skalieren (z.B. nur jedes zweite Event zählen).
+ * Nach dem Light Sleep: die Flanke, die geweckt hat, kann vor dem
+ * Wiederanlaufen der Interrupts gelegen haben.
  */
-int32_t getEncoderDelta() {
-  int32_t d = deltaAccum;
-  deltaAccum = 0;
-  return d;
+void resyncRotaryEncoder() {
+  sampleEncoder();
 }
 
 /**
- * @brief true genau einmal, wenn ein Short-Press erkannt wurde (und kein Long-Press).
+ * @brief Diagnose: verworfene ungültige Übergänge / wegen vollem Ring verlorene Schritte.
  */
-bool getButtonPressed() {
-  return take(btn.shortEvent);
-}
+uint32_t getEncoderInvalidCount() { return decoder.invalid; }
+uint32_t getEncoderDroppedCount() { return steps.dropped.load(std::memory_order_relaxed); }
 
-/**
- * @brief true genau einmal, wenn ein Long-Press erkannt wurde.
- *        (Long-Press unterdrückt Short-Press.)
- */
-bool getButtonLongPressed() {
-  return take(btn.longEvent);
-}
-
-/**
- * @brief Optional: liefert aktuellen stabilen Button-Zustand (gedrückt?)
- */
-bool isButtonDown() {
-  return (btn.lastStable == LOW);
-}
@@ -7,16 +7,19 @@
 // Initialisieren (Pins aus config.h)
 void initRotaryEncoder();
 
-// Muss zyklisch in loop() aufgerufen werden
+// Muss zyklisch in loop() aufgerufen werden: überträgt Drehschritte in die
+// Input-Queue (InputEvents.h)
+//   INPUT_SRC_ENCODER    : INPUT_ROTATE (value = +1/-1 pro Rastung)
+// Der Encoder-Taster (ENC_SW) läuft über NavButtons (INPUT_SRC_ENC_BUTTON).
 void updateRotaryEncoder();
 
-// Dreh-Event seit letztem Abruf (typisch -1/0/+1 pro Rastung)
-int32_t getEncoderDelta();
+// Pegel sofort auswerten (nach Light Sleep, falls die Weck-Flanke verloren ging)
+void resyncRotaryEncoder();
 
-// Button-Events
-bool getButtonPressed();        // SHORT press (nur wenn KEIN Long-Press)
-bool getButtonLongPressed();    // LONG press (einmalig, sobald Zeit erreicht)
-bool isButtonDown();            // aktueller stabiler Zustand
+// Diagnose (Serial 'l' in main.cpp): ungültige Quadratur-Übergänge /
+// verlorene Schritte (Ring voll)
+uint32_t getEncoderInvalidCount();
+uint32_t getEncoderDroppedCount();
 
 // Debug Helpers (optional)
 int readEncoderCLK();
@@ -0,0 +1,72 @@
+// lib/RotaryEncoder/StepRing.h
+//
+// Lock-freier Single-Producer/Single-Consumer-Ring fuer Encoder-Schritte.
+//
+// - Producer: Encoder-ISR (stepRingPush), Consumer: loop()/GUI (stepRingPop).
+// - head wird nur vom Producer, tail nur vom Consumer geschrieben; die
+//   Sichtbarkeit regeln acquire/release-Atomics (kein Interrupt-Sperren noetig).
+// - Ring voll => neuer Schritt wird verworfen und in "dropped" gezaehlt.
+//
+// Header-only, damit Push in die ISR (IRAM) inlined wird; laeuft auch auf dem Host.
+
+#pragma once
+#include <stdint.h>
+#include <atomic>
+
+// Kapazitaet (Zweierpotenz)
+#ifndef STEP_RING_SIZE
+#define STEP_RING_SIZE 64
+#endif
+
+static_assert((STEP_RING_SIZE & (STEP_RING_SIZE - 1)) == 0, "STEP_RING_SIZE muss 2^n sein");
+
+struct EncoderStep {
+  uint32_t us;   // micros() beim Schritt
+  int8_t dir;    // +1 / -1
+};
+
+struct StepRing {
+  EncoderStep buf[STEP_RING_SIZE];
+  std::atomic<uint32_t> head;      // naechster Schreibplatz (Producer)
+  std::atomic<uint32_t> tail;      // naechster Leseplatz (Consumer)
+  std::atomic<uint32_t> dropped;   // verworfene Schritte (Ring voll)
+};
+
+static inline void stepRingInit(StepRing &r) {
+  r.head.store(0, std::memory_order_relaxed);
+  r.tail.store(0, std::memory_order_relaxed);
+  r.dropped.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Producer (ISR): Schritt anhaengen. false => Ring voll.
+ */
+static inline bool stepRingPush(StepRing &r, uint32_t us, int8_t dir) {
+  const uint32_t head = r.head.load(std::memory_order_relaxed);
+  const uint32_t tail = r.tail.load(std::memory_order_acquire);
+
+  if (head - tail >= STEP_RING_SIZE) {
+    r.dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  EncoderStep &s = r.buf[head & (STEP_RING_SIZE - 1)];
+  s.us = us;
+  s.dir = dir;
+  r.head.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+/**
+ * @brief Consumer: aeltesten Schritt entnehmen. false => Ring leer.
+ */
+static inline bool stepRingPop(StepRing &r, EncoderStep &out) {
+  const uint32_t tail = r.tail.load(std::memory_order_relaxed);
+  const uint32_t head = r.head.load(std::memory_order_acquire);
+
+  if (tail == head) return false;
+
+  out = r.buf[tail & (STEP_RING_SIZE - 1)];
+  r.tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
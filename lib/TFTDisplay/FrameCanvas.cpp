@@ -0,0 +1,177 @@
+// lib/TFTDisplay/FrameCanvas.cpp
+//
+// Off-Screen-Puffer (siehe FrameCanvas.h).
+
+#ifdef ARDUINO  // benoetigt Adafruit_GFX
+
+#include "FrameCanvas.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// -----------------------------------------------------------------------------
+// RgbCanvas16
+// -----------------------------------------------------------------------------
+void RgbCanvas16::readRow565(int16_t x, int16_t y, int16_t w, uint16_t* out) {
+  memcpy(out, &getBuffer()[(int32_t)y * width() + x], (size_t)w * sizeof(uint16_t));
+}
+
+void RgbCanvas16::writeRow565(int16_t x, int16_t y, int16_t w, const uint16_t* in) {
+  memcpy(&getBuffer()[(int32_t)y * width() + x], in, (size_t)w * sizeof(uint16_t));
+}
+
+void RgbCanvas16::writeMask(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t* bits,
+                            uint16_t stride, int16_t sx, int16_t sy, uint16_t fg, uint16_t bg) {
+  for (int16_t row = 0; row < h; row++) {
+    const uint8_t* m = &bits[(size_t)(sy + row) * stride];
+    uint16_t* out = &getBuffer()[(int32_t)(y + row) * width() + x];
+    for (int16_t i = 0; i < w; i++) {
+      const int16_t b = sx + i;
+      out[i] = (m[b >> 3] & (0x80 >> (b & 7))) ? fg : bg;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// IndexedCanvas4
+// -----------------------------------------------------------------------------
+IndexedCanvas4::IndexedCanvas4(uint16_t w, uint16_t h)
+  : Adafruit_GFX(w, h), used(1), lastColor(0), lastIndex(0) {
+  buffer = (uint8_t*)calloc(((uint32_t)w * h + 1) / 2, 1);
+  memset(palette, 0, sizeof(palette));   // Slot 0 = schwarz
+}
+
+IndexedCanvas4::~IndexedCanvas4() {
+  free(buffer);
+}
+
+/**
+ * @brief Quadratischer Abstand zweier RGB565-Farben (fuer volle Palette).
+ */
+static int32_t colorDist(uint16_t a, uint16_t b) {
+  const int32_t dr = (int32_t)(a >> 11) - (int32_t)(b >> 11);
+  const int32_t dg = (int32_t)((a >> 5) & 0x3F) - (int32_t)((b >> 5) & 0x3F);
+  const int32_t db = (int32_t)(a & 0x1F) - (int32_t)(b & 0x1F);
+  return 4 * dr * dr + dg * dg + 4 * db * db;   // 5/6/5 Bit grob angleichen
+}
+
+uint8_t IndexedCanvas4::indexFor(uint16_t color) {
+  if (color == lastColor) return lastIndex;
+
+  uint8_t idx = 0;
+  bool found = false;
+  for (uint8_t i = 0; i < used; i++) {
+    if (palette[i] == color) { idx = i; found = true; break; }
+  }
+
+  if (!found) {
+    if (used < 16) {
+      idx = used;
+      palette[used++] = color;
+    } else {
+      int32_t best = INT32_MAX;
+      for (uint8_t i = 0; i < used; i++) {
+        const int32_t d = colorDist(palette[i], color);
+        if (d < best) { best = d; idx = i; }
+      }
+    }
+  }
+
+  lastColor = color;
+  lastIndex = idx;
+  return idx;
+}
+
+int8_t IndexedCanvas4::paletteSlot(uint16_t color) {
+  return (int8_t)indexFor(color);
+}
+
+void IndexedCanvas4::setPalette(uint8_t slot, uint16_t color) {
+  if (slot >= 16) return;
+  palette[slot] = color;
+  if (slot >= used) used = slot + 1;
+
+  // Cache kann jetzt auf einen umgefaerbten Slot zeigen
+  lastColor = palette[0];
+  lastIndex = 0;
+}
+
+void IndexedCanvas4::setIndex(int32_t p, uint8_t idx) {
+  uint8_t &b = buffer[p >> 1];
+  if (p & 1) b = (uint8_t)((b & 0xF0) | idx);
+  else b = (uint8_t)((b & 0x0F) | (idx << 4));
+}
+
+/**
+ * @brief Fuellt eine (bereits geclippte) Zeilenstrecke: Randpixel einzeln,
+ *        dazwischen ganze Bytes per memset.
+ */
+void IndexedCanvas4::fillSpan(int16_t x, int16_t y, int16_t w, uint8_t idx) {
+  int32_t p = (int32_t)y * WIDTH + x;
+  int32_t end = p + w;
+
+  if (p & 1) setIndex(p++, idx);
+  if (end > p && (end & 1)) setIndex(--end, idx);
+  if (end > p) memset(&buffer[p >> 1], (idx << 4) | idx, (size_t)(end - p) >> 1);
+}
+
+void IndexedCanvas4::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (!buffer || x < 0 || y < 0 || x >= WIDTH || y >= HEIGHT) return;
+  setIndex((int32_t)y * WIDTH + x, indexFor(color));
+}
+
+void IndexedCanvas4::fillScreen(uint16_t color) {
+  if (!buffer) return;
+  const uint8_t idx = indexFor(color);
+  memset(buffer, (idx << 4) | idx, ((uint32_t)WIDTH * HEIGHT + 1) / 2);
+}
+
+void IndexedCanvas4::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (!buffer) return;
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > WIDTH)  w = WIDTH - x;
+  if (y + h > HEIGHT) h = HEIGHT - y;
+  if (w <= 0 || h <= 0) return;
+
+  const uint8_t idx = indexFor(color);
+  for (int16_t row = y; row < y + h; row++) fillSpan(x, row, w, idx);
+}
+
+void IndexedCanvas4::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  fillRect(x, y, w, 1, color);
+}
+
+void IndexedCanvas4::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  fillRect(x, y, 1, h, color);
+}
+
+void IndexedCanvas4::readRow565(int16_t x, int16_t y, int16_t w, uint16_t* out) {
+  int32_t p = (int32_t)y * WIDTH + x;
+  for (int16_t i = 0; i < w; i++, p++) {
+    const uint8_t b = buffer[p >> 1];
+    out[i] = palette[(p & 1) ? (b & 0x0F) : (b >> 4)];
+  }
+}
+
+void IndexedCanvas4::writeRow565(int16_t x, int16_t y, int16_t w, const uint16_t* in) {
+  int32_t p = (int32_t)y * WIDTH + x;
+  for (int16_t i = 0; i < w; i++, p++) setIndex(p, indexFor(in[i]));
+}
+
+void IndexedCanvas4::writeMask(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t* bits,
+                               uint16_t stride, int16_t sx, int16_t sy, uint16_t fg, uint16_t bg) {
+  const uint8_t fgIdx = indexFor(fg);
+  const uint8_t bgIdx = indexFor(bg);
+
+  for (int16_t row = 0; row < h; row++) {
+    const uint8_t* m = &bits[(size_t)(sy + row) * stride];
+    int32_t p = (int32_t)(y + row) * WIDTH + x;
+    for (int16_t i = 0; i < w; i++, p++) {
+      const int16_t b = sx + i;
+      setIndex(p, (m[b >> 3] & (0x80 >> (b & 7))) ? fgIdx : bgIdx);
+    }
+  }
+}
+
+#endif // ARDUINO
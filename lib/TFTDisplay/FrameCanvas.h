@@ -0,0 +1,86 @@
+// lib/TFTDisplay/FrameCanvas.h
+//
+// Off-Screen-Puffer fuer den Framebuffer-Modus von TFTDisplay.
+//
+// Zwei Varianten mit gleicher Zeilen-Schnittstelle (readRow565 / writeRow565 /
+// writeMask):
+// - RgbCanvas16:    RGB565, 2 Byte pro Pixel (160x128 => 40 KB)
+// - IndexedCanvas4: 4 Bit Palettenindex pro Pixel (160x128 => 10 KB),
+//                   Palette mit 16 RGB565-Eintraegen, Aufloesung beim Flush
+//
+// Beide sind Adafruit_GFX-Ziele, Text/Linien/Rechtecke kommen also unveraendert
+// aus der Adafruit-Library.
+
+#pragma once
+#include <Adafruit_GFX.h>
+#include <stdint.h>
+
+/**
+ * RGB565-Puffer (GFXcanvas16 + Zeilenzugriff).
+ */
+class RgbCanvas16 : public GFXcanvas16 {
+public:
+  RgbCanvas16(uint16_t w, uint16_t h) : GFXcanvas16(w, h) {}
+
+  bool ok() { return getBuffer() != nullptr; }
+
+  void readRow565(int16_t x, int16_t y, int16_t w, uint16_t* out);
+  void writeRow565(int16_t x, int16_t y, int16_t w, const uint16_t* in);
+  void writeMask(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t* bits,
+                 uint16_t stride, int16_t sx, int16_t sy, uint16_t fg, uint16_t bg);
+};
+
+/**
+ * 4bpp-Puffer mit 16-Farben-Palette.
+ *
+ * - Zeichenfarben (RGB565) werden beim Zeichnen auf einen Slot abgebildet:
+ *   vorhandener Eintrag, sonst naechster freier Slot, sonst naechste Farbe.
+ * - Slot 0 ist schwarz (Puffer startet mit 0).
+ * - setPalette() faerbt alle Pixel eines Slots um, ohne neu zu zeichnen.
+ */
+class IndexedCanvas4 : public Adafruit_GFX {
+public:
+  IndexedCanvas4(uint16_t w, uint16_t h);
+  ~IndexedCanvas4();
+
+  bool ok() { return buffer != nullptr; }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+
+  void readRow565(int16_t x, int16_t y, int16_t w, uint16_t* out);
+  void writeRow565(int16_t x, int16_t y, int16_t w, const uint16_t* in);
+
+  /**
+   * 1-Bit-Maske (Bit gesetzt = fg, sonst bg) als Palettenindizes schreiben.
+   * fg/bg werden einmal pro Aufruf aufgeloest, nicht pro Pixel.
+   *
+   * @param x,y,w,h  Zielbereich (bereits geclippt)
+   * @param bits     Maske, Zeilen auf ganze Bytes aufgefuellt, MSB = linkes Pixel
+   * @param stride   Bytes pro Maskenzeile
+   * @param sx,sy    Startpixel in der Maske
+   */
+  void writeMask(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t* bits,
+                 uint16_t stride, int16_t sx, int16_t sy, uint16_t fg, uint16_t bg);
+
+  // Palette
+  int8_t paletteSlot(uint16_t color);          // finden/anlegen (-1 nie, voll => naechste)
+  void setPalette(uint8_t slot, uint16_t color);
+  uint8_t paletteUsed() const { return used; }
+
+private:
+  uint8_t indexFor(uint16_t color);
+  void setIndex(int32_t p, uint8_t idx);
+  void fillSpan(int16_t x, int16_t y, int16_t w, uint8_t idx);
+
+  uint8_t* buffer;
+  uint16_t palette[16];
+  uint8_t used;
+
+  // Cache fuer die letzte Farbzuordnung (Text/Flaechen nutzen meist eine Farbe)
+  uint16_t lastColor;
+  uint8_t lastIndex;
+};
@@ -0,0 +1,115 @@
+// lib/TFTDisplay/GlyphAtlas.cpp
+//
+// Glyph-Atlas (siehe GlyphAtlas.h).
+// Rastern und Blitten laufen ueber TFTDisplay (rasterizeCharMask / blitMask),
+// damit das Atlas nichts von Adafruit oder dem Framebuffer wissen muss.
+// Gespeichert wird nur die Deckung (1 Bit/Pixel) plus Vorder-/Hintergrundfarbe:
+// Wert-Schrift (size 3, 11 Zeichen) ~1.2 KB statt ~9.5 KB als RGB565, und der
+// 4bpp-Framebuffer bekommt beim Blitten direkt zwei Palettenindizes.
+
+#include "GlyphAtlas.h"
+#include "TFTDisplay.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// --------------------
+// Interner Atlas-State
+// --------------------
+struct AtlasFont {
+  int8_t index[128];      // ASCII -> Glyph-Index (-1 = nicht im Satz)
+  int16_t glyphW;
+  int16_t glyphH;
+  uint16_t glyphBytes;    // maskStride(glyphW) * glyphH
+  uint8_t fg[3];          // Vordergrund (RGB888)
+  uint8_t bg[3];          // Hintergrund (RGB888)
+  uint8_t* bits;          // count * glyphBytes (1-Bit-Masken)
+};
+
+static AtlasFont fonts[GLYPH_ATLAS_MAX_FONTS];
+static uint8_t fontCount = 0;
+
+static const AtlasFont* fontById(int8_t font) {
+  if (font < 0 || font >= (int8_t)fontCount) return nullptr;
+  return &fonts[font];
+}
+
+int8_t glyphAtlasBuild(const char* chars, uint8_t size,
+                       uint8_t r, uint8_t g, uint8_t b,
+                       uint8_t bgR, uint8_t bgG, uint8_t bgB) {
+  if (fontCount >= GLYPH_ATLAS_MAX_FONTS || size == 0) return -1;
+
+  size_t count = strlen(chars);
+  if (count == 0 || count > GLYPH_ATLAS_MAX_CHARS) return -1;
+
+  AtlasFont &f = fonts[fontCount];
+  f.glyphW = 6 * size;
+  f.glyphH = 8 * size;
+
+  f.glyphBytes = (uint16_t)(maskStride(f.glyphW) * f.glyphH);
+  f.bits = (uint8_t*)malloc(count * f.glyphBytes);
+  if (!f.bits) return -1;
+
+  f.fg[0] = r;
+  f.fg[1] = g;
+  f.fg[2] = b;
+  f.bg[0] = bgR;
+  f.bg[1] = bgG;
+  f.bg[2] = bgB;
+
+  memset(f.index, -1, sizeof(f.index));
+  for (size_t i = 0; i < count; i++) {
+    const unsigned char c = (unsigned char)chars[i];
+    if (c < 128) f.index[c] = (int8_t)i;
+    rasterizeCharMask(chars[i], size, &f.bits[i * f.glyphBytes]);
+  }
+
+  return (int8_t)fontCount++;
+}
+
+bool glyphAtlasDrawChar(int8_t font, char c, int16_t x, int16_t y) {
+  const AtlasFont* f = fontById(font);
+  if (!f) return false;
+
+  const unsigned char uc = (unsigned char)c;
+  const int8_t idx = (uc < 128) ? f->index[uc] : -1;
+  if (idx < 0) return false;
+
+  blitMask(x, y, f->glyphW, f->glyphH, &f->bits[idx * f->glyphBytes],
+           f->fg[0], f->fg[1], f->fg[2], f->bg[0], f->bg[1], f->bg[2]);
+  return true;
+}
+
+bool glyphAtlasDraw(int8_t font, const char* text, int16_t x, int16_t y) {
+  const AtlasFont* f = fontById(font);
+  if (!f) return false;
+
+  bool ok = true;
+  for (const char* p = text; *p; p++) {
+    if (!glyphAtlasDrawChar(font, *p, x, y)) ok = false;
+    x += f->glyphW;
+  }
+  return ok;
+}
+
+int16_t glyphAtlasGlyphW(int8_t font) {
+  const AtlasFont* f = fontById(font);
+  return f ? f->glyphW : 0;
+}
+
+int16_t glyphAtlasGlyphH(int8_t font) {
+  const AtlasFont* f = fontById(font);
+  return f ? f->glyphH : 0;
+}
+
+int16_t glyphAtlasTextWidth(int8_t font, uint8_t len) {
+  return (int16_t)(glyphAtlasGlyphW(font) * len);
+}
+
+void glyphAtlasClear() {
+  for (uint8_t i = 0; i < fontCount; i++) {
+    free(fonts[i].bits);
+    fonts[i].bits = nullptr;
+  }
+  fontCount = 0;
+}
@@ -0,0 +1,54 @@
+// lib/TFTDisplay/GlyphAtlas.h
+//
+// Vorgerasterte Glyphen (1-Bit-Deckung + Farbpaar) fuer haeufig gezeichnete, grosse Zeichen
+// (z.B. Frequenzziffern bei value_size = 3).
+//
+// Hintergrund:
+// - Adafruit print() zeichnet bei size > 1 jedes Glyph-Pixel als eigenes fillRect
+//   (eigenes SPI-Window pro Pixel).
+// - Das Atlas rastert die Zeichen EINMAL (z.B. in guiInit()) inkl. Hintergrund
+//   und blittet danach jede Glyphe mit genau einem Window-Write.
+
+#pragma once
+#include <stdint.h>
+
+// Max. Anzahl Glyph-Saetze (Schriftgroesse + Farbe)
+#define GLYPH_ATLAS_MAX_FONTS 4
+
+// Max. Zeichen pro Glyph-Satz
+#define GLYPH_ATLAS_MAX_CHARS 16
+
+/**
+ * Rastert einen Glyph-Satz (Default-Font 6x8, skaliert mit size).
+ *
+ * @param chars     Zeichen des Satzes (z.B. "0123456789.")
+ * @param size      Textgroesse (wie drawText)
+ * @param r,g,b     Vordergrundfarbe
+ * @param bgR..bgB  Hintergrundfarbe (Glyph-Zellen sind deckend)
+ * @return Font-ID (>= 0) oder -1 (voll / kein RAM)
+ */
+int8_t glyphAtlasBuild(const char* chars, uint8_t size,
+                       uint8_t r, uint8_t g, uint8_t b,
+                       uint8_t bgR, uint8_t bgG, uint8_t bgB);
+
+/**
+ * Zeichnet Text aus dem Atlas (eine Zelle pro Zeichen, deckend).
+ *
+ * @return false wenn ein Zeichen nicht im Satz ist (Zelle wird uebersprungen)
+ */
+bool glyphAtlasDraw(int8_t font, const char* text, int16_t x, int16_t y);
+
+/**
+ * Zeichnet genau ein Zeichen (z.B. fuer zeichenweise Updates).
+ */
+bool glyphAtlasDrawChar(int8_t font, char c, int16_t x, int16_t y);
+
+// Zellmasse des Satzes (inkl. 1 Spalte Zeichenabstand), 0 bei ungueltiger ID
+int16_t glyphAtlasGlyphW(int8_t font);
+int16_t glyphAtlasGlyphH(int8_t font);
+
+// Breite eines Textes mit len Zeichen (ohne strlen, feste Zellbreite)
+int16_t glyphAtlasTextWidth(int8_t font, uint8_t len);
+
+// Gibt alle Glyph-Saetze frei (z.B. vor Theme-Wechsel)
+void glyphAtlasClear();
@@ -0,0 +1,79 @@
+// lib/TFTDisplay/TFTDirtyRects.cpp
+//
+// Dirty-Rechteck-Verwaltung (siehe TFTDirtyRects.h).
+
+#include "TFTDirtyRects.h"
+
+static int32_t rectArea(const TftRect &r) {
+  return (int32_t)(r.x1 - r.x0 + 1) * (int32_t)(r.y1 - r.y0 + 1);
+}
+
+static TftRect rectUnion(const TftRect &a, const TftRect &b) {
+  TftRect u;
+  u.x0 = (a.x0 < b.x0) ? a.x0 : b.x0;
+  u.y0 = (a.y0 < b.y0) ? a.y0 : b.y0;
+  u.x1 = (a.x1 > b.x1) ? a.x1 : b.x1;
+  u.y1 = (a.y1 > b.y1) ? a.y1 : b.y1;
+  return u;
+}
+
+// Flaeche der Schnittmenge (0, wenn disjunkt)
+static int32_t intersectArea(const TftRect &a, const TftRect &b) {
+  const int16_t x0 = (a.x0 > b.x0) ? a.x0 : b.x0;
+  const int16_t y0 = (a.y0 > b.y0) ? a.y0 : b.y0;
+  const int16_t x1 = (a.x1 < b.x1) ? a.x1 : b.x1;
+  const int16_t y1 = (a.y1 < b.y1) ? a.y1 : b.y1;
+  if (x0 > x1 || y0 > y1) return 0;
+  return (int32_t)(x1 - x0 + 1) * (int32_t)(y1 - y0 + 1);
+}
+
+/**
+ * @brief Zusammenfassen lohnt sich, wenn die Vereinigung genau die Pixel
+ *        beider Rechtecke abdeckt (eines enthaelt das andere, oder gleich
+ *        breit/hoch und ueberlappend bzw. buendig aneinander). Die Schnittmenge
+ *        zaehlt dabei nur einmal. Dann spart man ein Address-Window, ohne
+ *        zusaetzliche Pixel zu senden.
+ */
+static bool mergeIsFree(const TftRect &a, const TftRect &b) {
+  return rectArea(rectUnion(a, b)) <= rectArea(a) + rectArea(b) - intersectArea(a, b);
+}
+
+void tftDirtyAdd(TftDirtyList &list, int16_t x, int16_t y, int16_t w, int16_t h,
+                 int16_t screenW, int16_t screenH) {
+  if (w <= 0 || h <= 0) return;
+
+  TftRect r;
+  r.x0 = (x < 0) ? 0 : x;
+  r.y0 = (y < 0) ? 0 : y;
+  r.x1 = (x + w - 1 >= screenW) ? (screenW - 1) : (x + w - 1);
+  r.y1 = (y + h - 1 >= screenH) ? (screenH - 1) : (y + h - 1);
+  if (r.x0 > r.x1 || r.y0 > r.y1) return;
+
+  // So lange zusammenfassen, bis keine kostenlose Vereinigung mehr moeglich ist
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (uint8_t i = 0; i < list.count; i++) {
+      if (mergeIsFree(list.rects[i], r)) {
+        r = rectUnion(list.rects[i], r);
+        list.rects[i] = list.rects[--list.count];
+        merged = true;
+        break;
+      }
+    }
+  }
+
+  if (list.count < TFT_DIRTY_RECTS) {
+    list.rects[list.count++] = r;
+    return;
+  }
+
+  // Liste voll: mit dem Rechteck vereinigen, das den kleinsten Flaechenzuwachs ergibt
+  uint8_t best = 0;
+  int32_t bestCost = INT32_MAX;
+  for (uint8_t i = 0; i < list.count; i++) {
+    int32_t cost = rectArea(rectUnion(list.rects[i], r)) - rectArea(list.rects[i]);
+    if (cost < bestCost) { bestCost = cost; best = i; }
+  }
+  list.rects[best] = rectUnion(list.rects[best], r);
+}
@@ -0,0 +1,38 @@
+// lib/TFTDisplay/TFTDirtyRects.h
+//
+// Verwaltung der Dirty-Rechtecke fuer den Framebuffer-Modus.
+//
+// Hardwareunabhaengig, damit Firmware (TFTDisplay.cpp) und Host-Backend
+// (TFTDisplayHost.cpp) exakt dieselben Rechtecke und damit dieselben
+// SPI-Kosten erzeugen.
+
+#pragma once
+#include <stdint.h>
+#include <config.h>
+
+#ifndef TFT_DIRTY_RECTS
+#define TFT_DIRTY_RECTS 8
+#endif
+
+/**
+ * Rechteck mit inklusiven Grenzen (x0..x1, y0..y1).
+ */
+struct TftRect {
+  int16_t x0, y0, x1, y1;
+};
+
+struct TftDirtyList {
+  TftRect rects[TFT_DIRTY_RECTS];
+  uint8_t count;
+};
+
+/**
+ * Markiert einen Bereich als geaendert.
+ *
+ * - Clipping auf screenW x screenH
+ * - Neues Rechteck wird mit bestehenden zusammengefasst, solange das "kostenlos" ist
+ *   (Vereinigung deckt keine Pixel ausserhalb beider Rechtecke ab, Schnittmenge einmal gezaehlt)
+ * - Ist die Liste voll, wird mit dem Rechteck mit dem kleinsten Flaechenzuwachs vereinigt
+ */
+void tftDirtyAdd(TftDirtyList &list, int16_t x, int16_t y, int16_t w, int16_t h,
+                 int16_t screenW, int16_t screenH);
@@ -7,6 +7,23 @@
 // Wichtig:
 // - KEINE Aenderung der oeffentlichen API-Signaturen (initDisplay bleibt bool).
 // - GUI nutzt fillRectRGB() fuer teilweises Loeschen (weniger Flackern).
+//
+// Framebuffer-Modus (TFT_FRAMEBUFFER in config.h):
+// - Alle Zeichenprimitive schreiben in einen Puffer im RAM (FrameCanvas.h):
+//   RGB565 (TFT_FRAMEBUFFER_BPP 16) oder 4 Bit Palettenindex (TFT_FRAMEBUFFER_BPP 4).
+// - Jede Zeichenoperation merkt sich ihr Rechteck als "dirty".
+// - flushDisplay() schiebt nur die (zusammengefassten) Dirty-Rechtecke per SPI raus,
+//   jeweils mit genau einem Address-Window.
+// - Clear-then-Draw passiert damit nur noch im RAM => kein Flackern, weniger SPI-Bytes.
+//
+// DMA-Flush (TFT_DMA_FLUSH in config.h, nur zusammen mit Framebuffer):
+// - Nach initR() uebernimmt der ESP-IDF spi_master-Treiber den Bus (DMA).
+// - flushDisplayAsync() uebergibt die Dirty-Rechtecke an die TFTFlushQueue und kehrt
+//   sofort zurueck; die Baender laufen im Hintergrund per DMA raus.
+// - isFlushBusy() pollt die Queue; solange true, darf nicht in den Framebuffer
+//   gezeichnet werden (GUI ueberspringt dann das Rendern).
+
+#ifdef ARDUINO  // ESP32/ST7735 (Host: TFTDisplayHost.cpp)
 
 #include "TFTDisplay.h"
 #include <Arduino.h>
@@ -19,11 +36,61 @@
 // Pins kommen aus Ihrer globalen config.h (wie bisher bei Ihnen)
 #include <config.h>
 
+#include "TFTDirtyRects.h"
+#include "TFTFlushQueue.h"
+#include "FrameCanvas.h"
+
+#include <LatencyTrace.h>
+
 // -----------------------------------------------------------------------------
 // Internes Display-Objekt
 // -----------------------------------------------------------------------------
 static Adafruit_ST7735 tft(TFT_CS, TFT_DC, TFT_RST);
 
+#ifndef TFT_FRAMEBUFFER
+#define TFT_FRAMEBUFFER 0
+#endif
+
+#ifndef TFT_FRAMEBUFFER_BPP
+#define TFT_FRAMEBUFFER_BPP 16
+#endif
+
+#ifndef TFT_DMA_FLUSH
+#define TFT_DMA_FLUSH 0
+#endif
+
+#if TFT_DMA_FLUSH && !TFT_FRAMEBUFFER
+#error "TFT_DMA_FLUSH benoetigt TFT_FRAMEBUFFER"
+#endif
+
+static_assert(TFT_DIRTY_RECTS <= TFT_FLUSH_MAX_RECTS, "TFT_DIRTY_RECTS > TFT_FLUSH_MAX_RECTS");
+
+#if TFT_FRAMEBUFFER
+#if TFT_FRAMEBUFFER_BPP == 4
+typedef IndexedCanvas4 FrameCanvas;
+#elif TFT_FRAMEBUFFER_BPP == 16
+typedef RgbCanvas16 FrameCanvas;
+#else
+#error "TFT_FRAMEBUFFER_BPP muss 4 oder 16 sein"
+#endif
+
+// Off-Screen-Puffer (nullptr => Allokation fehlgeschlagen, direkter SPI-Modus)
+static FrameCanvas* canvas = nullptr;
+
+// Dirty-Rechtecke seit dem letzten Flush
+static TftDirtyList dirty = {};
+#endif
+
+// -----------------------------------------------------------------------------
+// Zeichenziel: Framebuffer (falls aktiv) oder direkt das Display
+// -----------------------------------------------------------------------------
+static Adafruit_GFX& target() {
+#if TFT_FRAMEBUFFER
+  if (canvas) return *canvas;
+#endif
+  return tft;
+}
+
 // -----------------------------------------------------------------------------
 // Hilfsfunktion: RGB888 -> RGB565 (16-bit)
 // -----------------------------------------------------------------------------
@@ -33,6 +100,202 @@ static uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b) {
                     ((b & 0xF8) >> 3));
 }
 
+#if TFT_FRAMEBUFFER
+/**
+ * @brief Markiert einen Bereich als geaendert (wird beim naechsten flushDisplay() gesendet).
+ *        Zusammenfassen/Clipping: siehe TFTDirtyRects.
+ */
+static void markDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (!canvas) return;
+  tftDirtyAdd(dirty, x, y, w, h, canvas->width(), canvas->height());
+}
+#else
+static void markDirty(int16_t, int16_t, int16_t, int16_t) {}
+#endif
+
+#if TFT_DMA_FLUSH
+// -----------------------------------------------------------------------------
+// DMA-Transport (ESP-IDF spi_master) fuer die TFTFlushQueue
+// -----------------------------------------------------------------------------
+#include <driver/spi_master.h>
+#include <driver/gpio.h>
+#include <esp_heap_caps.h>
+
+// ST7735 Kommandos fuer das Address-Window
+static const uint8_t ST_CASET = 0x2A;
+static const uint8_t ST_RASET = 0x2B;
+static const uint8_t ST_RAMWR = 0x2C;
+
+// Pro Band 6 Transaktionen: CASET, Daten, RASET, Daten, RAMWR, Pixel
+static const uint8_t DMA_TRANS_PER_BAND = 6;
+
+// Treiber-Queue fasst beide Baender komplett (queue_size)
+static const uint8_t DMA_QUEUE_SIZE = 2 * DMA_TRANS_PER_BAND;
+
+static spi_device_handle_t dmaDev = nullptr;
+static spi_transaction_t dmaTrans[2][DMA_TRANS_PER_BAND];
+static uint8_t dmaQueued[2] = { 0, 0 };     // eingereiht, Ergebnis noch nicht abgeholt (je Slot)
+static bool dmaStale[2] = { false, false }; // Band nach Abbruch: Fertigmeldung nicht zaehlen
+static uint16_t* dmaBuf[2] = { nullptr, nullptr };
+static bool dmaReady = false;
+static bool dmaFlushPending = false;   // Frame submitted, Ende noch nicht gemeldet
+
+/**
+ * @brief Setzt DC vor jeder Transaktion (0 = Kommando, 1 = Daten).
+ *        Laeuft im SPI-Interrupt => IRAM.
+ */
+static void IRAM_ATTR dmaPreTransfer(spi_transaction_t* t) {
+  gpio_set_level((gpio_num_t)TFT_DC, (int)(intptr_t)t->user);
+}
+
+static void dmaSetCmd(spi_transaction_t &t, uint8_t cmd) {
+  memset(&t, 0, sizeof(t));
+  t.flags = SPI_TRANS_USE_TXDATA;
+  t.length = 8;
+  t.tx_data[0] = cmd;
+  t.user = (void*)0;
+}
+
+static void dmaSetWindowData(spi_transaction_t &t, uint16_t a, uint16_t b) {
+  memset(&t, 0, sizeof(t));
+  t.flags = SPI_TRANS_USE_TXDATA;
+  t.length = 32;
+  t.tx_data[0] = (uint8_t)(a >> 8);
+  t.tx_data[1] = (uint8_t)(a & 0xFF);
+  t.tx_data[2] = (uint8_t)(b >> 8);
+  t.tx_data[3] = (uint8_t)(b & 0xFF);
+  t.user = (void*)1;
+}
+
+/**
+ * @brief Reiht ein Band (Window + Pixel) in die DMA-Queue ein (nicht blockierend).
+ *
+ * - Deskriptoren eines Slots werden erst wiederverwendet, wenn der Treiber alle
+ *   zurueckgegeben hat (sonst false, die Queue versucht es spaeter erneut)
+ * - Scheitert das Einreihen mittendrin, laufen die bereits eingereihten
+ *   Transaktionen (Window ohne Pixel, harmlos) normal durch und werden in
+ *   dmaCollect() abgeholt; das Band zaehlt nicht als gestartet (false)
+ */
+static bool dmaStart(void*, uint8_t slot, int16_t x, int16_t y, int16_t w, int16_t h,
+                     const uint16_t* px, uint32_t count) {
+  if (dmaQueued[slot] > 0) return false;
+  if (dmaQueued[0] + dmaQueued[1] + DMA_TRANS_PER_BAND > DMA_QUEUE_SIZE) return false;
+
+  spi_transaction_t* t = dmaTrans[slot];
+
+  dmaSetCmd(t[0], ST_CASET);
+  dmaSetWindowData(t[1], x, x + w - 1);
+  dmaSetCmd(t[2], ST_RASET);
+  dmaSetWindowData(t[3], y, y + h - 1);
+  dmaSetCmd(t[4], ST_RAMWR);
+
+  memset(&t[5], 0, sizeof(t[5]));
+  t[5].length = count * 16;
+  t[5].tx_buffer = px;
+  t[5].user = (void*)1;
+
+  // Queue ist fuer 2 Baender dimensioniert, daher kein Warten noetig
+  for (uint8_t i = 0; i < DMA_TRANS_PER_BAND; i++) {
+    if (spi_device_queue_trans(dmaDev, &t[i], 0) != ESP_OK) return false;
+    dmaQueued[slot]++;
+  }
+  return true;
+}
+
+/**
+ * @brief Holt fertige Transaktionen ab und zaehlt abgeschlossene Pixel-Transfers.
+ */
+static uint8_t dmaCollect(void*) {
+  uint8_t bands = 0;
+  spi_transaction_t* done = nullptr;
+  while (spi_device_get_trans_result(dmaDev, &done, 0) == ESP_OK) {
+    const uint8_t slot = (done >= dmaTrans[1] && done < dmaTrans[1] + DMA_TRANS_PER_BAND) ? 1 : 0;
+    if (dmaQueued[slot] > 0) dmaQueued[slot]--;
+
+    if (done == &dmaTrans[slot][DMA_TRANS_PER_BAND - 1] && !dmaStale[slot]) bands++;
+    if (dmaQueued[slot] == 0) dmaStale[slot] = false;
+  }
+  return bands;
+}
+
+/**
+ * @brief Laufenden Frame verwerfen (DMA haengt): Queue leeren, Baender, die
+ *        noch im Treiber stecken, nicht mehr als fertig zaehlen, ganzes Bild
+ *        fuer den naechsten Flush markieren.
+ */
+static void dmaAbortFlush() {
+  for (uint8_t s = 0; s < 2; s++) dmaStale[s] = dmaQueued[s] > 0;
+  tftFlushQueueAbort();
+  dmaFlushPending = false;
+  markDirty(0, 0, canvas->width(), canvas->height());
+}
+
+/**
+ * @brief Liest eine Framebuffer-Zeile fuer die Flush-Queue.
+ */
+static void canvasReadRow(int16_t x, int16_t y, int16_t w, uint16_t* out) {
+  canvas->readRow565(x, y, w, out);
+}
+
+/**
+ * @brief Uebergibt den SPI-Bus vom Arduino-Treiber an spi_master (mit DMA).
+ *
+ * Ablauf:
+ * - Adafruit hat das Panel bereits initialisiert (initR, Rotation/MADCTL)
+ * - Arduino-SPI freigeben, Bus auf SPI2_HOST mit DMA neu aufsetzen
+ * - Bei Fehler: Arduino-SPI wieder starten (blockierender Flush bleibt nutzbar)
+ */
+static bool initDmaFlush() {
+  SPI.end();
+
+  spi_bus_config_t bus;
+  memset(&bus, 0, sizeof(bus));
+  bus.mosi_io_num = TFT_MOSI;
+  bus.miso_io_num = -1;
+  bus.sclk_io_num = TFT_SCK;
+  bus.quadwp_io_num = -1;
+  bus.quadhd_io_num = -1;
+  bus.max_transfer_sz = TFT_DMA_BAND_PX * 2;
+
+  spi_device_interface_config_t dev;
+  memset(&dev, 0, sizeof(dev));
+  dev.clock_speed_hz = TFT_SPI_HZ;
+  dev.mode = 0;
+  dev.spics_io_num = TFT_CS;
+  dev.queue_size = DMA_QUEUE_SIZE;
+  dev.pre_cb = dmaPreTransfer;
+
+  dmaBuf[0] = (uint16_t*)heap_caps_malloc(TFT_DMA_BAND_PX * 2, MALLOC_CAP_DMA);
+  dmaBuf[1] = (uint16_t*)heap_caps_malloc(TFT_DMA_BAND_PX * 2, MALLOC_CAP_DMA);
+
+  if (!dmaBuf[0] || !dmaBuf[1] ||
+      spi_bus_initialize(SPI2_HOST, &bus, SPI_DMA_CH_AUTO) != ESP_OK) {
+    heap_caps_free(dmaBuf[0]);
+    heap_caps_free(dmaBuf[1]);
+    dmaBuf[0] = dmaBuf[1] = nullptr;
+    SPI.begin(TFT_SCK, -1, TFT_MOSI);
+    return false;
+  }
+
+  if (spi_bus_add_device(SPI2_HOST, &dev, &dmaDev) != ESP_OK) {
+    spi_bus_free(SPI2_HOST);
+    heap_caps_free(dmaBuf[0]);
+    heap_caps_free(dmaBuf[1]);
+    dmaBuf[0] = dmaBuf[1] = nullptr;
+    SPI.begin(TFT_SCK, -1, TFT_MOSI);
+    return false;
+  }
+
+  TftFlushTransport tr;
+  tr.start = dmaStart;
+  tr.collect = dmaCollect;
+  tr.ctx = nullptr;
+  tftFlushQueueInit(dmaBuf[0], dmaBuf[1], TFT_DMA_BAND_PX, canvasReadRow, tr);
+
+  return true;
+}
+#endif
+
 /**
  * @brief Initialisiert das Display.
  *
@@ -59,6 +322,30 @@ bool initDisplay() {
   // Ihre vorherige Einstellung beibehalten (typisch 1 fuer Landscape).
   tft.setRotation(1);
 
+#if TFT_FRAMEBUFFER
+  // Off-Screen-Puffer in Displaygroesse (nach Rotation!) anlegen.
+  // Schlaegt die Allokation fehl, bleibt das Modul im direkten SPI-Modus.
+  if (!canvas) {
+    canvas = new FrameCanvas(tft.width(), tft.height());
+    if (canvas && !canvas->ok()) {
+      delete canvas;
+      canvas = nullptr;
+    }
+  }
+  if (canvas) {
+    // Kein Umbruch: Text ausserhalb des Displays wird abgeschnitten
+    // (Dirty-Rechteck bleibt damit exakt die Textbox)
+    canvas->setTextWrap(false);
+    canvas->fillScreen(rgb565(0, 0, 0));
+  }
+  dirty.count = 0;
+#endif
+
+#if TFT_DMA_FLUSH
+  // DMA nur mit Framebuffer sinnvoll (Quelle fuer die Baender)
+  if (canvas && !dmaReady) dmaReady = initDmaFlush();
+#endif
+
   // Mach nen BIT Test
   //runBit();
 
@@ -71,26 +358,35 @@ bool initDisplay() {
  * Zweck:
  * - Sichtbarer Funktionstest direkt nach Boot: Farben + Text.
  * - Danach wird wieder schwarz gemacht, damit die GUI sauber starten kann.
+ * - Im Framebuffer-Modus wird ueber den Puffer gezeichnet und blockierend geflusht
+ *   (bei DMA-Flush gehoert der SPI-Bus nicht mehr dem Adafruit-Treiber).
  */
 void runBit() {
+  Adafruit_GFX& gfx = target();
+
   // Basis: schwarz
-  tft.fillScreen(rgb565(0, 0, 0));
+  gfx.fillScreen(rgb565(0, 0, 0));
 
   // Einfache Testflächen
-  tft.fillRect(0, 0, tft.width(), tft.height() / 3, rgb565(255, 0, 0));
-  tft.fillRect(0, tft.height() / 3, tft.width(), tft.height() / 3, rgb565(0, 255, 0));
-  tft.fillRect(0, 2 * (tft.height() / 3), tft.width(), tft.height() / 3, rgb565(0, 0, 255));
+  gfx.fillRect(0, 0, gfx.width(), gfx.height() / 3, rgb565(255, 0, 0));
+  gfx.fillRect(0, gfx.height() / 3, gfx.width(), gfx.height() / 3, rgb565(0, 255, 0));
+  gfx.fillRect(0, 2 * (gfx.height() / 3), gfx.width(), gfx.height() / 3, rgb565(0, 0, 255));
 
   // Testtext
-  tft.setCursor(4, 4);
-  tft.setTextSize(1);
-  tft.setTextColor(rgb565(255, 255, 255));
-  tft.print("IBIT");
+  gfx.setCursor(4, 4);
+  gfx.setTextSize(1);
+  gfx.setTextColor(rgb565(255, 255, 255));
+  gfx.print("IBIT");
+
+  markDirty(0, 0, gfx.width(), gfx.height());
+  flushDisplay();
 
   delay(250);
 
   // Zurueck auf schwarz (GUI zeichnet danach)
-  tft.fillScreen(rgb565(0, 0, 0));
+  gfx.fillScreen(rgb565(0, 0, 0));
+  markDirty(0, 0, gfx.width(), gfx.height());
+  flushDisplay();
 }
 
 /**
@@ -100,7 +396,9 @@ void runBit() {
  * - Fuer flackerarmes UI bevorzugt die GUI fillRectRGB() auf Teilbereichen.
  */
 void clearDisplay() {
-  tft.fillScreen(rgb565(0, 0, 0));
+  Adafruit_GFX& gfx = target();
+  gfx.fillScreen(rgb565(0, 0, 0));
+  markDirty(0, 0, gfx.width(), gfx.height());
 }
 
 /**
@@ -112,10 +410,105 @@ void clearDisplay() {
  */
 void drawText(const char* text, int16_t x, int16_t y, uint8_t size,
               uint8_t r, uint8_t g, uint8_t b) {
-  tft.setCursor(x, y);
-  tft.setTextSize(size);
-  tft.setTextColor(rgb565(r, g, b)); // transparent (kein bg)
-  tft.print(text);
+  Adafruit_GFX& gfx = target();
+  gfx.setCursor(x, y);
+  gfx.setTextSize(size);
+  gfx.setTextColor(rgb565(r, g, b)); // transparent (kein bg)
+  gfx.print(text);
+
+  // Default Font: 6x8 Pixel bei size=1
+  markDirty(x, y, (int16_t)(strlen(text) * 6 * size), (int16_t)(8 * size));
+}
+
+// Maske fuer deckenden Text (1 Bit pro Pixel), waechst bei Bedarf
+static GFXcanvas1* textMask = nullptr;
+
+/**
+ * @brief Stellt eine Textmaske mit mindestens w x h Pixeln bereit.
+ */
+static GFXcanvas1* textMaskFor(int16_t w, int16_t h) {
+  if (textMask && textMask->width() >= w && textMask->height() >= h) return textMask;
+
+  const int16_t mw = (textMask && textMask->width()  > w) ? textMask->width()  : w;
+  const int16_t mh = (textMask && textMask->height() > h) ? textMask->height() : h;
+
+  delete textMask;
+  textMask = new GFXcanvas1(mw, mh);
+  if (textMask && !textMask->getBuffer()) {
+    delete textMask;
+    textMask = nullptr;
+  }
+  if (textMask) textMask->setTextWrap(false);
+  return textMask;
+}
+
+/**
+ * @brief Zeichnet Text deckend in eine Box fester Breite.
+ *
+ * - Box: boxX..boxX+boxW-1 / y..y+8*size-1, Text beginnt bei x (innerhalb der Box)
+ * - Glyph- und Hintergrundpixel entstehen in EINEM Durchgang:
+ *   Framebuffer: direktes Schreiben in den Puffer, ein Dirty-Rechteck
+ *   Direkt:      ein Address-Window, zeilenweiser Pixel-Stream
+ * - Ersetzt clearArea() + drawText() (jedes Pixel nur noch einmal geschrieben)
+ */
+void drawTextOpaque(const char* text, int16_t x, int16_t y, uint8_t size,
+                    uint8_t r, uint8_t g, uint8_t b,
+                    uint8_t bgR, uint8_t bgG, uint8_t bgB,
+                    int16_t boxX, int16_t boxW) {
+  Adafruit_GFX& gfx = target();
+  const uint16_t fg = rgb565(r, g, b);
+  const uint16_t bg = rgb565(bgR, bgG, bgB);
+  const int16_t boxH = 8 * size;
+
+  // Box auf Displaygrenzen clippen (Maske arbeitet in Box-Koordinaten)
+  int16_t x0 = (boxX < 0) ? 0 : boxX;
+  int16_t x1 = (boxX + boxW > gfx.width()) ? gfx.width() : (boxX + boxW);
+  int16_t y0 = (y < 0) ? 0 : y;
+  int16_t y1 = (y + boxH > gfx.height()) ? gfx.height() : (y + boxH);
+  if (x0 >= x1 || y0 >= y1) return;
+
+  GFXcanvas1* mask = textMaskFor(boxW, boxH);
+  if (!mask) {
+    // Kein RAM fuer die Maske: klassisch loeschen + transparent zeichnen
+    gfx.fillRect(x0, y0, x1 - x0, y1 - y0, bg);
+    markDirty(x0, y0, x1 - x0, y1 - y0);
+    drawText(text, x, y, size, r, g, b);
+    return;
+  }
+
+  mask->fillScreen(0);
+  mask->setCursor(x - boxX, 0);
+  mask->setTextSize(size);
+  mask->setTextColor(1);
+  mask->print(text);
+
+  // ST7735: max. 160 Pixel Breite in jeder Rotation
+  uint16_t line[160];
+  if (x1 - x0 > 160) x1 = x0 + 160;
+
+#if TFT_FRAMEBUFFER
+  if (canvas) {
+    for (int16_t py = y0; py < y1; py++) {
+      for (int16_t px = x0; px < x1; px++) {
+        line[px - x0] = mask->getPixel(px - boxX, py - y) ? fg : bg;
+      }
+      canvas->writeRow565(x0, py, x1 - x0, line);
+    }
+    markDirty(x0, y0, x1 - x0, y1 - y0);
+    return;
+  }
+#endif
+
+  // Direkter Modus: ein Window, Zeile fuer Zeile aus der Maske streamen
+  tft.startWrite();
+  tft.setAddrWindow(x0, y0, x1 - x0, y1 - y0);
+  for (int16_t py = y0; py < y1; py++) {
+    for (int16_t px = x0; px < x1; px++) {
+      line[px - x0] = mask->getPixel(px - boxX, py - y) ? fg : bg;
+    }
+    tft.writePixels(line, x1 - x0);
+  }
+  tft.endWrite();
 }
 
 /**
@@ -131,7 +524,11 @@ void getDisplaySize(int16_t &w, int16_t &h) {
  */
 void drawLineRGB(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
                  uint8_t r, uint8_t g, uint8_t b) {
-  tft.drawLine(x0, y0, x1, y1, rgb565(r, g, b));
+  target().drawLine(x0, y0, x1, y1, rgb565(r, g, b));
+
+  const int16_t minX = (x0 < x1) ? x0 : x1;
+  const int16_t minY = (y0 < y1) ? y0 : y1;
+  markDirty(minX, minY, abs(x1 - x0) + 1, abs(y1 - y0) + 1);
 }
 
 /**
@@ -142,5 +539,264 @@ void drawLineRGB(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
  */
 void fillRectRGB(int16_t x, int16_t y, int16_t w, int16_t h,
                  uint8_t r, uint8_t g, uint8_t b) {
-  tft.fillRect(x, y, w, h, rgb565(r, g, b));
+  target().fillRect(x, y, w, h, rgb565(r, g, b));
+  markDirty(x, y, w, h);
+}
+
+/**
+ * @brief Rastert ein Zeichen (Default-Font 6x8, skaliert) als 1-Bit-Maske.
+ *
+ * @param out  Zielmaske mit (8*size) Zeilen zu maskStride(6*size) Bytes
+ *
+ * Wird vom Glyph-Atlas einmalig beim Aufbau benutzt (nicht im Render-Pfad).
+ */
+void rasterizeCharMask(char c, uint8_t size, uint8_t* out) {
+  const int16_t w = 6 * size;
+  const int16_t h = 8 * size;
+  const uint16_t stride = maskStride(w);
+  memset(out, 0, (size_t)stride * h);
+
+  // Vordergrund 1, Hintergrund 0 in einer 1-Bit-Zelle (Adafruit-Layout = Maskenlayout)
+  GFXcanvas1 cell(w, h);
+  if (!cell.getBuffer()) return;
+
+  cell.fillScreen(0);
+  cell.drawChar(0, 0, (unsigned char)c, 1, 0, size);
+  memcpy(out, cell.getBuffer(), (size_t)stride * h);
+}
+
+/**
+ * @brief Zeichnet eine 1-Bit-Maske deckend (Bit = Vordergrund, sonst Hintergrund).
+ *
+ * - 4bpp-Framebuffer: fg/bg einmal auf Palettenindizes abbilden, Indizes direkt schreiben
+ * - RGB565-Framebuffer: direkt in den Puffer
+ * - Direkter Modus: ein Address-Window, zeilenweise expandiert
+ * - Teile ausserhalb des Displays werden abgeschnitten
+ */
+void blitMask(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t* bits,
+              uint8_t r, uint8_t g, uint8_t b,
+              uint8_t bgR, uint8_t bgG, uint8_t bgB) {
+  Adafruit_GFX& gfx = target();
+  const uint16_t fg = rgb565(r, g, b);
+  const uint16_t bg = rgb565(bgR, bgG, bgB);
+  const uint16_t stride = maskStride(w);
+
+  // Clipping
+  int16_t sx = 0, sy = 0;
+  int16_t cw = w, ch = h;
+  if (x < 0) { sx = -x; cw += x; x = 0; }
+  if (y < 0) { sy = -y; ch += y; y = 0; }
+  if (x + cw > gfx.width())  cw = gfx.width() - x;
+  if (y + ch > gfx.height()) ch = gfx.height() - y;
+  if (cw <= 0 || ch <= 0) return;
+
+#if TFT_FRAMEBUFFER
+  if (canvas) {
+    canvas->writeMask(x, y, cw, ch, bits, stride, sx, sy, fg, bg);
+    markDirty(x, y, cw, ch);
+    return;
+  }
+#endif
+
+  uint16_t line[160];   // ST7735: max. 160 Pixel Breite
+  if (cw > 160) cw = 160;
+
+  tft.startWrite();
+  tft.setAddrWindow(x, y, cw, ch);
+  for (int16_t row = 0; row < ch; row++) {
+    const uint8_t* m = &bits[(size_t)(sy + row) * stride];
+    for (int16_t i = 0; i < cw; i++) {
+      const int16_t bit = sx + i;
+      line[i] = (m[bit >> 3] & (0x80 >> (bit & 7))) ? fg : bg;
+    }
+    tft.writePixels(line, cw);
+  }
+  tft.endWrite();
+}
+
+/**
+ * @brief Kopiert einen fertigen RGB565-Block (zeilenweise, Breite w) auf das Display.
+ *
+ * - Framebuffer-Modus: zeilenweise in den Puffer + ein Dirty-Rechteck
+ * - Direkter Modus: genau ein Address-Window + ein Pixel-Stream
+ * - Teile ausserhalb des Displays werden abgeschnitten
+ */
+void blitRGB565(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* px) {
+  Adafruit_GFX& gfx = target();
+
+  // Clipping
+  int16_t sx = 0, sy = 0;
+  int16_t cw = w, ch = h;
+  if (x < 0) { sx = -x; cw += x; x = 0; }
+  if (y < 0) { sy = -y; ch += y; y = 0; }
+  if (x + cw > gfx.width())  cw = gfx.width() - x;
+  if (y + ch > gfx.height()) ch = gfx.height() - y;
+  if (cw <= 0 || ch <= 0) return;
+
+#if TFT_FRAMEBUFFER
+  if (canvas) {
+    for (int16_t row = 0; row < ch; row++) {
+      canvas->writeRow565(x, y + row, cw, &px[(int32_t)(sy + row) * w + sx]);
+    }
+    markDirty(x, y, cw, ch);
+    return;
+  }
+#endif
+
+  tft.startWrite();
+  tft.setAddrWindow(x, y, cw, ch);
+  if (cw == w) {
+    tft.writePixels((uint16_t*)&px[(int32_t)sy * w], (uint32_t)cw * ch);
+  } else {
+    for (int16_t row = 0; row < ch; row++) {
+      tft.writePixels((uint16_t*)&px[(int32_t)(sy + row) * w + sx], cw);
+    }
+  }
+  tft.endWrite();
+}
+
+#if TFT_FRAMEBUFFER
+/**
+ * @brief Blockierender Flush ueber den Adafruit-Treiber.
+ *
+ * - Pro Dirty-Rechteck genau ein Address-Window, danach zeilenweise Pixel-Stream
+ */
+static void flushBlocking() {
+  uint16_t line[160];   // ST7735: max. 160 Pixel Breite
+
+  tft.startWrite();
+  for (uint8_t i = 0; i < dirty.count; i++) {
+    const TftRect &r = dirty.rects[i];
+    const int16_t w = r.x1 - r.x0 + 1;
+    const int16_t h = r.y1 - r.y0 + 1;
+
+    tft.setAddrWindow(r.x0, r.y0, w, h);
+    for (int16_t row = r.y0; row <= r.y1; row++) {
+      canvas->readRow565(r.x0, row, w, line);
+      tft.writePixels(line, w);
+    }
+  }
+  tft.endWrite();
+
+  dirty.count = 0;
+}
+#endif
+
+/**
+ * @brief Schiebt alle seit dem letzten Aufruf geaenderten Bereiche zum Display
+ *        und wartet, bis alles uebertragen ist.
+ *
+ * - Ohne Framebuffer (oder wenn nichts geaendert wurde) passiert nichts
+ * - Mit DMA-Flush: Submit + Warten auf die Queue, hoechstens TFT_FLUSH_TIMEOUT_MS;
+ *   danach wird der Frame verworfen und das ganze Bild beim naechsten Flush gesendet
+ */
+void flushDisplay() {
+#if TFT_FRAMEBUFFER
+  if (!canvas) return;
+#if TFT_DMA_FLUSH
+  if (dmaReady) {
+    const uint32_t t0 = millis();
+    while (!flushDisplayAsync()) {
+      if (millis() - t0 >= TFT_FLUSH_TIMEOUT_MS) {
+        dmaAbortFlush();
+        return;
+      }
+    }
+    while (isFlushBusy()) {
+      if (millis() - t0 >= TFT_FLUSH_TIMEOUT_MS) {
+        dmaAbortFlush();
+        return;
+      }
+    }
+    return;
+  }
+#endif
+  if (dirty.count > 0) flushBlocking();
+#endif
+}
+
+/**
+ * @brief Startet den Flush der geaenderten Bereiche und kehrt sofort zurueck.
+ *
+ * @return false wenn der vorherige Frame noch uebertragen wird (nichts uebernommen,
+ *         die Dirty-Rechtecke bleiben fuer den naechsten Versuch erhalten)
+ *
+ * Ohne DMA-Flush wird blockierend geflusht (Rueckgabe immer true).
+ */
+bool flushDisplayAsync() {
+#if TFT_FRAMEBUFFER
+  if (canvas && dirty.count > 0) {
+#if TFT_DMA_FLUSH
+    if (dmaReady) {
+      if (!tftFlushQueueSubmit(dirty.rects, dirty.count)) return false;
+      dirty.count = 0;
+      dmaFlushPending = true;   // Ende meldet isFlushBusy()
+      return true;
+    }
+#endif
+    flushBlocking();
+  }
+#endif
+  latencyFlushDone(micros());
+  return true;
+}
+
+/**
+ * @brief true solange ein asynchroner Flush laeuft (pollt dabei die DMA-Queue).
+ *
+ * Solange true, darf nicht in den Framebuffer gezeichnet werden,
+ * weil die Baender erst beim Senden aus dem Puffer gelesen werden.
+ */
+bool isFlushBusy() {
+#if TFT_DMA_FLUSH
+  if (dmaReady) {
+    const bool busy = tftFlushQueueBusy();
+    if (!busy && dmaFlushPending) {
+      dmaFlushPending = false;
+      latencyFlushDone(micros());
+    }
+    return busy;
+  }
+#endif
+  return false;
+}
+
+/**
+ * @brief Reserviert (bzw. findet) einen Palettenslot fuer eine Farbe.
+ *
+ * Nur im indizierten Framebuffer (TFT_FRAMEBUFFER_BPP 4) wirksam. Die GUI
+ * registriert damit ihre Theme-Farben beim Start, damit jede Farbe einen
+ * eigenen Slot bekommt (statt Naeherung, wenn die Palette voll ist).
+ *
+ * @return Slot 0..15, -1 ohne indizierten Framebuffer
+ */
+int8_t registerPaletteColor(uint8_t r, uint8_t g, uint8_t b) {
+#if TFT_FRAMEBUFFER && TFT_FRAMEBUFFER_BPP == 4
+  if (canvas) return canvas->paletteSlot(rgb565(r, g, b));
+#else
+  (void)r; (void)g; (void)b;
+#endif
+  return -1;
+}
+
+/**
+ * @brief Faerbt einen Palettenslot um (Theme-Wechsel ohne Neuzeichnen).
+ *
+ * Alle Pixel mit diesem Slot aendern beim naechsten Flush ihre Farbe;
+ * dafuer wird der gesamte Screen als dirty markiert.
+ *
+ * @return false ohne indizierten Framebuffer
+ */
+bool setPaletteColor(uint8_t slot, uint8_t r, uint8_t g, uint8_t b) {
+#if TFT_FRAMEBUFFER && TFT_FRAMEBUFFER_BPP == 4
+  if (!canvas || slot >= 16) return false;
+  canvas->setPalette(slot, rgb565(r, g, b));
+  markDirty(0, 0, canvas->width(), canvas->height());
+  return true;
+#else
+  (void)slot; (void)r; (void)g; (void)b;
+  return false;
+#endif
 }
+
+#endif // ARDUINO
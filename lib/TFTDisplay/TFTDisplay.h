@@ -25,6 +25,28 @@ void drawText(
   uint8_t b
 );
 
+/**
+ * Zeichnet Text deckend (Glyphen + Hintergrund in einem Window-Write).
+ *
+ * @param text        Text (C-String)
+ * @param x, y        Textposition (Pixel), x liegt innerhalb der Box
+ * @param size        Textgröße (1 = klein)
+ * @param r,g,b       Textfarbe
+ * @param bgR,bgG,bgB Hintergrundfarbe der Box
+ * @param boxX, boxW  Box in X-Richtung (Höhe = 8 * size ab y); alles in der Box,
+ *                    was nicht Glyph ist, wird mit der Hintergrundfarbe gefüllt
+ */
+void drawTextOpaque(
+  const char* text,
+  int16_t x,
+  int16_t y,
+  uint8_t size,
+  uint8_t r, uint8_t g, uint8_t b,
+  uint8_t bgR, uint8_t bgG, uint8_t bgB,
+  int16_t boxX,
+  int16_t boxW
+);
+
 void getDisplaySize(int16_t &w, int16_t &h);
 
 void drawLineRGB(
@@ -36,3 +58,60 @@ void drawLineRGB(
 void fillRectRGB(int16_t x, int16_t y, int16_t w, int16_t h,
                  uint8_t r, uint8_t g, uint8_t b);
 
+/**
+ * Rastert ein Zeichen (Default-Font 6x8 * size) als 1-Bit-Maske mit
+ * (6*size) x (8*size) Pixeln: Bit gesetzt = Vordergrund, Zeilen auf ganze
+ * Bytes aufgefuellt (maskStride()), MSB = linkes Pixel. Basis fuer den Glyph-Atlas.
+ */
+void rasterizeCharMask(char c, uint8_t size, uint8_t* out);
+
+// Bytes pro Maskenzeile fuer w Pixel
+static inline uint16_t maskStride(int16_t w) { return (uint16_t)((w + 7) / 8); }
+
+/**
+ * Zeichnet eine 1-Bit-Maske (w x h, Layout wie rasterizeCharMask) deckend in
+ * Vorder-/Hintergrundfarbe, mit einem einzigen Window-Write bzw. direkt als
+ * Palettenindizes in den 4bpp-Framebuffer.
+ */
+void blitMask(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t* bits,
+              uint8_t r, uint8_t g, uint8_t b,
+              uint8_t bgR, uint8_t bgG, uint8_t bgB);
+
+/**
+ * Kopiert einen RGB565-Block (w x h, zeilenweise) mit einem einzigen
+ * Window-Write auf das Display (bzw. in den Framebuffer).
+ */
+void blitRGB565(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* px);
+
+/**
+ * Schiebt alle geaenderten Bereiche aus dem Framebuffer zum Display
+ * (nur bei TFT_FRAMEBUFFER = 1, sonst ohne Wirkung).
+ *
+ * Muss nach jedem Zeichendurchlauf aufgerufen werden, sonst bleibt
+ * das Gezeichnete im RAM.
+ */
+void flushDisplay();
+
+/**
+ * Startet den Flush im Hintergrund (DMA, TFT_DMA_FLUSH = 1) und kehrt sofort zurueck.
+ * Ohne DMA identisch zu flushDisplay().
+ *
+ * @return false wenn der vorherige Frame noch uebertragen wird
+ */
+bool flushDisplayAsync();
+
+/**
+ * true solange ein Hintergrund-Flush laeuft. Muss zyklisch aufgerufen werden
+ * (treibt die DMA-Queue an). Waehrenddessen nicht zeichnen.
+ */
+bool isFlushBusy();
+
+/**
+ * Palette des indizierten Framebuffers (TFT_FRAMEBUFFER_BPP = 4).
+ *
+ * registerPaletteColor: Slot fuer eine Farbe finden/anlegen (-1 ohne Palette)
+ * setPaletteColor:      Slot umfaerben, wirkt beim naechsten Flush auf alle
+ *                       Pixel dieses Slots (kein Neuzeichnen noetig)
+ */
+int8_t registerPaletteColor(uint8_t r, uint8_t g, uint8_t b);
+bool setPaletteColor(uint8_t slot, uint8_t r, uint8_t g, uint8_t b);
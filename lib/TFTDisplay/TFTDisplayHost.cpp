@@ -0,0 +1,477 @@
+// lib/TFTDisplay/TFTDisplayHost.cpp
+//
+// Software-Backend fuer TFTDisplay auf dem Host (siehe TFTDisplayHost.h).
+//
+// Gleiche Semantik wie TFTDisplay.cpp:
+// - Framebuffer-Modus: Zeichnen in RAM + Dirty-Rechtecke (TFTDirtyRects),
+//   flushDisplay() kopiert die Rechtecke aufs Panel und zaehlt die SPI-Kosten
+// - DMA-Flush: gleiche TFTFlushQueue, Transport = TFTFlushHost (Baender werden
+//   bei jedem isFlushBusy() als fertig gemeldet)
+// - Direkter Modus: jede Zeichenoperation landet sofort auf dem Panel und kostet
+//   so viel, wie Adafruit_SPITFT dafuer senden wuerde
+//
+// Einschraenkung:
+// - Der Host-Framebuffer ist immer RGB565; die Palette des 4bpp-Modus
+//   (registerPaletteColor/setPaletteColor) wird nicht nachgebildet.
+//   Die SPI-Kosten sind davon unabhaengig (Flush sendet immer RGB565).
+
+#ifndef ARDUINO
+
+#include "TFTDisplay.h"
+#include "TFTDisplayHost.h"
+
+#include <Arduino.h>   // micros() aus lib/HostSim
+
+#include "TFTDirtyRects.h"
+#include "TFTFlushQueue.h"
+#include "TFTFlushHost.h"
+
+#include <config.h>
+#include <LatencyTrace.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef TFT_FRAMEBUFFER
+#define TFT_FRAMEBUFFER 0
+#endif
+
+#ifndef TFT_DMA_FLUSH
+#define TFT_DMA_FLUSH 0
+#endif
+
+#ifndef TFT_DMA_BAND_PX
+#define TFT_DMA_BAND_PX (160 * 8)
+#endif
+
+// -----------------------------------------------------------------------------
+// Panel / Framebuffer / Zaehler
+// -----------------------------------------------------------------------------
+// ST7735 in Rotation 1 (Landscape), wie initDisplay() auf dem ESP32
+static const int16_t HOST_W = 160;
+static const int16_t HOST_H = 128;
+
+static uint16_t panel[HOST_W * HOST_H];
+
+#if TFT_FRAMEBUFFER
+static uint16_t fb[HOST_W * HOST_H];
+static TftDirtyList dirty = {};
+#endif
+
+#if TFT_DMA_FLUSH
+static uint16_t dmaBuf[2][TFT_DMA_BAND_PX];
+static bool dmaFlushPending = false;   // Frame submitted, Ende noch nicht gemeldet
+#endif
+
+static TftSpiStats stats = {};
+
+// Address-Window: CASET + 4 Byte, RASET + 4 Byte, RAMWR
+static const uint32_t WINDOW_CMDS  = 3;
+static const uint32_t WINDOW_BYTES = 11;
+
+/**
+ * @brief Zaehlt ein Address-Window mit anschliessendem Pixel-Stream.
+ */
+static void spiWindow(uint32_t px) {
+  stats.windows++;
+  stats.commands += WINDOW_CMDS;
+  stats.pixels += px;
+  stats.bytes += WINDOW_BYTES + px * 2;
+}
+
+// -----------------------------------------------------------------------------
+// Default-Font 5x7 (Adafruit "glcdfont", ASCII 0x20..0x7E)
+// 5 Spalten pro Zeichen, Bit 0 = oberste Zeile
+// -----------------------------------------------------------------------------
+static const uint8_t FONT5X7[95][5] = {
+  {0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x5F,0x00,0x00}, {0x00,0x07,0x00,0x07,0x00}, // ' ' ! "
+  {0x14,0x7F,0x14,0x7F,0x14}, {0x24,0x2A,0x7F,0x2A,0x12}, {0x23,0x13,0x08,0x64,0x62}, // # $ %
+  {0x36,0x49,0x56,0x20,0x50}, {0x00,0x08,0x07,0x03,0x00}, {0x00,0x1C,0x22,0x41,0x00}, // & ' (
+  {0x00,0x41,0x22,0x1C,0x00}, {0x2A,0x1C,0x7F,0x1C,0x2A}, {0x08,0x08,0x3E,0x08,0x08}, // ) * +
+  {0x00,0x80,0x70,0x30,0x00}, {0x08,0x08,0x08,0x08,0x08}, {0x00,0x00,0x60,0x60,0x00}, // , - .
+  {0x20,0x10,0x08,0x04,0x02}, {0x3E,0x51,0x49,0x45,0x3E}, {0x00,0x42,0x7F,0x40,0x00}, // / 0 1
+  {0x72,0x49,0x49,0x49,0x46}, {0x21,0x41,0x49,0x4D,0x33}, {0x18,0x14,0x12,0x7F,0x10}, // 2 3 4
+  {0x27,0x45,0x45,0x45,0x39}, {0x3C,0x4A,0x49,0x49,0x31}, {0x41,0x21,0x11,0x09,0x07}, // 5 6 7
+  {0x36,0x49,0x49,0x49,0x36}, {0x46,0x49,0x49,0x29,0x1E}, {0x00,0x00,0x14,0x00,0x00}, // 8 9 :
+  {0x00,0x40,0x34,0x00,0x00}, {0x00,0x08,0x14,0x22,0x41}, {0x14,0x14,0x14,0x14,0x14}, // ; < =
+  {0x00,0x41,0x22,0x14,0x08}, {0x02,0x01,0x59,0x09,0x06}, {0x3E,0x41,0x5D,0x59,0x4E}, // > ? @
+  {0x7C,0x12,0x11,0x12,0x7C}, {0x7F,0x49,0x49,0x49,0x36}, {0x3E,0x41,0x41,0x41,0x22}, // A B C
+  {0x7F,0x41,0x41,0x41,0x3E}, {0x7F,0x49,0x49,0x49,0x41}, {0x7F,0x09,0x09,0x09,0x01}, // D E F
+  {0x3E,0x41,0x41,0x51,0x73}, {0x7F,0x08,0x08,0x08,0x7F}, {0x00,0x41,0x7F,0x41,0x00}, // G H I
+  {0x20,0x40,0x41,0x3F,0x01}, {0x7F,0x08,0x14,0x22,0x41}, {0x7F,0x40,0x40,0x40,0x40}, // J K L
+  {0x7F,0x02,0x1C,0x02,0x7F}, {0x7F,0x04,0x08,0x10,0x7F}, {0x3E,0x41,0x41,0x41,0x3E}, // M N O
+  {0x7F,0x09,0x09,0x09,0x06}, {0x3E,0x41,0x51,0x21,0x5E}, {0x7F,0x09,0x19,0x29,0x46}, // P Q R
+  {0x26,0x49,0x49,0x49,0x32}, {0x03,0x01,0x7F,0x01,0x03}, {0x3F,0x40,0x40,0x40,0x3F}, // S T U
+  {0x1F,0x20,0x40,0x20,0x1F}, {0x3F,0x40,0x38,0x40,0x3F}, {0x63,0x14,0x08,0x14,0x63}, // V W X
+  {0x03,0x04,0x78,0x04,0x03}, {0x61,0x59,0x49,0x4D,0x43}, {0x00,0x7F,0x41,0x41,0x41}, // Y Z [
+  {0x02,0x04,0x08,0x10,0x20}, {0x00,0x41,0x41,0x41,0x7F}, {0x04,0x02,0x01,0x02,0x04}, // \ ] ^
+  {0x40,0x40,0x40,0x40,0x40}, {0x00,0x03,0x07,0x08,0x00}, {0x20,0x54,0x54,0x78,0x40}, // _ ` a
+  {0x7F,0x28,0x44,0x44,0x38}, {0x38,0x44,0x44,0x44,0x28}, {0x38,0x44,0x44,0x28,0x7F}, // b c d
+  {0x38,0x54,0x54,0x54,0x18}, {0x00,0x08,0x7E,0x09,0x02}, {0x18,0xA4,0xA4,0x9C,0x78}, // e f g
+  {0x7F,0x08,0x04,0x04,0x78}, {0x00,0x44,0x7D,0x40,0x00}, {0x20,0x40,0x40,0x3D,0x00}, // h i j
+  {0x7F,0x10,0x28,0x44,0x00}, {0x00,0x41,0x7F,0x40,0x00}, {0x7C,0x04,0x78,0x04,0x78}, // k l m
+  {0x7C,0x08,0x04,0x04,0x78}, {0x38,0x44,0x44,0x44,0x38}, {0xFC,0x18,0x24,0x24,0x18}, // n o p
+  {0x18,0x24,0x24,0x18,0xFC}, {0x7C,0x08,0x04,0x04,0x08}, {0x48,0x54,0x54,0x54,0x24}, // q r s
+  {0x04,0x04,0x3F,0x44,0x24}, {0x3C,0x40,0x40,0x20,0x7C}, {0x1C,0x20,0x40,0x20,0x1C}, // t u v
+  {0x3C,0x40,0x30,0x40,0x3C}, {0x44,0x28,0x10,0x28,0x44}, {0x4C,0x90,0x90,0x90,0x7C}, // w x y
+  {0x44,0x64,0x54,0x4C,0x44}, {0x00,0x08,0x36,0x41,0x00}, {0x00,0x00,0x77,0x00,0x00}, // z { |
+  {0x00,0x41,0x36,0x08,0x00}, {0x02,0x01,0x02,0x04,0x02}                              // } ~
+};
+
+/**
+ * @brief true wenn Glyph-Pixel (col 0..5, row 0..7) gesetzt ist.
+ *        Spalte 5 ist der Zeichenabstand (immer leer).
+ */
+static bool glyphBit(char c, int16_t col, int16_t row) {
+  const unsigned char uc = (unsigned char)c;
+  if (uc < 0x20 || uc > 0x7E || col < 0 || col > 4 || row < 0 || row > 7) return false;
+  return (FONT5X7[uc - 0x20][col] >> row) & 1;
+}
+
+// -----------------------------------------------------------------------------
+// Zeichenziel
+// -----------------------------------------------------------------------------
+static uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b) {
+  return (uint16_t)(((r & 0xF8) << 8) |
+                    ((g & 0xFC) << 3) |
+                    ((b & 0xF8) >> 3));
+}
+
+static uint16_t* target() {
+#if TFT_FRAMEBUFFER
+  return fb;
+#else
+  return panel;
+#endif
+}
+
+static void markDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+#if TFT_FRAMEBUFFER
+  tftDirtyAdd(dirty, x, y, w, h, HOST_W, HOST_H);
+#else
+  (void)x; (void)y; (void)w; (void)h;
+#endif
+}
+
+/**
+ * @brief Clipping auf das Panel. false => nichts sichtbar.
+ */
+static bool clipRect(int16_t &x, int16_t &y, int16_t &w, int16_t &h) {
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > HOST_W) w = HOST_W - x;
+  if (y + h > HOST_H) h = HOST_H - y;
+  return w > 0 && h > 0;
+}
+
+/**
+ * @brief Rechteck fuellen. Direkt: ein Window (Adafruit fillRect/writeFillRect).
+ */
+static void fillClipped(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c) {
+  if (!clipRect(x, y, w, h)) return;
+
+  uint16_t* buf = target();
+  for (int16_t row = y; row < y + h; row++) {
+    for (int16_t col = x; col < x + w; col++) buf[row * HOST_W + col] = c;
+  }
+
+  if (TFT_FRAMEBUFFER) markDirty(x, y, w, h);
+  else spiWindow((uint32_t)w * h);
+}
+
+/**
+ * @brief Einzelpixel. Direkt: Window + 1 Pixel (Adafruit writePixel).
+ */
+static void plot(int16_t x, int16_t y, uint16_t c) {
+  if (x < 0 || y < 0 || x >= HOST_W || y >= HOST_H) return;
+  target()[y * HOST_W + x] = c;
+  if (!TFT_FRAMEBUFFER) spiWindow(1);
+}
+
+// -----------------------------------------------------------------------------
+// Flush (Framebuffer -> Panel)
+// -----------------------------------------------------------------------------
+#if TFT_FRAMEBUFFER && !TFT_DMA_FLUSH
+static void flushBlocking() {
+  for (uint8_t i = 0; i < dirty.count; i++) {
+    const TftRect &r = dirty.rects[i];
+    const int16_t w = r.x1 - r.x0 + 1;
+    const int16_t h = r.y1 - r.y0 + 1;
+
+    for (int16_t row = r.y0; row <= r.y1; row++) {
+      memcpy(&panel[row * HOST_W + r.x0], &fb[row * HOST_W + r.x0], (size_t)w * 2);
+    }
+    spiWindow((uint32_t)w * h);
+  }
+  dirty.count = 0;
+}
+#endif
+
+#if TFT_DMA_FLUSH
+static void fbReadRow(int16_t x, int16_t y, int16_t w, uint16_t* out) {
+  memcpy(out, &fb[y * HOST_W + x], (size_t)w * 2);
+}
+
+/**
+ * @brief Fertiges DMA-Band aufs Panel (Display-Bytefolge zurueck nach nativ).
+ */
+static void dmaBandDone(int16_t x, int16_t y, int16_t w, int16_t h,
+                        const uint16_t* px, uint32_t count) {
+  for (int16_t row = 0; row < h; row++) {
+    for (int16_t col = 0; col < w; col++) {
+      const uint16_t v = px[row * w + col];
+      panel[(y + row) * HOST_W + x + col] = (uint16_t)((v << 8) | (v >> 8));
+    }
+  }
+  spiWindow(count);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// TFTDisplay-API
+// -----------------------------------------------------------------------------
+bool initDisplay() {
+  memset(panel, 0, sizeof(panel));
+#if TFT_FRAMEBUFFER
+  memset(fb, 0, sizeof(fb));
+  dirty.count = 0;
+#endif
+#if TFT_DMA_FLUSH
+  tftFlushHostSetSink(dmaBandDone);
+  tftFlushQueueInit(dmaBuf[0], dmaBuf[1], TFT_DMA_BAND_PX, fbReadRow, tftFlushHostTransport());
+#endif
+  stats = TftSpiStats{};
+  return true;
+}
+
+void runBit() {
+  fillClipped(0, 0, HOST_W, HOST_H, rgb565(0, 0, 0));
+  fillClipped(0, 0, HOST_W, HOST_H / 3, rgb565(255, 0, 0));
+  fillClipped(0, HOST_H / 3, HOST_W, HOST_H / 3, rgb565(0, 255, 0));
+  fillClipped(0, 2 * (HOST_H / 3), HOST_W, HOST_H / 3, rgb565(0, 0, 255));
+  drawText("IBIT", 4, 4, 1, 255, 255, 255);
+  flushDisplay();
+
+  fillClipped(0, 0, HOST_W, HOST_H, rgb565(0, 0, 0));
+  flushDisplay();
+}
+
+void clearDisplay() {
+  fillClipped(0, 0, HOST_W, HOST_H, rgb565(0, 0, 0));
+}
+
+void drawText(const char* text, int16_t x, int16_t y, uint8_t size,
+              uint8_t r, uint8_t g, uint8_t b) {
+  const uint16_t c = rgb565(r, g, b);
+  int16_t cx = x;
+
+  for (const char* p = text; *p; p++, cx += 6 * size) {
+    for (int16_t col = 0; col < 5; col++) {
+      for (int16_t row = 0; row < 8; row++) {
+        if (!glyphBit(*p, col, row)) continue;
+        if (size == 1) plot(cx + col, y + row, c);
+        else fillClipped(cx + col * size, y + row * size, size, size, c);
+      }
+    }
+  }
+
+  // Gleiche Dirty-Box wie auf dem ESP32 (Default Font: 6x8 Pixel bei size=1)
+  markDirty(x, y, (int16_t)(strlen(text) * 6 * size), (int16_t)(8 * size));
+}
+
+void drawTextOpaque(const char* text, int16_t x, int16_t y, uint8_t size,
+                    uint8_t r, uint8_t g, uint8_t b,
+                    uint8_t bgR, uint8_t bgG, uint8_t bgB,
+                    int16_t boxX, int16_t boxW) {
+  const uint16_t fg = rgb565(r, g, b);
+  const uint16_t bg = rgb565(bgR, bgG, bgB);
+
+  int16_t bx = boxX, by = y, bw = boxW, bh = 8 * size;
+  if (!clipRect(bx, by, bw, bh)) return;
+
+  const int16_t len = (int16_t)strlen(text);
+  uint16_t* buf = target();
+
+  for (int16_t py = by; py < by + bh; py++) {
+    const int16_t row = (py - y) / size;
+    for (int16_t px = bx; px < bx + bw; px++) {
+      const int16_t rel = px - x;
+      bool on = false;
+      if (rel >= 0) {
+        const int16_t ci = rel / (6 * size);
+        if (ci < len) on = glyphBit(text[ci], (rel % (6 * size)) / size, row);
+      }
+      buf[py * HOST_W + px] = on ? fg : bg;
+    }
+  }
+
+  if (TFT_FRAMEBUFFER) markDirty(bx, by, bw, bh);
+  else spiWindow((uint32_t)bw * bh);
+}
+
+void getDisplaySize(int16_t &w, int16_t &h) {
+  w = HOST_W;
+  h = HOST_H;
+}
+
+void drawLineRGB(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                 uint8_t r, uint8_t g, uint8_t b) {
+  const uint16_t c = rgb565(r, g, b);
+
+  const int16_t minX = (x0 < x1) ? x0 : x1;
+  const int16_t minY = (y0 < y1) ? y0 : y1;
+  const int16_t w = (int16_t)abs(x1 - x0) + 1;
+  const int16_t h = (int16_t)abs(y1 - y0) + 1;
+
+  // Horizontal/vertikal: Adafruit drawFastHLine/VLine => ein Window
+  if (x0 == x1 || y0 == y1) {
+    fillClipped(minX, minY, w, h, c);
+    return;
+  }
+
+  // Sonst Bresenham wie Adafruit writeLine (ein Pixel-Window pro Punkt)
+  const bool steep = abs(y1 - y0) > abs(x1 - x0);
+  int16_t t;
+  if (steep) { t = x0; x0 = y0; y0 = t; t = x1; x1 = y1; y1 = t; }
+  if (x0 > x1) { t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+
+  const int16_t dx = x1 - x0;
+  const int16_t dy = (int16_t)abs(y1 - y0);
+  const int16_t ystep = (y0 < y1) ? 1 : -1;
+  int16_t err = dx / 2;
+
+  for (; x0 <= x1; x0++) {
+    if (steep) plot(y0, x0, c);
+    else plot(x0, y0, c);
+    err -= dy;
+    if (err < 0) { y0 += ystep; err += dx; }
+  }
+
+  markDirty(minX, minY, w, h);
+}
+
+void fillRectRGB(int16_t x, int16_t y, int16_t w, int16_t h,
+                 uint8_t r, uint8_t g, uint8_t b) {
+  fillClipped(x, y, w, h, rgb565(r, g, b));
+}
+
+void rasterizeCharMask(char c, uint8_t size, uint8_t* out) {
+  const int16_t w = 6 * size;
+  const int16_t h = 8 * size;
+  const uint16_t stride = maskStride(w);
+  memset(out, 0, (size_t)stride * h);
+
+  for (int16_t py = 0; py < h; py++) {
+    for (int16_t px = 0; px < w; px++) {
+      if (glyphBit(c, px / size, py / size)) out[py * stride + (px >> 3)] |= (uint8_t)(0x80 >> (px & 7));
+    }
+  }
+}
+
+void blitMask(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t* bits,
+              uint8_t r, uint8_t g, uint8_t b,
+              uint8_t bgR, uint8_t bgG, uint8_t bgB) {
+  int16_t cx = x, cy = y, cw = w, ch = h;
+  if (!clipRect(cx, cy, cw, ch)) return;
+
+  const uint16_t fg = rgb565(r, g, b);
+  const uint16_t bg = rgb565(bgR, bgG, bgB);
+  const uint16_t stride = maskStride(w);
+
+  uint16_t* buf = target();
+  for (int16_t row = 0; row < ch; row++) {
+    const uint8_t* m = &bits[(size_t)(cy - y + row) * stride];
+    for (int16_t i = 0; i < cw; i++) {
+      const int16_t bit = cx - x + i;
+      buf[(cy + row) * HOST_W + cx + i] = (m[bit >> 3] & (0x80 >> (bit & 7))) ? fg : bg;
+    }
+  }
+
+  if (TFT_FRAMEBUFFER) markDirty(cx, cy, cw, ch);
+  else spiWindow((uint32_t)cw * ch);
+}
+
+void blitRGB565(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* px) {
+  int16_t cx = x, cy = y, cw = w, ch = h;
+  if (!clipRect(cx, cy, cw, ch)) return;
+
+  uint16_t* buf = target();
+  for (int16_t row = 0; row < ch; row++) {
+    memcpy(&buf[(cy + row) * HOST_W + cx],
+           &px[(cy - y + row) * w + (cx - x)], (size_t)cw * 2);
+  }
+
+  if (TFT_FRAMEBUFFER) markDirty(cx, cy, cw, ch);
+  else spiWindow((uint32_t)cw * ch);
+}
+
+void flushDisplay() {
+#if TFT_DMA_FLUSH
+  while (!flushDisplayAsync()) {}
+  while (isFlushBusy()) {}
+#elif TFT_FRAMEBUFFER
+  flushBlocking();
+#endif
+}
+
+bool flushDisplayAsync() {
+#if TFT_FRAMEBUFFER
+  if (dirty.count > 0) {
+#if TFT_DMA_FLUSH
+    if (!tftFlushQueueSubmit(dirty.rects, dirty.count)) return false;
+    dirty.count = 0;
+    dmaFlushPending = true;
+    return true;
+#else
+    flushBlocking();
+#endif
+  }
+#endif
+  latencyFlushDone(micros());
+  return true;
+}
+
+bool isFlushBusy() {
+#if TFT_DMA_FLUSH
+  // "DMA" schafft pro Abfrage die laufenden Baender
+  tftFlushHostComplete(2);
+  const bool busy = tftFlushQueueBusy();
+  if (!busy && dmaFlushPending) {
+    dmaFlushPending = false;
+    latencyFlushDone(micros());
+  }
+  return busy;
+#else
+  return false;
+#endif
+}
+
+int8_t registerPaletteColor(uint8_t, uint8_t, uint8_t) { return -1; }
+bool setPaletteColor(uint8_t, uint8_t, uint8_t, uint8_t) { return false; }
+
+// -----------------------------------------------------------------------------
+// Host-API
+// -----------------------------------------------------------------------------
+TftSpiStats tftHostStats() { return stats; }
+void tftHostResetStats() { stats = TftSpiStats{}; }
+const uint16_t* tftHostPanel() { return panel; }
+
+bool tftHostSavePPM(const char* path) {
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+
+  fprintf(f, "P6\n%d %d\n255\n", HOST_W, HOST_H);
+  for (int32_t i = 0; i < (int32_t)HOST_W * HOST_H; i++) {
+    const uint16_t c = panel[i];
+    const uint8_t rgb[3] = {
+      (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+      (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+      (uint8_t)((c & 0x1F) * 255 / 31)
+    };
+    fwrite(rgb, 1, 3, f);
+  }
+  return fclose(f) == 0;
+}
+
+#endif // !ARDUINO
@@ -0,0 +1,36 @@
+// lib/TFTDisplay/TFTDisplayHost.h
+//
+// Software-Backend fuer TFTDisplay auf dem Host (nur Nicht-Arduino-Builds).
+//
+// - Implementiert die komplette TFTDisplay.h-API gegen eine RGB565-Surface im RAM
+//   ("Panel" = was auf dem echten ST7735 sichtbar waere).
+// - Zaehlt dabei alles, was der echte ST7735-Pfad per SPI senden wuerde:
+//   Address-Windows, Kommandos, Pixel, Bytes. Framebuffer-/DMA-Modus aus config.h
+//   werden genauso nachgebildet (gleiche Dirty-Rechtecke, gleiche Baender).
+// - Snapshots als binaeres PPM (P6).
+//
+// Kostenmodell (Adafruit_SPITFT bzw. eigener DMA-Pfad):
+// - Address-Window: CASET + 4 Byte, RASET + 4 Byte, RAMWR => 3 Kommandos, 11 Byte
+// - Pixel: 2 Byte (RGB565)
+// - Direkter Modus: drawPixel = Window + 1 Pixel, fillRect = Window + w*h Pixel,
+//   Text size 1 = ein Pixel pro gesetztem Glyph-Pixel, size > 1 = ein fillRect pro Glyph-Pixel
+
+#pragma once
+#include <stdint.h>
+
+struct TftSpiStats {
+  uint32_t windows;    // Address-Window-Setups
+  uint32_t commands;   // Kommando-Bytes (DC = 0)
+  uint32_t pixels;     // gesendete Pixel
+  uint32_t bytes;      // alle Bytes auf dem Bus (Kommandos + Parameter + Pixel)
+};
+
+// Zaehler lesen / zuruecksetzen
+TftSpiStats tftHostStats();
+void tftHostResetStats();
+
+// Aktueller Panel-Inhalt (W x H, RGB565, zeilenweise)
+const uint16_t* tftHostPanel();
+
+// Panel als PPM (P6) speichern
+bool tftHostSavePPM(const char* path);
@@ -0,0 +1,61 @@
+// lib/TFTDisplay/TFTFlushHost.cpp
+//
+// Host-Stand-in fuer den DMA-Transport (siehe TFTFlushHost.h).
+
+#ifndef ARDUINO
+
+#include "TFTFlushHost.h"
+
+// Laufende Baender (max. 2 wegen Double-Buffering, Reserve fuer Fehlbedienung)
+struct HostBand {
+  int16_t x, y, w, h;
+  const uint16_t* px;
+  uint32_t count;
+};
+
+static HostBand pending[4];
+static uint8_t pendingCount = 0;
+static uint8_t finished = 0;       // fertig, aber noch nicht per collect() abgeholt
+static TftHostBandSink sink = nullptr;
+
+static bool hostStart(void*, uint8_t, int16_t x, int16_t y, int16_t w, int16_t h,
+                      const uint16_t* px, uint32_t count) {
+  if (pendingCount >= sizeof(pending) / sizeof(pending[0])) return false;
+  pending[pendingCount++] = HostBand{ x, y, w, h, px, count };
+  return true;
+}
+
+static uint8_t hostCollect(void*) {
+  uint8_t n = finished;
+  finished = 0;
+  return n;
+}
+
+TftFlushTransport tftFlushHostTransport() {
+  pendingCount = 0;
+  finished = 0;
+
+  TftFlushTransport t;
+  t.start = hostStart;
+  t.collect = hostCollect;
+  t.ctx = nullptr;
+  return t;
+}
+
+void tftFlushHostSetSink(TftHostBandSink s) { sink = s; }
+
+void tftFlushHostComplete(uint8_t n) {
+  while (n > 0 && pendingCount > 0) {
+    const HostBand &b = pending[0];
+    if (sink) sink(b.x, b.y, b.w, b.h, b.px, b.count);
+
+    for (uint8_t i = 1; i < pendingCount; i++) pending[i - 1] = pending[i];
+    pendingCount--;
+    finished++;
+    n--;
+  }
+}
+
+uint8_t tftFlushHostPending() { return pendingCount; }
+
+#endif // !ARDUINO
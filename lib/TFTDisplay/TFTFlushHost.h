@@ -0,0 +1,27 @@
+// lib/TFTDisplay/TFTFlushHost.h
+//
+// Host-Stand-in fuer den DMA-Transport der Flush-Queue (nur Nicht-Arduino-Builds).
+//
+// Statt SPI-DMA merkt sich der Stand-in die gestarteten Baender. Ein Test bzw.
+// die Host-Simulation entscheidet selbst, wann die "Hardware" fertig ist
+// (tftFlushHostComplete), und kann so Busy-/Reihenfolge-Verhalten nachstellen.
+
+#pragma once
+#include <stdint.h>
+#include "TFTFlushQueue.h"
+
+// Empfaenger fuer fertig uebertragene Baender (Pixel in Display-Bytefolge)
+typedef void (*TftHostBandSink)(int16_t x, int16_t y, int16_t w, int16_t h,
+                                const uint16_t* px, uint32_t count);
+
+// Transport fuer tftFlushQueueInit()
+TftFlushTransport tftFlushHostTransport();
+
+// Optional: Baender bei Fertigmeldung weiterreichen (z.B. an eine Software-Surface)
+void tftFlushHostSetSink(TftHostBandSink sink);
+
+// Simuliert die Fertigmeldung der n aeltesten laufenden Baender
+void tftFlushHostComplete(uint8_t n);
+
+// Anzahl gestarteter, noch nicht fertig gemeldeter Baender
+uint8_t tftFlushHostPending();
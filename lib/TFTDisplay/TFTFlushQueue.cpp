@@ -0,0 +1,139 @@
+// lib/TFTDisplay/TFTFlushQueue.cpp
+//
+// Double-Buffered Flush-Queue (siehe TFTFlushQueue.h).
+//
+// Ablauf pro Frame:
+//   Submit(rects) -> pump():
+//     solange ein Staging-Puffer frei ist und noch Zeilen offen sind:
+//       - naechstes Band (so viele ganze Zeilen wie in den Puffer passen) lesen
+//       - RGB565 -> big endian tauschen (Display-Bytefolge)
+//       - transport.start(...)
+//   Busy() -> transport.collect() gibt Puffer in Startreihenfolge frei -> pump()
+
+#include "TFTFlushQueue.h"
+
+#include <stddef.h>
+
+// --------------------
+// Interner Queue-State
+// --------------------
+static uint16_t* slotBuf[2] = { nullptr, nullptr };
+static bool slotBusy[2] = { false, false };
+static uint8_t nextSlot = 0;      // naechster zu befuellender Puffer
+static uint8_t oldestSlot = 0;    // aeltester laufender Puffer (FIFO)
+
+static uint32_t capacity = 0;
+static TftRowReader readRow = nullptr;
+static TftFlushTransport tr = { nullptr, nullptr, nullptr };
+
+// Offene Rechtecke des aktuellen Frames
+static TftRect jobs[TFT_FLUSH_MAX_RECTS];
+static uint8_t jobCount = 0;
+static uint8_t jobIndex = 0;      // aktuelles Rechteck
+static int16_t jobRow = 0;        // naechste Zeile im aktuellen Rechteck
+
+static uint32_t bandsStarted = 0;
+
+/**
+ * @brief RGB565 in Display-Bytefolge (MSB zuerst) bringen.
+ */
+static inline uint16_t swap16(uint16_t v) {
+  return (uint16_t)((v << 8) | (v >> 8));
+}
+
+/**
+ * @brief Startet so viele Baender, wie freie Puffer vorhanden sind.
+ */
+static void pump() {
+  while (jobIndex < jobCount && !slotBusy[nextSlot]) {
+    const TftRect &r = jobs[jobIndex];
+    const int16_t w = r.x1 - r.x0 + 1;
+
+    // Ganze Zeilen pro Band (mind. 1, Puffer ist >= Displaybreite)
+    int16_t rows = (int16_t)(capacity / (uint32_t)w);
+    if (rows < 1) rows = 1;
+    if (rows > r.y1 - jobRow + 1) rows = r.y1 - jobRow + 1;
+
+    uint16_t* buf = slotBuf[nextSlot];
+    for (int16_t i = 0; i < rows; i++) {
+      uint16_t* line = buf + (size_t)i * w;
+      readRow(r.x0, jobRow + i, w, line);
+      for (int16_t k = 0; k < w; k++) line[k] = swap16(line[k]);
+    }
+
+    const uint32_t count = (uint32_t)w * (uint32_t)rows;
+    if (!tr.start(tr.ctx, nextSlot, r.x0, jobRow, w, rows, buf, count)) {
+      // Transport voll: spaeter erneut versuchen (Band wird neu gelesen)
+      return;
+    }
+
+    slotBusy[nextSlot] = true;
+    nextSlot ^= 1;
+    bandsStarted++;
+
+    jobRow += rows;
+    if (jobRow > r.y1) {
+      jobIndex++;
+      if (jobIndex < jobCount) jobRow = jobs[jobIndex].y0;
+    }
+  }
+}
+
+/**
+ * @brief Gibt fertig uebertragene Puffer frei (in Startreihenfolge).
+ */
+static void collect() {
+  uint8_t done = tr.collect(tr.ctx);
+  while (done > 0 && slotBusy[oldestSlot]) {
+    slotBusy[oldestSlot] = false;
+    oldestSlot ^= 1;
+    done--;
+  }
+}
+
+void tftFlushQueueInit(uint16_t* buf0, uint16_t* buf1, uint32_t capacityPx,
+                       TftRowReader reader, const TftFlushTransport &transport) {
+  slotBuf[0] = buf0;
+  slotBuf[1] = buf1;
+  slotBusy[0] = slotBusy[1] = false;
+  nextSlot = oldestSlot = 0;
+
+  capacity = capacityPx;
+  readRow = reader;
+  tr = transport;
+
+  jobCount = jobIndex = 0;
+  jobRow = 0;
+  bandsStarted = 0;
+}
+
+bool tftFlushQueueSubmit(const TftRect* rects, uint8_t count) {
+  if (tftFlushQueueBusy()) return false;
+  if (count > TFT_FLUSH_MAX_RECTS) count = TFT_FLUSH_MAX_RECTS;
+
+  for (uint8_t i = 0; i < count; i++) jobs[i] = rects[i];
+  jobCount = count;
+  jobIndex = 0;
+  jobRow = (count > 0) ? jobs[0].y0 : 0;
+
+  pump();
+  return true;
+}
+
+bool tftFlushQueueBusy() {
+  if (!tr.collect) return false;
+
+  collect();
+  pump();
+
+  return (jobIndex < jobCount) || slotBusy[0] || slotBusy[1];
+}
+
+void tftFlushQueueAbort() {
+  jobCount = jobIndex = 0;
+  jobRow = 0;
+  slotBusy[0] = slotBusy[1] = false;
+  oldestSlot = nextSlot;
+}
+
+uint32_t tftFlushQueueBandsStarted() { return bandsStarted; }
@@ -0,0 +1,82 @@
+// lib/TFTDisplay/TFTFlushQueue.h
+//
+// Hardwareunabhaengige Warteschlange fuer den asynchronen Display-Flush.
+//
+// Idee:
+// - TFTDisplay uebergibt die Dirty-Rechtecke eines fertigen Frames (Submit).
+// - Die Queue zerlegt sie in Baender (ganze Zeilen), die in einen von zwei
+//   Staging-Puffern passen, und reicht sie an einen Transport weiter
+//   (ESP32: SPI-DMA, Host: Stand-in fuer Tests).
+// - Waehrend ein Band uebertragen wird, fuellt die Queue bereits den zweiten Puffer
+//   (Double-Buffering). Der Aufrufer muss nur regelmaessig tftFlushQueueBusy() pollen.
+//
+// Wichtig:
+// - Kein Arduino-/ESP-IDF-Include: Modul laeuft unveraendert auf dem Host.
+// - Pixel im Staging-Puffer liegen in Display-Bytefolge (RGB565 big endian).
+
+#pragma once
+#include <stdint.h>
+
+#include "TFTDirtyRects.h"   // TftRect
+
+/**
+ * Liefert w Pixel ab (x, y) als RGB565 (native Bytefolge).
+ * Wird beim Befuellen der Staging-Puffer pro Zeile aufgerufen.
+ */
+typedef void (*TftRowReader)(int16_t x, int16_t y, int16_t w, uint16_t* out);
+
+/**
+ * Transport-Schnittstelle (Hardware bzw. Host-Stand-in).
+ *
+ * start:   startet die Uebertragung eines Bandes (Address-Window + Pixel),
+ *          darf nicht blockieren. false => Transport hat keinen Platz.
+ * collect: Anzahl der seit dem letzten Aufruf abgeschlossenen Baender
+ *          (in Startreihenfolge), darf nicht blockieren.
+ */
+struct TftFlushTransport {
+  bool (*start)(void* ctx, uint8_t slot,
+                int16_t x, int16_t y, int16_t w, int16_t h,
+                const uint16_t* px, uint32_t count);
+  uint8_t (*collect)(void* ctx);
+  void* ctx;
+};
+
+// Max. Anzahl Rechtecke pro Submit
+#define TFT_FLUSH_MAX_RECTS 16
+
+/**
+ * Initialisiert die Queue.
+ *
+ * @param buf0,buf1   zwei Staging-Puffer (auf ESP32 DMA-faehig)
+ * @param capacityPx  Groesse jedes Puffers in Pixeln (>= Displaybreite)
+ * @param reader      Pixelquelle (Framebuffer)
+ * @param transport   Hardware- oder Host-Transport
+ */
+void tftFlushQueueInit(uint16_t* buf0, uint16_t* buf1, uint32_t capacityPx,
+                       TftRowReader reader, const TftFlushTransport &transport);
+
+/**
+ * Uebernimmt die Rechtecke eines Frames und startet die ersten Baender.
+ *
+ * @return false wenn der vorherige Frame noch nicht komplett raus ist
+ *         (dann wird nichts uebernommen)
+ */
+bool tftFlushQueueSubmit(const TftRect* rects, uint8_t count);
+
+/**
+ * Sammelt fertige Baender ein, startet die naechsten (nicht blockierend).
+ *
+ * @return true solange noch Pixel des letzten Frames unterwegs/ausstehend sind
+ */
+bool tftFlushQueueBusy();
+
+/**
+ * Verwirft den laufenden Frame (offene Rechtecke, belegte Puffer), z.B. nach
+ * einer Zeitueberschreitung. Der Transport muss selbst verhindern, dass
+ * Puffer/Deskriptoren, die noch in der Hardware stecken, wiederverwendet werden
+ * (start() liefert dann false) und dass deren Fertigmeldung gezaehlt wird.
+ */
+void tftFlushQueueAbort();
+
+// Statistik (optional, z.B. fuer Host-Tests)
+uint32_t tftFlushQueueBandsStarted();
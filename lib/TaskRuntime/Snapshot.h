@@ -0,0 +1,87 @@
+// lib/TaskRuntime/Snapshot.h
+//
+// Versionierter Zustand fuer genau einen Schreiber und beliebig viele Leser
+// (Seqlock), z.B. UI-State: Input-Task schreibt, Render-Task liest.
+//
+// Prinzip:
+// - Versionszaehler ungerade = Schreiben laeuft, gerade = Daten konsistent.
+// - Leser kopieren die Daten und pruefen danach, ob sich die Version geaendert
+//   hat; wenn ja, wird die Kopie verworfen und wiederholt. Leser blockieren den
+//   Schreiber nie, der Schreiber wartet nie auf Leser.
+// - Die Daten liegen als atomare 32-Bit-Woerter vor (relaxed), damit das
+//   gleichzeitige Kopieren auch formal kein Data Race ist (ThreadSanitizer).
+// - Leser warten aktiv, solange ein Schreiben laeuft: ein Leser darf daher nicht
+//   hoeher priorisiert auf demselben Kern laufen wie der Schreiber.
+//
+// Header-only, ohne Arduino-Include: laeuft unveraendert auf dem Host.
+
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <type_traits>
+
+template <typename T>
+struct Snapshot {
+  static_assert(std::is_trivially_copyable<T>::value, "Snapshot<T>: T muss trivial kopierbar sein");
+
+  static const uint32_t WORDS = (uint32_t)((sizeof(T) + 3) / 4);
+
+  std::atomic<uint32_t> seq;
+  std::atomic<uint32_t> words[WORDS];
+};
+
+template <typename T>
+static inline void snapshotInit(Snapshot<T> &s, const T &value) {
+  uint32_t buf[Snapshot<T>::WORDS] = {};
+  memcpy(buf, &value, sizeof(T));
+  for (uint32_t i = 0; i < Snapshot<T>::WORDS; i++) s.words[i].store(buf[i], std::memory_order_relaxed);
+  s.seq.store(0, std::memory_order_release);
+}
+
+/**
+ * @brief Neuen Stand veroeffentlichen (nur ein Schreiber).
+ */
+template <typename T>
+static inline void snapshotPublish(Snapshot<T> &s, const T &value) {
+  uint32_t buf[Snapshot<T>::WORDS] = {};
+  memcpy(buf, &value, sizeof(T));
+
+  const uint32_t v = s.seq.load(std::memory_order_relaxed);
+  s.seq.store(v + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  for (uint32_t i = 0; i < Snapshot<T>::WORDS; i++) s.words[i].store(buf[i], std::memory_order_relaxed);
+
+  s.seq.store(v + 2, std::memory_order_release);
+}
+
+/**
+ * @brief Aktuelle Version (gerade Zahl; aendert sich mit jedem Publish).
+ */
+template <typename T>
+static inline uint32_t snapshotVersion(const Snapshot<T> &s) {
+  return s.seq.load(std::memory_order_acquire) & ~1u;
+}
+
+/**
+ * @brief Konsistente Kopie lesen.
+ * @return Version der gelesenen Daten
+ */
+template <typename T>
+static inline uint32_t snapshotRead(const Snapshot<T> &s, T &out) {
+  uint32_t buf[Snapshot<T>::WORDS];
+
+  for (;;) {
+    const uint32_t v0 = s.seq.load(std::memory_order_acquire);
+    if (v0 & 1u) continue;   // Schreiber ist gerade dran (dauert nur wenige Woerter)
+
+    for (uint32_t i = 0; i < Snapshot<T>::WORDS; i++) buf[i] = s.words[i].load(std::memory_order_relaxed);
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (s.seq.load(std::memory_order_relaxed) == v0) {
+      memcpy(&out, buf, sizeof(T));
+      return v0;
+    }
+  }
+}
@@ -0,0 +1,42 @@
+// lib/TaskRuntime/TaskRuntime.h
+//
+// Duenne Task-Schicht fuer den Mehrkern-Betrieb (GUI_TASKS, config.h).
+//
+// Idee:
+// - Ein Task ist eine Step-Funktion, die zyklisch aufgerufen wird
+//   (periodMs > 0: danach schlafen, 0: nur kurz abgeben).
+// - ESP32: FreeRTOS-Task, fest auf einen Kern gepinnt (TaskRuntimeFreeRTOS.cpp).
+// - Host:  std::thread (TaskRuntimeThread.cpp), Prioritaet/Kern werden ignoriert.
+//   Damit laesst sich das Zusammenspiel der Tasks unter Linux stressen.
+// - Kommunikation zwischen Tasks nur ueber lock-freie Strukturen
+//   (InputEvents-Queue, Snapshot.h), keine Mutexe.
+
+#pragma once
+#include <stdint.h>
+
+typedef void (*TaskStep)(void* arg);
+
+struct TaskSpec {
+  const char* name;
+  TaskStep step;
+  void* arg;
+  uint8_t priority;      // FreeRTOS-Prioritaet (hoeher = wichtiger)
+  int8_t core;           // 0/1, -1 = beliebig
+  uint32_t stackBytes;
+  uint32_t periodMs;     // Pause nach jedem Step (0 = nur Yield)
+};
+
+// Max. Anzahl gleichzeitig laufender Tasks
+#ifndef TASK_MAX
+#define TASK_MAX 6
+#endif
+
+// Task starten. false => kein Platz oder Erzeugen fehlgeschlagen
+bool taskStart(const TaskSpec &spec);
+
+// Alle Tasks beenden und warten, bis sie stehen (Host/Tests; auf dem ESP32
+// laufen die Tasks normalerweise bis zum Reset)
+void taskStopAll();
+
+// Anzahl Step-Aufrufe eines Tasks (Diagnose, Index in Startreihenfolge)
+uint32_t taskStepCount(uint8_t index);
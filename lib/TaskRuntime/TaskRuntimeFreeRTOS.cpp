@@ -0,0 +1,73 @@
+// lib/TaskRuntime/TaskRuntimeFreeRTOS.cpp
+//
+// ESP32-Port der Task-Schicht (siehe TaskRuntime.h): FreeRTOS-Tasks,
+// gepinnt per xTaskCreatePinnedToCore.
+
+#ifdef ESP32
+
+#include "TaskRuntime.h"
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <atomic>
+
+struct TaskSlot {
+  TaskSpec spec;
+  TaskHandle_t handle;
+  std::atomic<uint32_t> steps;
+  std::atomic<bool> run;
+};
+
+static TaskSlot slots[TASK_MAX];
+static uint8_t slotCount = 0;
+
+static void taskMain(void* arg) {
+  TaskSlot &t = *(TaskSlot*)arg;
+  const TickType_t period = pdMS_TO_TICKS(t.spec.periodMs);
+
+  while (t.run.load(std::memory_order_relaxed)) {
+    t.spec.step(t.spec.arg);
+    t.steps.fetch_add(1, std::memory_order_relaxed);
+
+    // periodMs 0 oder kuerzer als ein Tick: nur abgeben (gleiche Prioritaet kommt dran)
+    if (period > 0) vTaskDelay(period);
+    else taskYIELD();
+  }
+
+  t.handle = nullptr;
+  vTaskDelete(nullptr);
+}
+
+bool taskStart(const TaskSpec &spec) {
+  if (slotCount >= TASK_MAX || !spec.step) return false;
+
+  TaskSlot &t = slots[slotCount];
+  t.spec = spec;
+  t.steps.store(0, std::memory_order_relaxed);
+  t.run.store(true, std::memory_order_relaxed);
+
+  const BaseType_t core = (spec.core < 0) ? tskNO_AFFINITY : spec.core;
+  if (xTaskCreatePinnedToCore(taskMain, spec.name, spec.stackBytes, &t,
+                              spec.priority, &t.handle, core) != pdPASS) {
+    return false;
+  }
+
+  slotCount++;
+  return true;
+}
+
+void taskStopAll() {
+  for (uint8_t i = 0; i < slotCount; i++) slots[i].run.store(false, std::memory_order_relaxed);
+  for (uint8_t i = 0; i < slotCount; i++) {
+    while (slots[i].handle) vTaskDelay(1);
+  }
+  slotCount = 0;
+}
+
+uint32_t taskStepCount(uint8_t index) {
+  return (index < slotCount) ? slots[index].steps.load(std::memory_order_relaxed) : 0;
+}
+
+#endif
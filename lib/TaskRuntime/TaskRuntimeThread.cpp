@@ -0,0 +1,57 @@
+// lib/TaskRuntime/TaskRuntimeThread.cpp
+//
+// Host-Port der Task-Schicht (siehe TaskRuntime.h): ein std::thread pro Task.
+// Prioritaet und Kern werden ignoriert, periodMs wird mit echter Zeit geschlafen.
+
+#ifndef ARDUINO
+
+#include "TaskRuntime.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+struct TaskSlot {
+  TaskSpec spec;
+  std::thread thread;
+  std::atomic<uint32_t> steps;
+};
+
+static TaskSlot slots[TASK_MAX];
+static uint8_t slotCount = 0;
+static std::atomic<bool> running(false);
+
+static void taskMain(TaskSlot* t) {
+  while (running.load(std::memory_order_relaxed)) {
+    t->spec.step(t->spec.arg);
+    t->steps.fetch_add(1, std::memory_order_relaxed);
+
+    if (t->spec.periodMs > 0) std::this_thread::sleep_for(std::chrono::milliseconds(t->spec.periodMs));
+    else std::this_thread::yield();
+  }
+}
+
+bool taskStart(const TaskSpec &spec) {
+  if (slotCount >= TASK_MAX || !spec.step) return false;
+
+  TaskSlot &t = slots[slotCount++];
+  t.spec = spec;
+  t.steps.store(0, std::memory_order_relaxed);
+  running.store(true, std::memory_order_relaxed);
+  t.thread = std::thread(taskMain, &t);
+  return true;
+}
+
+void taskStopAll() {
+  running.store(false, std::memory_order_relaxed);
+  for (uint8_t i = 0; i < slotCount; i++) {
+    if (slots[i].thread.joinable()) slots[i].thread.join();
+  }
+  slotCount = 0;
+}
+
+uint32_t taskStepCount(uint8_t index) {
+  return (index < slotCount) ? slots[index].steps.load(std::memory_order_relaxed) : 0;
+}
+
+#endif
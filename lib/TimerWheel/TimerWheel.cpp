@@ -0,0 +1,302 @@
+// lib/TimerWheel/TimerWheel.cpp
+//
+// Hierarchisches Timer-Rad (siehe TimerWheel.h).
+//
+// Aufbau (Tick = 1 ms, alle Slots in einem Array):
+//   Ebene 0: Slot 0..255   = Ablauf in den naechsten 256 Ticks, exakt (e & 255)
+//   Ebene 1: Slot 256..319 = Ablauf in < 2^14 Ticks, nach (e >> 8) & 63
+//   Ebene 2: Slot 320..383 = Ablauf in < 2^20 Ticks, nach (e >> 14) & 63
+//   Weiter entfernt: im letzten Ebene-2-Slot geparkt, wird dort neu einsortiert.
+// An jeder 256er-Grenze wird der faellige Slot von Ebene 1 (und an 2^14er-Grenzen
+// zuerst der von Ebene 2) nach unten umgehaengt. Alle Grenzen teilen 2^32,
+// daher bleibt das Rad auch beim Ueberlauf von millis() konsistent.
+//
+// nextTick = naechster noch nicht abgearbeiteter Tick; alle Timer mit
+// Ablauf < nextTick sind gefeuert.
+
+#include "TimerWheel.h"
+
+static const uint16_t L0_SLOTS = 256;
+static const uint16_t L1_BASE  = 256;
+static const uint16_t L2_BASE  = 320;
+static const uint16_t SLOTS    = TIMER_WHEEL_SLOTS;
+
+static const uint32_t L1_SPAN = 1UL << 14;
+static const uint32_t L2_SPAN = 1UL << 20;
+
+static const uint16_t TIMER_IDLE   = 0xFFFF;
+static const uint16_t TIMER_FIRING = SLOTS;   // Liste der gerade feuernden Timer
+
+static_assert(L2_BASE + 64 == SLOTS, "TIMER_WHEEL_SLOTS passt nicht zu den Ebenen");
+
+// Standard-Rad (timerRun(nowMs) usw.) und das Rad fuer neue Timer (timerWheelSelect())
+static TimerWheel defaultWheel;
+static TimerWheel* selected = &defaultWheel;
+
+// --------------------
+// Slot-Listen
+// --------------------
+
+static void slotPush(TimerWheel &w, uint16_t slot, Timer &t) {
+  t.slot = slot;
+  t.prev = nullptr;
+  t.next = w.heads[slot];
+  if (t.next) t.next->prev = &t;
+  w.heads[slot] = &t;
+  if (slot < SLOTS) w.occupied[slot >> 5] |= 1UL << (slot & 31);
+}
+
+static void slotUnlink(TimerWheel &w, Timer &t) {
+  if (t.prev) t.prev->next = t.next;
+  else w.heads[t.slot] = t.next;
+  if (t.next) t.next->prev = t.prev;
+
+  if (t.slot < SLOTS && !w.heads[t.slot]) w.occupied[t.slot >> 5] &= ~(1UL << (t.slot & 31));
+  t.slot = TIMER_IDLE;
+  t.next = t.prev = nullptr;
+}
+
+/**
+ * @brief Slot fuer einen Ablaufzeitpunkt relativ zu nextTick.
+ */
+static uint16_t slotFor(const TimerWheel &w, uint32_t e) {
+  const uint32_t nextTick = w.nextTick;
+  const uint32_t d = e - nextTick;
+  if (d < L0_SLOTS) return (uint16_t)(e & 255);
+  if (d < L1_SPAN)  return (uint16_t)(L1_BASE + ((e >> 8) & 63));
+  if (d < L2_SPAN)  return (uint16_t)(L2_BASE + ((e >> 14) & 63));
+  return (uint16_t)(L2_BASE + (((nextTick >> 14) + 63) & 63));   // parken
+}
+
+/**
+ * @brief Offset (0..size-1) des ersten belegten Slots ab 'from' (zyklisch)
+ *        innerhalb einer Ebene [base, base+size), -1 = Ebene leer.
+ */
+static int16_t firstOccupied(const TimerWheel &w, uint16_t base, uint16_t size, uint16_t from) {
+  uint16_t off = 0;
+  while (off < size) {
+    const uint16_t i = (uint16_t)((from + off) % size);
+    const uint16_t bit = (uint16_t)(base + i);
+
+    // Bits bis Wortende, Ebenenende und Suchende
+    uint16_t avail = (uint16_t)(32 - (bit & 31));
+    if (avail > size - i) avail = (uint16_t)(size - i);
+    if (avail > size - off) avail = (uint16_t)(size - off);
+
+    uint32_t bits = w.occupied[bit >> 5] >> (bit & 31);
+    if (avail < 32) bits &= (1UL << avail) - 1;
+    if (bits) return (int16_t)(off + __builtin_ctz(bits));
+    off = (uint16_t)(off + avail);
+  }
+  return -1;
+}
+
+/**
+ * @brief Abstand des fruehesten Ablaufs in einem Slot zu nextTick
+ *        (nur grobe Ebenen, dort ist die Liste nicht sortiert).
+ */
+static uint32_t earliestIn(const TimerWheel &w, uint16_t slot) {
+  uint32_t best = TIMER_NO_DEADLINE;
+  for (const Timer* t = w.heads[slot]; t; t = t->next) {
+    const uint32_t d = t->expiresMs - w.nextTick;
+    if (d < best) best = d;
+  }
+  return best;
+}
+
+/**
+ * @brief Abstand des fruehesten Ablaufs zu nextTick (TIMER_NO_DEADLINE = leer).
+ *
+ * Ebene 0 ist exakt. In Ebene 1 liegen die Slots ab dem naechsten noch nicht
+ * umsortierten Block zyklisch in Zeitreihenfolge, es genuegt also der erste
+ * belegte Slot. Ebene 2 enthaelt auch geparkte (weit entfernte) Timer ausserhalb
+ * dieser Ordnung; sie ist selten belegt und wird ganz durchsucht.
+ * Ein grober Timer kann frueher ablaufen als einer in Ebene 0 (eingehaengt,
+ * als nextTick noch weiter zurueck lag) => Minimum ueber alle drei Ebenen.
+ */
+static uint32_t earliestOffset(const TimerWheel &w) {
+  if (w.armedCount == 0) return TIMER_NO_DEADLINE;
+  const uint32_t nextTick = w.nextTick;
+
+  uint32_t best = TIMER_NO_DEADLINE;
+
+  int16_t off = firstOccupied(w, 0, L0_SLOTS, (uint16_t)(nextTick & 255));
+  if (off >= 0) best = (uint32_t)off;
+
+  const uint16_t from1 = (uint16_t)(((nextTick + 255) >> 8) & 63);
+  off = firstOccupied(w, L1_BASE, 64, from1);
+  if (off >= 0) {
+    const uint32_t d = earliestIn(w, (uint16_t)(L1_BASE + ((from1 + off) & 63)));
+    if (d < best) best = d;
+  }
+
+  for (uint16_t i = L2_BASE / 32; i < SLOTS / 32; i++) {
+    for (uint32_t bits = w.occupied[i]; bits; bits &= bits - 1) {
+      const uint32_t d = earliestIn(w, (uint16_t)(i * 32 + __builtin_ctz(bits)));
+      if (d < best) best = d;
+    }
+  }
+  return best;
+}
+
+/**
+ * @brief true, wenn in den groben Ebenen Timer liegen (Grenzen muessen abgearbeitet werden).
+ */
+static bool coarseOccupied(const TimerWheel &w) {
+  for (uint16_t i = L1_BASE / 32; i < SLOTS / 32; i++) {
+    if (w.occupied[i]) return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Alle Timer eines groben Slots neu einsortieren (relativ zu nextTick).
+ */
+static void cascade(TimerWheel &w, uint16_t slot) {
+  Timer* t = w.heads[slot];
+  w.heads[slot] = nullptr;
+  w.occupied[slot >> 5] &= ~(1UL << (slot & 31));
+
+  while (t) {
+    Timer* next = t->next;
+    slotPush(w, slotFor(w, t->expiresMs), *t);
+    t = next;
+  }
+}
+
+/**
+ * @brief Tick nextTick abarbeiten: umsortieren, Slot feuern.
+ */
+static uint16_t processTick(TimerWheel &w) {
+  const uint32_t tick = w.nextTick;
+  if ((tick & 255) == 0) {
+    if ((tick & (L1_SPAN - 1)) == 0) cascade(w, (uint16_t)(L2_BASE + ((tick >> 14) & 63)));
+    cascade(w, (uint16_t)(L1_BASE + ((tick >> 8) & 63)));
+  }
+
+  // Faellige Liste abhaengen; Callbacks koennen danach frei neu starten
+  // (auch in denselben Slot, der dann erst in 256 Ticks wieder dran ist)
+  w.nextTick = tick + 1;
+  const uint16_t slot = (uint16_t)(tick & 255);
+  if (!w.heads[slot]) return 0;
+
+  // Ab hier gelten sie als inaktiv (timerCancel() zaehlt sie nicht mehr)
+  w.heads[TIMER_FIRING] = w.heads[slot];
+  for (Timer* t = w.heads[slot]; t; t = t->next) {
+    t->slot = TIMER_FIRING;
+    w.armedCount--;
+  }
+  w.heads[slot] = nullptr;
+  w.occupied[slot >> 5] &= ~(1UL << (slot & 31));
+
+  uint16_t fired = 0;
+  while (Timer* t = w.heads[TIMER_FIRING]) {
+    slotUnlink(w, *t);
+    t->fn(t->arg);
+    fired++;
+  }
+  return fired;
+}
+
+// --------------------
+// Public API
+// --------------------
+
+void timerWheelInit(TimerWheel &w, uint32_t nowMs) {
+  for (uint16_t i = 0; i <= SLOTS; i++) w.heads[i] = nullptr;
+  for (uint16_t i = 0; i < SLOTS / 32; i++) w.occupied[i] = 0;
+  w.nextTick = nowMs;
+  w.armedCount = 0;
+}
+
+void timerWheelInit(uint32_t nowMs) {
+  timerWheelInit(defaultWheel, nowMs);
+}
+
+void timerWheelSelect(TimerWheel* w) {
+  selected = w ? w : &defaultWheel;
+}
+
+void timerInit(Timer &t, TimerFn fn, void* arg) {
+  t.next = t.prev = nullptr;
+  t.wheel = selected;
+  t.expiresMs = 0;
+  t.slot = TIMER_IDLE;
+  t.fn = fn;
+  t.arg = arg;
+}
+
+void timerArm(Timer &t, uint32_t nowMs, uint32_t delayMs) {
+  timerCancel(t);
+  TimerWheel &w = *t.wheel;
+
+  // Nie vor nextTick: bereits abgearbeitete Ticks kommen nicht wieder
+  uint32_t e = nowMs + delayMs;
+  if ((int32_t)(e - w.nextTick) < 0) e = w.nextTick;
+
+  t.expiresMs = e;
+  slotPush(w, slotFor(w, e), t);
+  w.armedCount++;
+}
+
+void timerCancel(Timer &t) {
+  if (t.slot == TIMER_IDLE) return;
+  const bool firing = (t.slot == TIMER_FIRING);
+  slotUnlink(*t.wheel, t);
+  if (!firing) t.wheel->armedCount--;
+}
+
+bool timerArmed(const Timer &t) {
+  return t.slot != TIMER_IDLE && t.slot != TIMER_FIRING;
+}
+
+uint16_t timerRun(TimerWheel &w, uint32_t nowMs) {
+  uint16_t fired = 0;
+
+  while ((int32_t)(nowMs - w.nextTick) >= 0) {
+    fired += processTick(w);
+
+    // Ohne Arbeit bis nowMs direkt vorspringen: bis zum naechsten Ablauf bzw.
+    // zur naechsten 256er-Grenze, falls grobe Ebenen umsortiert werden muessen
+    uint32_t skip = earliestOffset(w);
+    if (coarseOccupied(w)) {
+      const uint32_t boundary = ((w.nextTick + 255) & ~255UL) - w.nextTick;
+      if (boundary < skip) skip = boundary;
+    }
+    if (skip == TIMER_NO_DEADLINE || (int32_t)(nowMs - w.nextTick) < (int32_t)skip) {
+      // Nichts mehr faellig bis nowMs
+      if ((int32_t)(nowMs - w.nextTick) >= 0) w.nextTick = nowMs + 1;
+      break;
+    }
+    w.nextTick += skip;
+  }
+  return fired;
+}
+
+uint16_t timerRun(uint32_t nowMs) {
+  return timerRun(defaultWheel, nowMs);
+}
+
+uint32_t timerNextDeadlineMs(const TimerWheel &w, uint32_t nowMs) {
+  const uint32_t off = earliestOffset(w);
+  if (off == TIMER_NO_DEADLINE) return TIMER_NO_DEADLINE;
+
+  const int32_t d = (int32_t)(w.nextTick + off - nowMs);
+  return (d > 0) ? (uint32_t)d : 0;
+}
+
+uint32_t timerNextDeadlineMs(uint32_t nowMs) {
+  return timerNextDeadlineMs(defaultWheel, nowMs);
+}
+
+uint32_t timerIdleUs(const TimerWheel &w, uint32_t nowMs, uint32_t nowUs) {
+  const uint32_t ms = timerNextDeadlineMs(w, nowMs);
+  if (ms == TIMER_NO_DEADLINE) return TIMER_NO_DEADLINE;
+  if (ms == 0) return 0;
+  if (ms >= TIMER_NO_DEADLINE / 1000) return TIMER_NO_DEADLINE - 1;
+  return ms * 1000 - nowUs % 1000;
+}
+
+uint32_t timerIdleUs(uint32_t nowMs, uint32_t nowUs) {
+  return timerIdleUs(defaultWheel, nowMs, nowUs);
+}
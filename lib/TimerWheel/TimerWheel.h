@@ -0,0 +1,104 @@
+// lib/TimerWheel/TimerWheel.h
+//
+// Zentrale Timer fuer Deadlines der Module (Toast-Ende, Long-Press, Entprell-Tick).
+//
+// Idee:
+// - Module besitzen ihre Timer (struct Timer, statisch) und registrieren einen
+//   Callback statt selbst millis() zu vergleichen.
+// - Hierarchisches Timer-Rad mit 1-ms-Ticks: 256 Slots fein (256 ms), darueber
+//   2 x 64 grobe Slots (16 s, ~17 min). Weiter entfernte Timer werden geparkt
+//   und beim Umsortieren neu eingehaengt.
+// - timerArm()/timerCancel() sind O(1) (intrusive doppelt verkettete Liste),
+//   timerNextDeadlineMs() sucht ueber Belegungs-Bitmaps (wenige Wortzugriffe).
+//   Daraus berechnet die Hauptschleife, wie lange sie ruhen darf (EventLoop).
+//
+// Nicht thread-sicher: ein Rad gehoert dem Kontext, der timerRun() dafuer
+// aufruft. Mit GUI_TASKS hat der Netz-Task ein eigenes Rad (Radio-Client,
+// Telemetrie), das Standard-Rad gehoert dem Input-Task. Nicht aus ISRs.
+//
+// Kein Arduino-Include (Zeit wird uebergeben): laeuft unveraendert auf dem Host.
+
+#pragma once
+#include <stdint.h>
+
+// "Kein Timer aktiv"
+#define TIMER_NO_DEADLINE 0xFFFFFFFFUL
+
+// Slots je Rad: 256 fein + 2 x 64 grob
+#define TIMER_WHEEL_SLOTS 384
+
+typedef void (*TimerFn)(void* arg);
+
+struct TimerWheel;
+
+struct Timer {
+  Timer* next;
+  Timer* prev;
+  TimerWheel* wheel;       // Rad aus timerInit()
+  uint32_t expiresMs;      // Ablaufzeitpunkt (millis())
+  uint16_t slot;           // Slot im Rad, TIMER_IDLE = nicht aktiv
+  TimerFn fn;
+  void* arg;
+};
+
+// Zustand eines Rads (Inhalt nur fuer TimerWheel.cpp)
+struct TimerWheel {
+  Timer* heads[TIMER_WHEEL_SLOTS + 1];        // + Liste der gerade feuernden Timer
+  uint32_t occupied[TIMER_WHEEL_SLOTS / 32];  // Bit = Slot nicht leer
+  uint32_t nextTick;
+  uint16_t armedCount;
+};
+
+/**
+ * @brief Rad leeren und Zeit setzen (setup(), vor dem ersten timerArm()).
+ *        Ohne Rad-Argument: das Standard-Rad.
+ */
+void timerWheelInit(uint32_t nowMs);
+void timerWheelInit(TimerWheel &w, uint32_t nowMs);
+
+/**
+ * @brief Rad fuer folgende timerInit()-Aufrufe waehlen (nullptr = Standard-Rad).
+ *        Z.B. um die Init-Funktion eines Moduls herum, dessen Timer ein anderer
+ *        Task abarbeitet.
+ */
+void timerWheelSelect(TimerWheel* w);
+
+/**
+ * @brief Timer mit Callback vorbereiten (einmalig, Timer ist danach inaktiv).
+ *        Er gehoert dem mit timerWheelSelect() gewaehlten Rad.
+ */
+void timerInit(Timer &t, TimerFn fn, void* arg);
+
+/**
+ * @brief Timer (neu) starten: Callback nach delayMs. Laeuft er schon, wird er verschoben.
+ *        Nie in einer bereits abgearbeiteten Millisekunde: delayMs = 0 direkt nach
+ *        timerRun(nowMs) feuert erst in der naechsten.
+ */
+void timerArm(Timer &t, uint32_t nowMs, uint32_t delayMs);
+
+// Timer stoppen (inaktiver Timer: nichts)
+void timerCancel(Timer &t);
+
+bool timerArmed(const Timer &t);
+
+/**
+ * @brief Zeit bis nowMs abarbeiten: faellige Callbacks aufrufen.
+ *        Callbacks duerfen Timer (auch sich selbst) starten und stoppen.
+ * @return Anzahl aufgerufener Callbacks
+ */
+uint16_t timerRun(uint32_t nowMs);
+uint16_t timerRun(TimerWheel &w, uint32_t nowMs);
+
+/**
+ * @brief Millisekunden bis zum naechsten Ablauf (0 = faellig,
+ *        TIMER_NO_DEADLINE = kein Timer aktiv).
+ */
+uint32_t timerNextDeadlineMs(uint32_t nowMs);
+uint32_t timerNextDeadlineMs(const TimerWheel &w, uint32_t nowMs);
+
+/**
+ * @brief Wie timerNextDeadlineMs(), aber in µs fuer eventLoopIdle()
+ *        (angebrochene Millisekunde aus nowUs abgezogen).
+ */
+uint32_t timerIdleUs(uint32_t nowMs, uint32_t nowUs);
+uint32_t timerIdleUs(const TimerWheel &w, uint32_t nowMs, uint32_t nowUs);
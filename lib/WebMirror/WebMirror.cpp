@@ -0,0 +1,604 @@
+// lib/WebMirror/WebMirror.cpp
+//
+// Web-Spiegel (siehe WebMirror.h).
+//
+// Zustaende je Verbindung:
+//   HTTP   Anfrage sammeln (bis "\r\n\r\n", hoechstens WEB_RX_SIZE, request_timeout_ms)
+//          "GET /"   => Seite, danach schliessen
+//          "GET /ws" => 101, weiter als WS
+//          sonst     => 4xx, schliessen
+//   WS     Rahmen des Browsers auswerten, Deltas senden
+//
+// Gesendet wird ohne Warten: erst der Sendepuffer (Kopf, Deltas), dann der
+// Rest der Seite direkt aus dem Flash. Was nicht sofort rausgeht, wartet auf
+// NET_MUX_WRITE. Solange der Server lauscht, bleibt Light Sleep gesperrt
+// (EMAC steht sonst, Browser erreicht das Panel nicht).
+
+#include "WebMirror.h"
+#include "WebSocket.h"
+#include "WebPage.h"
+
+#include <Arduino.h>
+
+#include <GUI.h>
+#include <InputEvents.h>
+#include <EventLoop.h>
+#include <NetMux.h>
+#include <RadioSocket.h>
+#include <RadioTCP.h>
+
+#include <gui_config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+enum WebClientState : uint8_t {
+  WEB_FREE = 0,
+  WEB_HTTP,
+  WEB_WS
+};
+
+struct WebClient {
+  uint8_t state;
+  int sock;
+  int8_t muxSlot;
+  uint32_t openedMs;
+  uint32_t txMs;             // letzter Sendefortschritt (Zeitueberschreitung beim Schliessen)
+  bool closeAfterTx;         // nach dem Senden schliessen (Seite, Fehler, Close-Rahmen)
+
+  uint8_t rx[WEB_RX_SIZE];
+  uint16_t rxLen;
+
+  uint8_t tx[WEB_TX_SIZE];
+  uint16_t txLen;
+  const char* body;          // Seite (Flash), wird nach tx gesendet
+  size_t bodyLeft;
+
+  // Stand, den dieser Browser zuletzt bekommen hat
+  GuiState sent;
+  bool synced;               // false => naechstes Delta enthaelt alle Felder
+  uint32_t sentVersion;
+};
+
+// Snapshot-Versionen sind gerade: passt zu keiner
+static const uint32_t WEB_VERSION_NONE = 1;
+
+static WebClient clients[WEB_CLIENTS_MAX];
+
+static int listenSock = -1;
+static int8_t listenSlot = -1;
+static uint16_t boundPort = 0;
+
+static uint32_t lastVersion = 0;
+static bool behind = false;   // mindestens ein Browser wartet auf Platz im Sendepuffer
+
+static WebStats stats = {};
+
+// --------------------
+// Senden
+// --------------------
+
+static void dropClient(WebClient &c) {
+  if (c.state == WEB_WS) stats.sockets--;
+  netMuxRemove(c.muxSlot);
+  radioSockClose(c.sock);
+  c.muxSlot = -1;
+  c.sock = -1;
+  c.state = WEB_FREE;
+}
+
+/**
+ * @brief Bytes an den Sendepuffer haengen (ganz oder gar nicht).
+ */
+static bool queue(WebClient &c, const void* data, size_t len) {
+  if (len > sizeof(c.tx) - c.txLen) return false;
+  memcpy(c.tx + c.txLen, data, len);
+  c.txLen += (uint16_t)len;
+  return true;
+}
+
+static bool queueText(WebClient &c, const char* s) {
+  return queue(c, s, strlen(s));
+}
+
+static bool queueFrame(WebClient &c, uint8_t opcode, const void* payload, size_t len) {
+  uint8_t head[WS_HEADER_MAX];
+  const uint8_t n = wsFrameHeader(opcode, len, head);
+  if (n + len > sizeof(c.tx) - c.txLen) return false;
+  queue(c, head, n);
+  return queue(c, payload, len);
+}
+
+/**
+ * @brief So viel senden, wie der Socket nimmt; Rest wartet auf NET_MUX_WRITE.
+ */
+static void flush(WebClient &c) {
+  if (c.txLen > 0) {
+    const int n = radioSockSend(c.sock, c.tx, c.txLen);
+    if (n < 0) {
+      dropClient(c);
+      return;
+    }
+    if (n > 0) c.txMs = millis();
+    c.txLen -= (uint16_t)n;
+    memmove(c.tx, c.tx + n, c.txLen);
+  }
+  if (c.txLen == 0 && c.bodyLeft > 0) {
+    const int n = radioSockSend(c.sock, (const uint8_t*)c.body, c.bodyLeft);
+    if (n < 0) {
+      dropClient(c);
+      return;
+    }
+    if (n > 0) c.txMs = millis();
+    c.body += n;
+    c.bodyLeft -= (size_t)n;
+  }
+
+  const bool pending = c.txLen > 0 || c.bodyLeft > 0;
+  if (!pending && c.closeAfterTx) {
+    dropClient(c);
+    return;
+  }
+  netMuxInterest(c.muxSlot, pending ? (NET_MUX_READ | NET_MUX_WRITE) : NET_MUX_READ);
+}
+
+// --------------------
+// Deltas
+// --------------------
+
+// Begrenzter Schreiber fuer JSON-Texte
+struct JsonOut {
+  char* buf;
+  size_t cap;
+  size_t len;
+  bool first;
+};
+
+static void jsonRaw(JsonOut &o, const char* s) {
+  while (*s && o.len + 1 < o.cap) o.buf[o.len++] = *s++;
+  o.buf[o.len] = '\0';
+}
+
+static void jsonInt(JsonOut &o, const char* key, int32_t v) {
+  char item[24];
+  snprintf(item, sizeof(item), "%s\"%s\":%ld", o.first ? "" : ",", key, (long)v);
+  o.first = false;
+  jsonRaw(o, item);
+}
+
+static void jsonList(JsonOut &o, const char* key, const char* const* items, int count) {
+  char head[16];
+  snprintf(head, sizeof(head), "%s\"%s\":[", o.first ? "" : ",", key);
+  o.first = false;
+  jsonRaw(o, head);
+  for (int i = 0; i < count; i++) {
+    if (i > 0) jsonRaw(o, ",");
+    jsonRaw(o, "\"");
+    for (const char* p = items[i]; *p; p++) {
+      const char esc[3] = { '\\', *p, '\0' };
+      if (*p == '"' || *p == '\\') jsonRaw(o, esc);
+      else if ((uint8_t)*p >= 0x20) {
+        const char ch[2] = { *p, '\0' };
+        jsonRaw(o, ch);
+      }
+    }
+    jsonRaw(o, "\"");
+  }
+  jsonRaw(o, "]");
+}
+
+/**
+ * @brief Listen-Texte fuer die Seite (einmal nach dem Handshake).
+ */
+static bool queueHello(WebClient &c) {
+  const char* names[RADIO_MAX];
+  const uint8_t n = radioCount();
+  for (uint8_t r = 0; r < n; r++) names[r] = radioName(r);
+
+  char buf[WEB_TX_SIZE - WS_HEADER_MAX];
+  JsonOut o = { buf, sizeof(buf), 0, true };
+  jsonRaw(o, "{");
+  jsonList(o, "mod", GUI_MOD_LIST, GUI_MOD_COUNT);
+  jsonList(o, "pwr", GUI_PWR_LIST, GUI_PWR_COUNT);
+  jsonList(o, "rad", names, n);
+  jsonRaw(o, "}");
+  if (o.len + 1 >= o.cap) return false;   // abgeschnitten (Listen zu lang)
+  return queueFrame(c, WS_OP_TEXT, buf, o.len);
+}
+
+/**
+ * @brief Geaenderte Felder gegenueber dem Stand dieses Browsers senden.
+ * @return false = kein Platz im Sendepuffer (spaeter erneut, Stand bleibt alt)
+ */
+static bool queueDelta(WebClient &c, const GuiState &st) {
+  const GuiState &old = c.sent;
+  const bool all = !c.synced;
+
+  char buf[128];
+  JsonOut o = { buf, sizeof(buf), 0, true };
+  jsonRaw(o, "{");
+  if (all || st.screen != old.screen) jsonInt(o, "s", st.screen);
+  if (all || st.edit != old.edit) jsonInt(o, "e", st.edit ? 1 : 0);
+  if (all || st.cursor != old.cursor) jsonInt(o, "c", st.cursor);
+  if (all || st.radio != old.radio) jsonInt(o, "r", st.radio);
+  if (all || st.freq_hz != old.freq_hz) jsonInt(o, "f", st.freq_hz);
+  if (all || st.modIndex != old.modIndex) jsonInt(o, "m", st.modIndex);
+  if (all || st.pwrIndex != old.pwrIndex) jsonInt(o, "p", st.pwrIndex);
+  if (all || st.link != old.link) jsonInt(o, "l", st.link);
+  if (o.first) return true;   // nichts geaendert (z.B. nur Toast)
+  jsonRaw(o, "}");
+
+  if (!queueFrame(c, WS_OP_TEXT, buf, o.len)) {
+    stats.deferred++;
+    return false;
+  }
+  c.sent = st;
+  c.synced = true;
+  stats.deltas++;
+  stats.deltaBytes += (uint32_t)o.len;
+  return true;
+}
+
+// --------------------
+// Aktionen
+// --------------------
+
+/**
+ * @brief Nachricht des Browsers als Eingabe-Ereignis(se) in die Input-Queue.
+ */
+static void handleAction(const uint8_t* payload, size_t len) {
+  char msg[24];
+  if (len >= sizeof(msg)) {
+    stats.badRequests++;
+    return;
+  }
+  memcpy(msg, payload, len);
+  msg[len] = '\0';
+
+  const uint32_t us = micros();
+  uint8_t source = INPUT_SRC_ENC_BUTTON;
+  uint8_t type = INPUT_PRESS;
+  int32_t steps = 0;
+
+  if (strncmp(msg, "rot ", 4) == 0) {
+    steps = (int32_t)strtol(msg + 4, nullptr, 10);
+    const int32_t lim = WEB_CONFIG.rot_max;
+    if (steps > lim) steps = lim;
+    if (steps < -lim) steps = -lim;
+    if (steps == 0) return;
+  } else if (strcmp(msg, "press") == 0) {
+    // Encoder-Taster kurz (Default oben)
+  } else if (strcmp(msg, "long") == 0) {
+    type = INPUT_LONG_PRESS;
+  } else if (strcmp(msg, "left") == 0) {
+    source = INPUT_SRC_LEFT;
+  } else if (strcmp(msg, "right") == 0) {
+    source = INPUT_SRC_RIGHT;
+  } else {
+    stats.badRequests++;
+    return;
+  }
+  stats.actions++;
+
+  // Wie die Eingabe-Module: ein Ereignis je Rastung bzw. Tastendruck
+  const int32_t n = steps ? abs(steps) : 1;
+  for (int32_t i = 0; i < n; i++) {
+    const bool ok = steps ? inputPush(INPUT_SRC_ENCODER, INPUT_ROTATE, us, steps > 0 ? 1 : -1)
+                          : inputPush(source, type, us, 0);
+    stats.events++;
+    if (!ok) stats.dropped++;
+  }
+  eventLoopSignal();
+}
+
+/**
+ * @brief Vollstaendige Rahmen im Empfangspuffer abarbeiten.
+ */
+static void handleFrames(WebClient &c) {
+  size_t pos = 0;
+  while (c.state == WEB_WS && !c.closeAfterTx) {
+    WsFrame f;
+    const WsParseResult r = wsParseFrame(c.rx + pos, c.rxLen - pos, sizeof(c.rx) - 14, f);
+    if (r == WS_PARSE_MORE) break;
+
+    if (r == WS_PARSE_BAD) {
+      static const uint8_t PROTOCOL_ERROR[2] = { 1002 >> 8, 1002 & 0xFF };
+      stats.badRequests++;
+      queueFrame(c, WS_OP_CLOSE, PROTOCOL_ERROR, sizeof(PROTOCOL_ERROR));
+      c.closeAfterTx = true;
+      break;
+    }
+
+    switch (f.opcode) {
+      case WS_OP_TEXT:
+        handleAction(f.payload, f.len);
+        break;
+      case WS_OP_PING:
+        if (f.len <= 125) queueFrame(c, WS_OP_PONG, f.payload, f.len);
+        break;
+      case WS_OP_CLOSE:
+        // Status zurueck (hoechstens die 2 Bytes Code), dann schliessen
+        queueFrame(c, WS_OP_CLOSE, f.payload, f.len < 2 ? f.len : 2);
+        c.closeAfterTx = true;
+        break;
+      default:
+        break;   // Pong, Binaer: ignorieren
+    }
+    pos += f.size;
+  }
+
+  c.rxLen -= (uint16_t)pos;
+  memmove(c.rx, c.rx + pos, c.rxLen);
+}
+
+// --------------------
+// HTTP
+// --------------------
+
+/**
+ * @brief Kopfzeile suchen (Name ohne Gross-/Kleinschreibung).
+ * @return Wert (ohne fuehrende Leerzeichen, endet vor "\r\n") oder nullptr
+ */
+static const char* findHeader(const char* head, const char* name, size_t &len) {
+  const size_t nameLen = strlen(name);
+  for (const char* line = strstr(head, "\r\n"); line; line = strstr(line, "\r\n")) {
+    line += 2;
+    if (strncasecmp(line, name, nameLen) != 0 || line[nameLen] != ':') continue;
+
+    const char* v = line + nameLen + 1;
+    while (*v == ' ' || *v == '\t') v++;
+    const char* end = strstr(v, "\r\n");
+    len = end ? (size_t)(end - v) : strlen(v);
+    return v;
+  }
+  return nullptr;
+}
+
+static void respondError(WebClient &c, const char* status) {
+  char resp[128];
+  snprintf(resp, sizeof(resp), "HTTP/1.1 %s\r\nContent-Length: 0\r\nConnection: close\r\n\r\n", status);
+  queueText(c, resp);
+  c.closeAfterTx = true;
+  stats.badRequests++;
+}
+
+/**
+ * @brief Vollstaendige Anfrage beantworten (head ist 0-terminiert, ohne Leerzeile).
+ */
+static void handleRequest(WebClient &c, const char* head) {
+  if (strncmp(head, "GET ", 4) != 0) {
+    respondError(c, "405 Method Not Allowed");
+    return;
+  }
+  const char* path = head + 4;
+  const size_t pathLen = strcspn(path, " \r");
+
+  if ((pathLen == 1 && path[0] == '/') || (pathLen == 11 && strncmp(path, "/index.html", 11) == 0)) {
+    char resp[160];
+    snprintf(resp, sizeof(resp),
+             "HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=utf-8\r\n"
+             "Content-Length: %u\r\nCache-Control: no-cache\r\nConnection: close\r\n\r\n",
+             (unsigned)(sizeof(WEB_PAGE) - 1));
+    queueText(c, resp);
+    c.body = WEB_PAGE;
+    c.bodyLeft = sizeof(WEB_PAGE) - 1;
+    c.closeAfterTx = true;
+    stats.pages++;
+    return;
+  }
+
+  if (pathLen != 3 || strncmp(path, "/ws", 3) != 0) {
+    respondError(c, "404 Not Found");
+    return;
+  }
+
+  size_t upLen = 0, keyLen = 0;
+  const char* up = findHeader(head, "Upgrade", upLen);
+  const char* key = findHeader(head, "Sec-WebSocket-Key", keyLen);
+  if (!up || upLen != 9 || strncasecmp(up, "websocket", 9) != 0 || !key || keyLen == 0) {
+    respondError(c, "400 Bad Request");
+    return;
+  }
+
+  char accept[WS_ACCEPT_LEN + 1];
+  wsAcceptKey(key, keyLen, accept);
+  char resp[160];
+  snprintf(resp, sizeof(resp),
+           "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+           "Sec-WebSocket-Accept: %s\r\n\r\n", accept);
+  queueText(c, resp);
+
+  c.state = WEB_WS;
+  c.synced = false;
+  stats.sockets++;
+  stats.upgrades++;
+
+  // Listen + voller Stand sofort, nicht erst mit der naechsten Aenderung
+  if (!queueHello(c)) {
+    static const uint8_t INTERNAL_ERROR[2] = { 1011 >> 8, 1011 & 0xFF };
+    queueFrame(c, WS_OP_CLOSE, INTERNAL_ERROR, sizeof(INTERNAL_ERROR));
+    c.closeAfterTx = true;
+    return;
+  }
+  GuiState st;
+  c.sentVersion = guiReadState(st);
+  if (!queueDelta(c, st)) {
+    c.sentVersion = WEB_VERSION_NONE;   // mit dem naechsten webPoll() erneut
+    behind = true;
+  }
+}
+
+/**
+ * @brief Anfrage sammeln; sobald vollstaendig, beantworten.
+ */
+static void handleHttp(WebClient &c) {
+  for (uint16_t i = 3; i < c.rxLen; i++) {
+    if (memcmp(c.rx + i - 3, "\r\n\r\n", 4) != 0) continue;
+
+    c.rx[i - 3] = '\0';   // Kopf ohne Leerzeile, als Text
+    handleRequest(c, (const char*)c.rx);
+
+    // Was danach kam, gehoert schon zum WebSocket
+    const uint16_t used = i + 1;
+    c.rxLen -= used;
+    memmove(c.rx, c.rx + used, c.rxLen);
+    if (c.state == WEB_WS) handleFrames(c);
+    return;
+  }
+
+  if (c.rxLen >= sizeof(c.rx) - 1) respondError(c, "431 Request Header Fields Too Large");
+}
+
+/**
+ * @brief NetMux: Verbindung eines Browsers ist bereit.
+ */
+static void onClient(uint8_t ready, void* arg) {
+  WebClient &c = *(WebClient*)arg;
+
+  if (ready & (NET_MUX_READ | NET_MUX_ERROR)) {
+    // Nach Antwort/Close-Rahmen nichts mehr auswerten, nur noch senden
+    uint8_t discard[64];
+    uint8_t* dst = c.closeAfterTx ? discard : c.rx + c.rxLen;
+    const size_t space = c.closeAfterTx ? sizeof(discard) : sizeof(c.rx) - 1 - c.rxLen;
+
+    const int n = radioSockRecv(c.sock, dst, space);
+    if (n < 0) {
+      dropClient(c);
+      return;
+    }
+    if (!c.closeAfterTx) {
+      c.rxLen += (uint16_t)n;
+      if (c.state == WEB_HTTP) handleHttp(c);
+      else if (c.state == WEB_WS) handleFrames(c);
+      if (c.closeAfterTx) c.txMs = millis();   // Sende-Zeitueberschreitung ab jetzt
+    }
+  }
+  if (c.state != WEB_FREE) flush(c);
+}
+
+/**
+ * @brief NetMux: wartende Verbindungen annehmen.
+ */
+static void onListen(uint8_t, void*) {
+  for (;;) {
+    const int fd = radioSockAccept(listenSock);
+    if (fd < 0) return;
+
+    WebClient* c = nullptr;
+    for (WebClient &x : clients) {
+      if (x.state == WEB_FREE) {
+        c = &x;
+        break;
+      }
+    }
+    const int8_t slot = c ? netMuxAdd(fd, NET_MUX_READ, onClient, c) : -1;
+    if (slot < 0) {
+      radioSockClose(fd);   // alle Plaetze belegt
+      stats.rejected++;
+      continue;
+    }
+
+    c->state = WEB_HTTP;
+    c->sock = fd;
+    c->muxSlot = slot;
+    c->openedMs = millis();
+    c->txMs = c->openedMs;
+    c->closeAfterTx = false;
+    c->rxLen = 0;
+    c->txLen = 0;
+    c->body = nullptr;
+    c->bodyLeft = 0;
+    c->synced = false;
+    stats.accepts++;
+  }
+}
+
+// --------------------
+// Public API
+// --------------------
+
+bool webInit(uint16_t port) {
+  webStop();
+
+  listenSock = radioSockListen(port, WEB_CLIENTS_MAX, boundPort);
+  if (listenSock < 0) return false;
+  listenSlot = netMuxAdd(listenSock, NET_MUX_READ, onListen, nullptr);
+  if (listenSlot < 0) {
+    radioSockClose(listenSock);   // NET_MUX_SLOTS zu klein
+    listenSock = -1;
+    return false;
+  }
+
+  for (WebClient &c : clients) {
+    c.state = WEB_FREE;
+    c.sock = -1;
+    c.muxSlot = -1;
+  }
+  stats = WebStats{};
+  lastVersion = guiStateVersion();
+  behind = false;
+  eventLoopInhibitSleep(true);
+  return true;
+}
+
+void webStop() {
+  if (listenSock < 0) return;
+
+  for (WebClient &c : clients) {
+    if (c.state != WEB_FREE) dropClient(c);
+  }
+  netMuxRemove(listenSlot);
+  radioSockClose(listenSock);
+  listenSlot = -1;
+  listenSock = -1;
+  boundPort = 0;
+  eventLoopInhibitSleep(false);
+}
+
+uint16_t webPort() {
+  return boundPort;
+}
+
+void webPoll() {
+  if (listenSock < 0) return;
+
+  // Unvollstaendige Anfragen und Browser, die beim Schliessen nicht mehr lesen,
+  // nicht ewig einen Platz belegen lassen
+  const uint32_t now = millis();
+  for (WebClient &c : clients) {
+    if (c.state == WEB_FREE) continue;
+    if (c.closeAfterTx) {
+      if (now - c.txMs > WEB_CONFIG.send_timeout_ms) {
+        stats.stalled++;
+        dropClient(c);
+      }
+    } else if (c.state == WEB_HTTP && now - c.openedMs > WEB_CONFIG.request_timeout_ms) {
+      stats.badRequests++;
+      dropClient(c);
+    }
+  }
+
+  // Ohne neue Veroeffentlichung und ohne wartende Browser: nur ein Vergleich
+  if (guiStateVersion() == lastVersion && !behind) return;
+
+  GuiState st;
+  const uint32_t version = guiReadState(st);
+  lastVersion = version;
+  behind = false;
+  for (WebClient &c : clients) {
+    if (c.state != WEB_WS || c.closeAfterTx || c.sentVersion == version) continue;
+    if (queueDelta(c, st)) c.sentVersion = version;
+    else behind = true;
+    flush(c);
+  }
+}
+
+uint32_t webIdleUs() {
+  return (listenSock < 0) ? EVENT_NO_DEADLINE : WEB_CONFIG.poll_ms * 1000;
+}
+
+WebStats webStats() {
+  return stats;
+}
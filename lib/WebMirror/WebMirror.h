@@ -0,0 +1,63 @@
+// lib/WebMirror/WebMirror.h
+//
+// Web-Spiegel des Panels: kleiner HTTP- + WebSocket-Server (Protokoll siehe
+// include/web_config.h).
+//
+// Idee:
+// - Browser laedt die statische Seite ("GET /", liegt im Flash) und oeffnet
+//   einen WebSocket ("GET /ws").
+// - Der Server liest den veroeffentlichten Bedienstand (guiReadState(), Snapshot)
+//   und schickt jedem Browser nur die Felder, die sich seit seinem letzten
+//   Stand geaendert haben. Kommt ein Browser nicht hinterher (Sendepuffer voll),
+//   wartet er; das naechste Delta fasst alles Verpasste zusammen.
+// - Aktionen des Browsers ("rot 3", "press", ...) landen als normale Ereignisse
+//   in der Input-Queue (InputEvents.h): die GUI behandelt sie wie Encoder und
+//   Taster, inkl. Radio-Client und Rueckmeldung ans Panel.
+// - Alle Sockets (Listener + Verbindungen) haengen in lib/NetMux, es gibt
+//   keinen eigenen poll() und keinen Thread. guiUpdate() ruft nichts von hier
+//   auf: der lokale Pfad Eingabe -> Anzeige bleibt unberuehrt.
+// - Feste Tabelle (WEB_CLIENTS_MAX) mit festen Puffern, keine Allokation.
+//
+// Nicht thread-sicher: alle Aufrufe aus dem Kontext von netMuxPoll()
+// (loop() bzw. mit GUI_TASKS der Netz-Task).
+
+#pragma once
+#include <stdint.h>
+
+#include <web_config.h>
+
+struct WebStats {
+  uint32_t accepts;        // angenommene Verbindungen
+  uint32_t rejected;       // abgewiesen (alle WEB_CLIENTS_MAX belegt)
+  uint32_t pages;          // ausgelieferte Seiten
+  uint32_t upgrades;       // WebSocket-Handshakes
+  uint32_t badRequests;    // 4xx-Antworten, Zeitueberschreitung, Protokollfehler
+  uint32_t stalled;        // beim Schliessen verworfen (Browser liest nicht)
+  uint32_t actions;        // ausgefuehrte Aktionen (Nachrichten)
+  uint32_t events;         // daraus erzeugte Eingabe-Ereignisse
+  uint32_t dropped;        // davon verworfen (Input-Queue voll)
+  uint32_t deltas;         // gesendete Deltas (alle Browser)
+  uint32_t deltaBytes;     // deren Nutzlast
+  uint32_t deferred;       // Delta verschoben (Sendepuffer voll)
+  uint8_t sockets;         // offene WebSockets
+};
+
+/**
+ * @brief Server starten (lauscht auf allen Interfaces, meldet sich bei lib/NetMux an).
+ * @param port  0 = frei waehlen (Host-Tests, webPort())
+ * @return false, wenn der Port nicht geoeffnet werden konnte
+ */
+bool webInit(uint16_t port);
+
+// Alle Verbindungen schliessen, nicht mehr lauschen
+void webStop();
+
+uint16_t webPort();
+
+// Zyklisch nach guiUpdate() bzw. guiPollInput(): geaenderten Bedienstand an die Browser
+void webPoll();
+
+// Zeit in us bis zur naechsten noetigen Socket-Abfrage (EVENT_NO_DEADLINE = aus)
+uint32_t webIdleUs();
+
+WebStats webStats();
@@ -0,0 +1,49 @@
+// lib/WebMirror/WebPage.h
+//
+// Statische Seite des Web-Spiegels (liegt als Konstante im Flash, wird ohne
+// Kopie direkt aus dem Flash gesendet). Nur von WebMirror.cpp eingebunden.
+//
+// Zeigt Screen, Frequenz (mit Cursor im Edit), MOD/PWR/Radio und Verbindung;
+// Tasten und Mausrad senden dieselben Aktionen wie Encoder und Taster.
+
+#pragma once
+
+static const char WEB_PAGE[] = R"HTML(<!DOCTYPE html>
+<html><head><meta charset="utf-8"><meta name="viewport" content="width=device-width">
+<title>M3TR</title>
+<style>
+body{background:#000;color:#fff;font-family:monospace;max-width:26em;margin:1em auto}
+#t{color:#0ff;font-size:1.6em}#f{font-size:3em;margin:.3em 0}.u{color:#888;font-size:.4em}
+.k{color:#0ff;text-decoration:underline}td{padding:.1em .8em .1em 0}.a{color:#0ff}
+#tabs span{margin-right:1em;color:#888}#l.on{color:#0f0}
+button{font:inherit;font-size:1.2em;min-width:3em;margin:.4em .2em 0 0;background:#222;color:#fff;border:1px solid #555}
+</style></head><body>
+<div id="t">-</div><div id="f">-</div>
+<table><tr><td>MOD</td><td id="m">-</td></tr><tr><td>PWR</td><td id="p">-</td></tr>
+<tr><td>Radio</td><td id="r">-</td></tr><tr><td>Link</td><td id="l">-</td></tr></table>
+<div id="tabs"></div>
+<div><button data-a="left">&#9664;</button><button data-a="rot -1">-</button><button data-a="press">OK</button>
+<button data-a="long">Save</button><button data-a="rot 1">+</button><button data-a="right">&#9654;</button></div>
+<script>
+const T=['FRQ','MOD','PWR','RAD'],N=['Frequenz','Modulation','Power','Radio'],L=['OFF','...','ON'];
+let s={},ls={mod:[],pwr:[],rad:[]},ws;const $=i=>document.getElementById(i);
+function send(a){if(ws&&ws.readyState==1)ws.send(a)}
+function draw(){
+ $('t').textContent=N[s.s]||'-';
+ let f=((s.f||0)/1e6).toFixed(3).padStart(7,' '),h='';
+ for(let i=0;i<7;i++){const d=i<3?i:i-1,c=s.e&&s.s==0&&i!=3&&d==s.c;h+=c?'<span class="k">'+f[i]+'</span>':f[i]}
+ $('f').innerHTML=h+' <span class="u">MHz</span>';
+ $('m').textContent=ls.mod[s.m]||s.m;$('p').textContent=ls.pwr[s.p]||s.p;$('r').textContent=ls.rad[s.r]||s.r;
+ $('l').textContent=L[s.l]||'-';$('l').className=s.l==2?'on':'';
+ $('tabs').innerHTML=T.map((t,i)=>'<span'+(i==s.s?' class="a"':'')+'>'+(i==3?(ls.rad[s.r]||t):t)+'</span>').join('');
+}
+function connect(){
+ ws=new WebSocket('ws://'+location.host+'/ws');
+ ws.onmessage=e=>{const d=JSON.parse(e.data);if(d.mod)ls=d;else Object.assign(s,d);draw()};
+ ws.onclose=()=>{s.l=0;draw();setTimeout(connect,1000)};
+}
+document.querySelectorAll('button').forEach(b=>b.onclick=()=>send(b.dataset.a));
+$('f').onwheel=e=>{e.preventDefault();send('rot '+(e.deltaY<0?1:-1))};
+connect();
+</script></body></html>
+)HTML";
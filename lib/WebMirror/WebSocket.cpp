@@ -0,0 +1,158 @@
+// lib/WebMirror/WebSocket.cpp
+//
+// WebSocket-Bausteine (siehe WebSocket.h).
+
+#include "WebSocket.h"
+
+#include <string.h>
+
+static const char* const WS_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+static uint32_t rol(uint32_t x, uint8_t n) {
+  return (x << n) | (x >> (32 - n));
+}
+
+/**
+ * @brief Einen 64-Byte-Block in den Zustand h einrechnen.
+ */
+static void sha1Block(uint32_t h[5], const uint8_t* block) {
+  uint32_t w[80];
+  for (uint8_t i = 0; i < 16; i++) {
+    w[i] = (uint32_t)block[i * 4] << 24 | (uint32_t)block[i * 4 + 1] << 16 |
+           (uint32_t)block[i * 4 + 2] << 8 | (uint32_t)block[i * 4 + 3];
+  }
+  for (uint8_t i = 16; i < 80; i++) w[i] = rol(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+  uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+  for (uint8_t i = 0; i < 80; i++) {
+    uint32_t f, k;
+    if (i < 20) {
+      f = (b & c) | (~b & d);
+      k = 0x5A827999;
+    } else if (i < 40) {
+      f = b ^ c ^ d;
+      k = 0x6ED9EBA1;
+    } else if (i < 60) {
+      f = (b & c) | (b & d) | (c & d);
+      k = 0x8F1BBCDC;
+    } else {
+      f = b ^ c ^ d;
+      k = 0xCA62C1D6;
+    }
+    const uint32_t t = rol(a, 5) + f + e + k + w[i];
+    e = d;
+    d = c;
+    c = rol(b, 30);
+    b = a;
+    a = t;
+  }
+  h[0] += a;
+  h[1] += b;
+  h[2] += c;
+  h[3] += d;
+  h[4] += e;
+}
+
+void wsSha1(const uint8_t* data, size_t len, uint8_t out[20]) {
+  uint32_t h[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+
+  size_t pos = 0;
+  for (; pos + 64 <= len; pos += 64) sha1Block(h, data + pos);
+
+  // Rest + 0x80 + Laenge in Bit (64 Bit, big endian), ein oder zwei Bloecke
+  uint8_t tail[128] = {};
+  const size_t rest = len - pos;
+  memcpy(tail, data + pos, rest);
+  tail[rest] = 0x80;
+  const size_t tailLen = (rest < 56) ? 64 : 128;
+  const uint64_t bits = (uint64_t)len * 8;
+  for (uint8_t i = 0; i < 8; i++) tail[tailLen - 1 - i] = (uint8_t)(bits >> (i * 8));
+
+  sha1Block(h, tail);
+  if (tailLen == 128) sha1Block(h, tail + 64);
+
+  for (uint8_t i = 0; i < 5; i++) {
+    out[i * 4] = (uint8_t)(h[i] >> 24);
+    out[i * 4 + 1] = (uint8_t)(h[i] >> 16);
+    out[i * 4 + 2] = (uint8_t)(h[i] >> 8);
+    out[i * 4 + 3] = (uint8_t)h[i];
+  }
+}
+
+size_t wsBase64(const uint8_t* in, size_t len, char* out) {
+  static const char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+  size_t n = 0;
+  for (size_t i = 0; i < len; i += 3) {
+    const uint32_t b0 = in[i];
+    const uint32_t b1 = (i + 1 < len) ? in[i + 1] : 0;
+    const uint32_t b2 = (i + 2 < len) ? in[i + 2] : 0;
+    const uint32_t v = b0 << 16 | b1 << 8 | b2;
+
+    out[n++] = ALPHABET[(v >> 18) & 63];
+    out[n++] = ALPHABET[(v >> 12) & 63];
+    out[n++] = (i + 1 < len) ? ALPHABET[(v >> 6) & 63] : '=';
+    out[n++] = (i + 2 < len) ? ALPHABET[v & 63] : '=';
+  }
+  out[n] = '\0';
+  return n;
+}
+
+void wsAcceptKey(const char* key, size_t keyLen, char* out) {
+  // Schluessel des Browsers ist 24 Zeichen lang (base64 von 16 Bytes), GUID 36
+  uint8_t buf[64 + 36];
+  if (keyLen > 64) keyLen = 64;
+  memcpy(buf, key, keyLen);
+  memcpy(buf + keyLen, WS_GUID, 36);
+
+  uint8_t digest[20];
+  wsSha1(buf, keyLen + 36, digest);
+  wsBase64(digest, sizeof(digest), out);
+}
+
+WsParseResult wsParseFrame(uint8_t* buf, size_t len, size_t maxPayload, WsFrame &frame) {
+  if (len < 2) return WS_PARSE_MORE;
+
+  const bool fin = (buf[0] & 0x80) != 0;
+  const uint8_t opcode = buf[0] & 0x0F;
+  const bool masked = (buf[1] & 0x80) != 0;
+  uint64_t payload = buf[1] & 0x7F;
+
+  // Browser maskiert immer; ohne Fragmentierung und Erweiterungen (RSV-Bits)
+  if (!masked || !fin || opcode == WS_OP_CONTINUATION || (buf[0] & 0x70)) return WS_PARSE_BAD;
+
+  size_t head = 2;
+  if (payload == 126) {
+    if (len < 4) return WS_PARSE_MORE;
+    payload = (uint64_t)buf[2] << 8 | buf[3];
+    head = 4;
+  } else if (payload == 127) {
+    return WS_PARSE_BAD;   // > 64 KiB, passt in keinen Puffer
+  }
+  if (payload > maxPayload) return WS_PARSE_BAD;
+
+  const size_t size = head + 4 + (size_t)payload;
+  if (len < size) return WS_PARSE_MORE;
+
+  const uint8_t* mask = buf + head;
+  uint8_t* p = buf + head + 4;
+  for (size_t i = 0; i < payload; i++) p[i] ^= mask[i & 3];
+
+  frame.opcode = opcode;
+  frame.payload = p;
+  frame.len = (size_t)payload;
+  frame.size = size;
+  return WS_PARSE_FRAME;
+}
+
+uint8_t wsFrameHeader(uint8_t opcode, size_t len, uint8_t* out) {
+  out[0] = (uint8_t)(0x80 | (opcode & 0x0F));
+  if (len < 126) {
+    out[1] = (uint8_t)len;
+    return 2;
+  }
+  out[1] = 126;
+  out[2] = (uint8_t)(len >> 8);
+  out[3] = (uint8_t)len;
+  return 4;
+}
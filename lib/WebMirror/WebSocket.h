@@ -0,0 +1,66 @@
+// lib/WebMirror/WebSocket.h
+//
+// Bausteine fuer WebSocket (RFC 6455) ohne Heap und ohne externe Bibliothek:
+// - Handshake: Sec-WebSocket-Accept = base64(SHA-1(key + GUID))
+// - Rahmen vom Browser: immer maskiert, werden im Empfangspuffer demaskiert
+// - Rahmen an den Browser: unmaskiert, Nutzlast < 64 KiB (2- bzw. 4-Byte-Kopf)
+//
+// Keine Fragmentierung (Deltas und Aktionen sind kurz). Laeuft unveraendert
+// auf dem Host (src/host/web_loopback.cpp).
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+enum WsOpcode : uint8_t {
+  WS_OP_CONTINUATION = 0x0,
+  WS_OP_TEXT         = 0x1,
+  WS_OP_BINARY       = 0x2,
+  WS_OP_CLOSE        = 0x8,
+  WS_OP_PING         = 0x9,
+  WS_OP_PONG         = 0xA
+};
+
+// Laenge von Sec-WebSocket-Accept (base64 von 20 Bytes)
+static const uint8_t WS_ACCEPT_LEN = 28;
+
+// Groesster Kopf eines Server-Rahmens
+static const uint8_t WS_HEADER_MAX = 4;
+
+// SHA-1 (FIPS 180-1) in einem Stueck, nur fuer den Handshake
+void wsSha1(const uint8_t* data, size_t len, uint8_t out[20]);
+
+/**
+ * @brief Base64 (mit '=' aufgefuellt), out braucht 4 * ((len + 2) / 3) + 1 Bytes.
+ * @return Laenge ohne abschliessende 0
+ */
+size_t wsBase64(const uint8_t* in, size_t len, char* out);
+
+// Sec-WebSocket-Accept zum Sec-WebSocket-Key des Browsers (out: WS_ACCEPT_LEN + 1)
+void wsAcceptKey(const char* key, size_t keyLen, char* out);
+
+enum WsParseResult : uint8_t {
+  WS_PARSE_MORE = 0,       // Rahmen noch unvollstaendig
+  WS_PARSE_FRAME,          // vollstaendiger Rahmen in frame
+  WS_PARSE_BAD             // Protokollfehler (unmaskiert, fragmentiert, zu gross)
+};
+
+struct WsFrame {
+  uint8_t opcode;          // WsOpcode
+  uint8_t* payload;        // zeigt in den Empfangspuffer (demaskiert)
+  size_t len;              // Nutzlast
+  size_t size;             // ganzer Rahmen (Kopf + Nutzlast), so viel verbrauchen
+};
+
+/**
+ * @brief Ersten Rahmen im Puffer erkennen und seine Nutzlast demaskieren.
+ * @param maxPayload  groessere Nutzlast => WS_PARSE_BAD (Puffergroesse des Aufrufers)
+ */
+WsParseResult wsParseFrame(uint8_t* buf, size_t len, size_t maxPayload, WsFrame &frame);
+
+/**
+ * @brief Kopf eines Server-Rahmens (FIN, unmaskiert) schreiben.
+ * @param len  Nutzlast, < 65536
+ * @return Kopflaenge (2 oder 4)
+ */
+uint8_t wsFrameHeader(uint8_t opcode, size_t len, uint8_t* out);
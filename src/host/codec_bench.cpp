@@ -0,0 +1,146 @@
+// src/host/codec_bench.cpp
+//
+// Benchmark des Radio-Codecs auf dem Host (PlatformIO-Env "native_codec").
+// - encode        radioEncodeSet() fuer wechselnde FRQ/MOD/PWR-Werte
+// - encode printf gleiche Zeilen per snprintf (Vergleich, so nicht in der Firmware)
+// - parse         Antwortstrom in einem Stueck (typisch: mehrere Quittungen je Segment)
+// - parse 1 Byte  derselbe Strom byteweise (schlechtester Fall: zerstueckelte Segmente)
+//
+// Aufruf: .pio/build/native_codec/program [millionen]   (Default 5 Mio. je Messung)
+// Ausgabe: Operationen pro Sekunde; Exit-Code 1, wenn Encoder/Parser falsch rechnen
+
+#include <RadioCodec.h>
+
+#include <chrono>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static volatile uint32_t sink = 0;   // verhindert, dass der Compiler die Schleifen streicht
+
+template <typename Fn>
+static void measure(const char* label, uint32_t ops, Fn fn) {
+  const auto start = std::chrono::steady_clock::now();
+  fn(ops);
+  const double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  printf("  %-14s %10.2f Mio. ops/s  (%6.1f ns/op)\n", label, ops / s / 1e6, s * 1e9 / ops);
+}
+
+static void benchEncode(uint32_t ops) {
+  uint8_t buf[RADIO_CMD_MAX];
+  uint32_t acc = 0;
+  for (uint32_t i = 0; i < ops; i++) {
+    const RadioParam p = (RadioParam)(i % RADIO_PARAM_COUNT);
+    const int32_t v = (p == RADIO_FRQ) ? (int32_t)(100000000 + i * 1000) : (int32_t)(i & 7);
+    acc += radioEncodeSet(buf, sizeof(buf), (uint16_t)i, p, v);
+    acc += buf[0];
+  }
+  sink = acc;
+}
+
+static void benchEncodePrintf(uint32_t ops) {
+  static const char* const NAME[RADIO_PARAM_COUNT] = { "FRQ", "MOD", "PWR" };
+  char buf[RADIO_CMD_MAX + 1];
+  uint32_t acc = 0;
+  for (uint32_t i = 0; i < ops; i++) {
+    const uint8_t p = (uint8_t)(i % RADIO_PARAM_COUNT);
+    const int32_t v = (p == RADIO_FRQ) ? (int32_t)(100000000 + i * 1000) : (int32_t)(i & 7);
+    acc += (uint32_t)snprintf(buf, sizeof(buf), "%u SET %s %ld\n", (unsigned)(uint16_t)i, NAME[p], (long)v);
+    acc += (uint8_t)buf[0];
+  }
+  sink = acc;
+}
+
+// Antwortstrom: drei OK, ein ERR usw., Sequenznummern fortlaufend
+static uint8_t replyStream[64 * 1024];
+static size_t replyLen = 0;
+static uint32_t replyCount = 0;
+
+static void buildReplies() {
+  uint16_t seq = 1;
+  while (replyLen + 32 < sizeof(replyStream)) {
+    const int n = snprintf((char*)replyStream + replyLen, 32, (seq % 4) ? "%u OK\n" : "%u ERR range\n", seq);
+    replyLen += (size_t)n;
+    replyCount++;
+    seq++;
+  }
+}
+
+/**
+ * @brief Strom in Stuecken von chunk Bytes parsen. @return Anzahl Antworten (Fehler: 0)
+ */
+static uint32_t parseStream(size_t chunk) {
+  RadioParser p;
+  radioParserReset(p);
+  uint32_t replies = 0;
+  uint16_t expect = 1;
+
+  for (size_t off = 0; off < replyLen; off += chunk) {
+    const size_t n = (replyLen - off < chunk) ? replyLen - off : chunk;
+    size_t pos = 0;
+    while (pos < n) {
+      RadioReply r;
+      size_t used = 0;
+      const RadioParseResult res = radioParse(p, replyStream + off + pos, n - pos, used, r);
+      pos += used;
+      if (res == RADIO_PARSE_MORE) continue;
+      if (res == RADIO_PARSE_ERROR || r.seq != expect || r.ok != ((expect % 4) != 0)) return 0;
+      expect++;
+      replies++;
+    }
+  }
+  return replies;
+}
+
+/**
+ * @brief Stichprobe: Encoder liefert dieselben Zeilen wie snprintf, Parser alle Antworten.
+ */
+static bool selfCheck() {
+  static const char* const NAME[RADIO_PARAM_COUNT] = { "FRQ", "MOD", "PWR" };
+  static const int32_t VALUES[] = { 0, 7, -1, 2147483647, -2147483647 - 1, 145500000 };
+  static const uint16_t SEQS[] = { 0, 9, 65535 };
+
+  for (int32_t v : VALUES) {
+    for (uint8_t p = 0; p < RADIO_PARAM_COUNT; p++) {
+      for (uint16_t seq : SEQS) {
+        char ref[40];
+        const int refLen = snprintf(ref, sizeof(ref), "%u SET %s %ld\n", (unsigned)seq, NAME[p], (long)v);
+        uint8_t buf[RADIO_CMD_MAX];
+        const uint8_t len = radioEncodeSet(buf, sizeof(buf), seq, (RadioParam)p, v);
+        if (len != refLen || memcmp(buf, ref, len) != 0) return false;
+        if (radioEncodeSet(buf, (size_t)len - 1, seq, (RadioParam)p, v) != 0) return false;
+      }
+    }
+  }
+  return parseStream(replyLen) == replyCount && parseStream(1) == replyCount &&
+         parseStream(7) == replyCount;
+}
+
+int main(int argc, char** argv) {
+  const uint32_t ops = (argc > 1) ? (uint32_t)(atof(argv[1]) * 1e6) : 5000000u;
+
+  buildReplies();
+  if (!selfCheck()) {
+    printf("FEHLER: Encoder/Parser liefern falsche Ergebnisse\n");
+    return 1;
+  }
+
+  printf("RadioCodec, %u Operationen je Messung\n", (unsigned)ops);
+  measure("encode", ops, benchEncode);
+  measure("encode printf", ops, benchEncodePrintf);
+
+  // Parser: ganze Stroeme, bis ops Antworten gelesen sind
+  const uint32_t rounds = (ops + replyCount - 1) / replyCount;
+  measure("parse", rounds * replyCount, [rounds](uint32_t) {
+    uint32_t acc = 0;
+    for (uint32_t r = 0; r < rounds; r++) acc += parseStream(replyLen);
+    sink = acc;
+  });
+  measure("parse 1 Byte", rounds * replyCount, [rounds](uint32_t) {
+    uint32_t acc = 0;
+    for (uint32_t r = 0; r < rounds; r++) acc += parseStream(1);
+    sink = acc;
+  });
+  return 0;
+}
@@ -0,0 +1,249 @@
+// src/host/codec_fuzz.cpp
+//
+// Fuzzer fuer den Antwort-Parser des Radio-Codecs (PlatformIO-Env "native_codec_fuzz",
+// gebaut mit AddressSanitizer/UBSan).
+//
+// Je Eingabe wird geprueft:
+//   - Referenz: Zeilen einzeln mit einer einfachen (langsamen) Auswertung
+//     bewerten; radioParse() muss dieselbe Folge aus Antworten/Fehlern liefern
+//   - Segmente: dieselbe Eingabe in zufaellig grossen Stuecken => gleiche Folge
+//   - radioParse() verbraucht mindestens 1 Byte und nie mehr als uebergeben
+//   - Encoder: zufaellige SET/GET-Kommandos passen in RADIO_CMD_MAX und lassen
+//     sich zurueck in seq/Parameter/Wert zerlegen
+//
+// Eingaben: Zufallsbytes, Mutationen gueltiger Antworten, Zeichen aus dem
+// Protokoll-Alphabet (Ziffern, '-', "OK", "ERR", ' ', '\r', '\n').
+//
+// Aufruf: .pio/build/native_codec_fuzz/program [runden] [seed]   (Default 200000, 1)
+// Exit-Code 0 = keine Abweichung
+//
+// Mit -DCODEC_LIBFUZZER -fsanitize=fuzzer entfaellt main(), libFuzzer ruft dann
+// LLVMFuzzerTestOneInput() direkt auf.
+
+#include <RadioCodec.h>
+
+#include <random>
+#include <string>
+#include <limits.h>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+// Ergebnis je Zeile als Text: "E" (Fehler), "<seq> OK", "<seq> OK <wert>", "<seq> ERR"
+typedef std::vector<std::string> Outcome;
+
+static const std::string LINE_ERROR = "E";
+
+static std::mt19937 rng;
+
+[[noreturn]] static void fail(const char* what, const uint8_t* data, size_t len) {
+  fprintf(stderr, "FEHLER: %s, Eingabe (%u Bytes):\n  ", what, (unsigned)len);
+  for (size_t i = 0; i < len; i++) fprintf(stderr, "%02x", data[i]);
+  fprintf(stderr, "\n");
+  abort();
+}
+
+/**
+ * @brief Referenz-Auswertung einer Zeile (ohne '\n'), absichtlich einfach gehalten.
+ */
+static std::string referenceLine(const std::string &raw) {
+  std::string line;
+  for (char c : raw) {
+    if (c != '\r') line += c;
+  }
+  if (line.size() > RADIO_REPLY_MAX) return LINE_ERROR;
+
+  size_t i = 0;
+  while (i < line.size() && line[i] >= '0' && line[i] <= '9') i++;
+  if (i == 0 || i == line.size() || line[i] != ' ') return LINE_ERROR;
+
+  const unsigned long seq = strtoul(line.substr(0, i).c_str(), nullptr, 10);
+  if (seq > 0xFFFF) return LINE_ERROR;
+  const std::string head = std::to_string(seq);
+
+  const std::string status = line.substr(i + 1);
+  if (status == "OK") return head + " OK";
+  if (status == "ERR" || status.compare(0, 4, "ERR ") == 0) return head + " ERR";
+  if (status.compare(0, 3, "OK ") != 0) return LINE_ERROR;
+
+  // "OK <wert>": optionales '-', dann nur Ziffern, Bereich int32
+  const std::string num = status.substr(3);
+  size_t k = (!num.empty() && num[0] == '-') ? 1 : 0;
+  if (k == num.size()) return LINE_ERROR;
+  for (size_t j = k; j < num.size(); j++) {
+    if (num[j] < '0' || num[j] > '9') return LINE_ERROR;
+  }
+  errno = 0;
+  const long long v = strtoll(num.c_str(), nullptr, 10);
+  if (errno == ERANGE || v < INT32_MIN || v > INT32_MAX) return LINE_ERROR;
+  return head + " OK " + std::to_string(v);
+}
+
+static Outcome reference(const uint8_t* data, size_t len) {
+  Outcome out;
+  std::string line;
+  for (size_t i = 0; i < len; i++) {
+    if (data[i] == '\n') {
+      out.push_back(referenceLine(line));
+      line.clear();
+    } else {
+      line += (char)data[i];
+    }
+  }
+  return out;   // angefangene letzte Zeile ergibt noch nichts
+}
+
+/**
+ * @brief Eingabe in Stuecken parsen; chunk 0 = zufaellige Stueckgroessen.
+ */
+static Outcome parse(const uint8_t* data, size_t len, size_t chunk) {
+  Outcome out;
+  RadioParser p;
+  radioParserReset(p);
+
+  size_t off = 0;
+  while (off < len) {
+    size_t n = chunk ? chunk : 1 + rng() % 16;
+    if (n > len - off) n = len - off;
+
+    // Segment in eigenen Heap-Puffer kopieren, damit ASan Lesen ueber das Ende meldet
+    std::vector<uint8_t> seg(data + off, data + off + n);
+    size_t pos = 0;
+    while (pos < n) {
+      RadioReply r;
+      size_t used = 0;
+      const RadioParseResult res = radioParse(p, seg.data() + pos, n - pos, used, r);
+      if (used == 0 || used > n - pos) fail("used ausserhalb des Segments", data, len);
+      pos += used;
+      if (res == RADIO_PARSE_REPLY) {
+        std::string o = std::to_string(r.seq) + (r.ok ? " OK" : " ERR");
+        if (r.hasValue) o += " " + std::to_string(r.value);
+        out.push_back(o);
+      } else if (res == RADIO_PARSE_ERROR) {
+        out.push_back(LINE_ERROR);
+      }
+      else if (pos != n) fail("MORE ohne alles zu verbrauchen", data, len);
+    }
+    off += n;
+  }
+  return out;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t len) {
+  const Outcome ref = reference(data, len);
+  if (parse(data, len, len ? len : 1) != ref) fail("Abweichung von der Referenz", data, len);
+  if (parse(data, len, 1) != ref) fail("Abweichung bei 1-Byte-Segmenten", data, len);
+  if (parse(data, len, 0) != ref) fail("Abweichung bei zufaelligen Segmenten", data, len);
+  return 0;
+}
+
+#ifndef CODEC_LIBFUZZER
+
+// --------------------
+// Eingaben erzeugen
+// --------------------
+
+static void appendValidReply(std::vector<uint8_t> &buf) {
+  char line[48];
+  const unsigned seq = rng() % 70000;   // auch knapp ueber 0xFFFF
+  int n;
+  switch (rng() % 6) {
+    case 0: n = snprintf(line, sizeof(line), "%u OK\n", seq); break;
+    case 1: n = snprintf(line, sizeof(line), "%u ERR\n", seq); break;
+    case 2: n = snprintf(line, sizeof(line), "%u ERR value out of range\n", seq); break;
+    case 3: n = snprintf(line, sizeof(line), "%u OK %ld\n", seq, (long)(int32_t)rng()); break;
+    case 4: n = snprintf(line, sizeof(line), "%u OK %lld\n", seq, (long long)(int32_t)rng() * 3); break;
+    default: n = snprintf(line, sizeof(line), "%u OK\r\n", seq); break;
+  }
+  buf.insert(buf.end(), line, line + n);
+}
+
+static std::vector<uint8_t> makeInput() {
+  static const char ALPHABET[] = "0123456789- OKER\r\n";
+  std::vector<uint8_t> buf;
+
+  switch (rng() % 3) {
+    case 0: {   // reine Zufallsbytes
+      const size_t n = rng() % 96;
+      for (size_t i = 0; i < n; i++) buf.push_back((uint8_t)rng());
+      break;
+    }
+    case 1: {   // Protokoll-Alphabet
+      const size_t n = rng() % 128;
+      for (size_t i = 0; i < n; i++) buf.push_back((uint8_t)ALPHABET[rng() % (sizeof(ALPHABET) - 1)]);
+      break;
+    }
+    default: {  // gueltige Antworten, danach einige Mutationen
+      const unsigned lines = 1 + rng() % 6;
+      for (unsigned i = 0; i < lines; i++) appendValidReply(buf);
+      const unsigned mutations = rng() % 4;
+      for (unsigned m = 0; m < mutations && !buf.empty(); m++) {
+        const size_t at = rng() % buf.size();
+        switch (rng() % 3) {
+          case 0: buf[at] = (uint8_t)ALPHABET[rng() % (sizeof(ALPHABET) - 1)]; break;
+          case 1: buf.erase(buf.begin() + (long)at); break;
+          default: buf.insert(buf.begin() + (long)at, (size_t)(rng() % 48), (uint8_t)'9'); break;
+        }
+      }
+      break;
+    }
+  }
+  return buf;
+}
+
+/**
+ * @brief Encoder: Zeile passt, endet auf '\n' und ergibt wieder seq/Parameter/Wert.
+ */
+static void checkEncode() {
+  static const char* const NAME[RADIO_PARAM_COUNT] = { "FRQ", "MOD", "PWR" };
+  const uint16_t seq = (uint16_t)rng();
+  const uint8_t param = (uint8_t)(rng() % RADIO_PARAM_COUNT);
+  const int32_t value = (int32_t)rng();
+
+  uint8_t buf[RADIO_CMD_MAX + 1];
+  const uint8_t len = radioEncodeSet(buf, RADIO_CMD_MAX, seq, (RadioParam)param, value);
+  if (len == 0 || len > RADIO_CMD_MAX || buf[len - 1] != '\n') fail("Encoder-Zeile", buf, len);
+  buf[len] = 0;
+
+  unsigned s = 0;
+  char name[4] = {0};
+  long v = 0;
+  if (sscanf((const char*)buf, "%u SET %3s %ld", &s, name, &v) != 3 || s != seq ||
+      strcmp(name, NAME[param]) != 0 || v != value) {
+    fail("Encoder-Rueckweg", buf, len);
+  }
+  if (radioEncodeSet(buf, (size_t)(rng() % len), seq, (RadioParam)param, value) != 0) {
+    fail("Encoder schreibt in zu kleinen Puffer", buf, len);
+  }
+
+  const uint8_t getLen = radioEncodeGet(buf, RADIO_CMD_MAX, seq, (RadioParam)param);
+  if (getLen == 0 || buf[getLen - 1] != '\n') fail("GET-Zeile", buf, getLen);
+  buf[getLen] = 0;
+  char expect[24];
+  snprintf(expect, sizeof(expect), "%u GET %s\n", (unsigned)seq, NAME[param]);
+  if (strcmp((const char*)buf, expect) != 0) fail("GET-Rueckweg", buf, getLen);
+  if (radioEncodeGet(buf, getLen - 1u, seq, (RadioParam)param) != 0) {
+    fail("GET schreibt in zu kleinen Puffer", buf, getLen);
+  }
+}
+
+int main(int argc, char** argv) {
+  const unsigned long rounds = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 200000ul;
+  rng.seed((argc > 2) ? (unsigned)strtoul(argv[2], nullptr, 10) : 1u);
+
+  unsigned long replies = 0, errors = 0;
+  for (unsigned long i = 0; i < rounds; i++) {
+    const std::vector<uint8_t> in = makeInput();
+    LLVMFuzzerTestOneInput(in.data(), in.size());
+    for (const std::string &o : reference(in.data(), in.size())) (o == LINE_ERROR ? errors : replies)++;
+    checkEncode();
+  }
+
+  printf("%lu Eingaben ohne Abweichung (%lu Antworten, %lu Fehlerzeilen)\n", rounds, replies, errors);
+  return 0;
+}
+
+#endif
@@ -0,0 +1,198 @@
+// src/host/gui_sim.cpp
+//
+// Host-Simulation der GUI (PlatformIO-Env "native_sim").
+// - Gleicher Ablauf wie main.cpp (initDisplay, Input-Module, guiInit, guiUpdate)
+// - Display = Software-Backend (TFTDisplayHost), Zeit/GPIO = lib/HostSim
+// - Eingaben kommen als Skript ueber stdin, pro Kommando werden die
+//   SPI-Kosten ausgegeben (Address-Windows, Kommandos, Pixel, Bytes)
+//   sowie die Zahl der Loop-Durchlaeufe (EventLoop, "passes")
+// - Drei Radios (R1..R3) nur als Spiegel (Port 0, keine Verbindung), damit
+//   der RAD-Screen etwas zum Umschalten hat
+//
+// Skript (eine Anweisung pro Zeile, '#' = Kommentar):
+//   wait <ms>        Zeit laufen lassen (Loop wie main.cpp: ruht bis zur Deadline)
+//   rot <n> [ms]     n Encoder-Schritte (negativ = gegen Uhrzeigersinn),
+//                    ms pro Schritt (Default 40 ms = 25 Schritte/s)
+//   press            Encoder-Taster kurz druecken
+//   long             Encoder-Taster lang druecken
+//   left | right     Nav-Taster kurz druecken
+//   tlm <s> <swr> <fwd>  Telemetrie (dBm, SWR x100, 0.1 W) des aktiven Radios
+//                    veroeffentlichen, danach 50 ms laufen lassen (Meter-Balken)
+//   snap <datei>     Panel als PPM speichern
+//   stats            Gesamtkosten seit Start ausgeben
+//   latency          Latenz-Histogramme (Flanke -> Flush fertig) ausgeben
+//
+// Beispiel:
+//   echo -e "wait 100\nrot 5\nright\nsnap mod.ppm" | .pio/build/native_sim/program
+
+#include <Arduino.h>
+#include <HostSim.h>
+
+#include <TFTDisplay.h>
+#include <TFTDisplayHost.h>
+#include <InputEvents.h>
+#include <RotaryEncoder.h>
+#include <NavButtons.h>
+#include <GUI.h>
+#include <LatencyTrace.h>
+#include <EventLoop.h>
+#include <TimerWheel.h>
+#include <RadioTCP.h>
+#include <RadioTelemetry.h>
+
+#include <config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Default-Zeit pro Encoder-Schritt (zwei Flanken)
+static const uint32_t SIM_STEP_MS  = 40;
+static const uint32_t SIM_PRESS_MS = 80;
+static const uint32_t SIM_LONG_MS  = 900;
+
+// Rechenzeit eines Durchlaufs, der nicht ruht (Fake-Clock muss trotzdem laufen)
+static const uint32_t SIM_PASS_US  = 100;
+
+// Radios ohne Verbindung (nur Spiegel)
+static const RadioEndpoint SIM_RADIOS[] = {
+  { "R1", "127.0.0.1", 0, 0 },
+  { "R2", "127.0.0.1", 0, 0 },
+  { "R3", "127.0.0.1", 0, 0 },
+};
+
+static TftSpiStats lastStats = {};
+static uint32_t lastPasses = 0;
+
+/**
+ * @brief Laesst die Fake-Zeit laufen, Ablauf wie loop() in main.cpp:
+ *        Arbeit, dann Ruhen bis zur naechsten Deadline (hoechstens bis Ende).
+ */
+static void runMs(uint32_t ms) {
+  const uint64_t end = hostNowUs() + (uint64_t)ms * 1000;
+  while (hostNowUs() < end) {
+    timerRun(millis());
+    guiUpdate();
+
+    const uint32_t left = (uint32_t)(end - hostNowUs());
+    const uint32_t timers = timerIdleUs(millis(), micros());
+    const uint32_t timeout = eventDeadlineMin(eventDeadlineMin(guiIdleUs(), timers), left);
+    if (eventLoopIdle(timeout) == EVENT_IDLE_NONE) {
+      hostAdvanceUs(eventDeadlineMin(SIM_PASS_US, left));
+    }
+  }
+}
+
+/**
+ * @brief Ein Encoder-Schritt = zwei Quadratur-Flanken.
+ *        Uhrzeigersinn: erst CLK, dann DT (Gray-Code 11 -> 01 -> 00 -> 10).
+ */
+static void rotateStep(bool cw, uint32_t stepMs) {
+  const uint8_t first  = cw ? ENC_CLK : ENC_DT;
+  const uint8_t second = cw ? ENC_DT  : ENC_CLK;
+  const uint32_t edgeMs = (stepMs < 2) ? 1 : stepMs / 2;
+
+  hostSetPin(first, !hostGetPin(first));
+  runMs(edgeMs);
+  hostSetPin(second, !hostGetPin(second));
+  runMs(edgeMs);
+}
+
+static void pressPin(uint8_t pin, uint32_t holdMs) {
+  hostSetPin(pin, LOW);
+  runMs(holdMs);
+  hostSetPin(pin, HIGH);
+  runMs(SIM_PRESS_MS);
+}
+
+static void printStats(const char* label, const TftSpiStats &s, uint32_t passes) {
+  printf("%-24s windows=%-6u cmds=%-6u pixels=%-8u bytes=%-8u passes=%u\n",
+         label, (unsigned)s.windows, (unsigned)s.commands,
+         (unsigned)s.pixels, (unsigned)s.bytes, (unsigned)passes);
+}
+
+/**
+ * @brief Kosten seit dem letzten Kommando ausgeben.
+ */
+static void printDelta(const char* label) {
+  const TftSpiStats now = tftHostStats();
+  const TftSpiStats d = {
+    now.windows - lastStats.windows,
+    now.commands - lastStats.commands,
+    now.pixels - lastStats.pixels,
+    now.bytes - lastStats.bytes
+  };
+  lastStats = now;
+
+  const uint32_t passes = eventLoopStats().passes;
+  printStats(label, d, passes - lastPasses);
+  lastPasses = passes;
+}
+
+int main() {
+  hostSimReset();
+  eventLoopInit();
+  timerWheelInit(millis());
+
+  initDisplay();
+  inputQueueInit();
+  initRotaryEncoder();
+  initNavButtons();
+  radioInit(SIM_RADIOS, 3);
+  guiInit();
+  runMs(1);
+  printDelta("init");
+
+  char line[128];
+  while (fgets(line, sizeof(line), stdin)) {
+    line[strcspn(line, "\r\n")] = '\0';
+    if (line[0] == '\0' || line[0] == '#') continue;
+
+    char cmd[16] = {0};
+    char arg[96] = {0};
+    char arg2[16] = {0};
+    char arg3[16] = {0};
+    sscanf(line, "%15s %95s %15s %15s", cmd, arg, arg2, arg3);
+
+    if (strcmp(cmd, "wait") == 0) {
+      runMs((uint32_t)atol(arg));
+    } else if (strcmp(cmd, "rot") == 0) {
+      const long n = atol(arg);
+      const uint32_t stepMs = arg2[0] ? (uint32_t)atol(arg2) : SIM_STEP_MS;
+      for (long i = 0; i < labs(n); i++) rotateStep(n > 0, stepMs);
+    } else if (strcmp(cmd, "press") == 0) {
+      pressPin(ENC_SW, SIM_PRESS_MS);
+    } else if (strcmp(cmd, "long") == 0) {
+      pressPin(ENC_SW, SIM_LONG_MS);
+    } else if (strcmp(cmd, "left") == 0) {
+      pressPin(BTN_LEFT, SIM_PRESS_MS);
+    } else if (strcmp(cmd, "right") == 0) {
+      pressPin(BTN_RIGHT, SIM_PRESS_MS);
+    } else if (strcmp(cmd, "tlm") == 0) {
+      RadioTelemetry t = {};
+      t.sDbm = (int16_t)atol(arg);
+      t.swr100 = (uint16_t)atol(arg2);
+      t.fwdDw = (uint16_t)atol(arg3);
+      t.fields = TLM_S | TLM_SWR | TLM_FWD;
+      t.valid = true;
+      telemetryPublish(guiGetRadio(), t);
+      runMs(50);
+    } else if (strcmp(cmd, "snap") == 0) {
+      if (!tftHostSavePPM(arg)) fprintf(stderr, "snap: kann %s nicht schreiben\n", arg);
+      continue;
+    } else if (strcmp(cmd, "stats") == 0) {
+      printStats("total", tftHostStats(), eventLoopStats().passes);
+      continue;
+    } else if (strcmp(cmd, "latency") == 0) {
+      latencyDump();
+      continue;
+    } else {
+      fprintf(stderr, "unbekanntes Kommando: %s\n", line);
+      continue;
+    }
+
+    printDelta(line);
+  }
+
+  return 0;
+}
@@ -0,0 +1,359 @@
+// src/host/radio_load.cpp
+//
+// Lastgenerator fuer den Radio-Client (PlatformIO-Env "native_radio_load").
+// - lib/RadioTCP laeuft unveraendert (POSIX-Sockets), gefuettert mit
+//   Drehgeber-Bursts: jede Rastung aendert die Frequenz um step Hz, radioSet()
+//   wie in der GUI mit dem Endstand jedes Durchlaufs
+// - Gegenstelle: lib/RadioStandIn im selben Prozess (mit Stoerungen) oder ein
+//   laufender radio_standin / ein Radio (connect=<ip>:<port>)
+// - Fake-Clock (lib/HostSim) folgt der echten Zeit
+// - radios=<n>: jeder Burst geht an n Radios gleichzeitig (Stand-in mit n
+//   Radios bzw. connect= mit Ports port + 2u), alle Sockets ueber ein
+//   netMuxPoll(); Zaehler und RTTs ueber alle Radios summiert
+//
+// Je Burst:
+//   values      Zwischenfrequenzen, die die "GUI" gemeldet hat
+//   sent        davon gesendete SETs, Rest zusammengefasst (coalesced/skipped)
+//   cmd/s       quittierte SETs pro Sekunde (Burst + Nachlauf)
+//   rtt         Senden -> Quittung je SET: p50/p90/p99/max
+//   settle      letzte Rastung -> Endwert vom Radio bestaetigt
+//
+// Bursts (profile=...):
+//   slow    gemaechliches Drehen, 40 Rastungen, je 60 ms
+//   fast    schnelles Drehen, 400 Rastungen, Rate steigt auf ~400/s und faellt wieder
+//   flick   10 kurze Schnipser je 30 Rastungen, dazwischen 150 ms Pause
+//   spin    Dauerlast: 2000 Rastungen, eine je ms (mehr als die Pipeline bei
+//           Latenz schafft => hier wird zusammengefasst)
+//   all     alle vier nacheinander (Default)
+//   <datei> aufgezeichneter Burst, eine Zeile je Ereignis: "<ms> <rastungen>"
+//           (ms ab Burst-Beginn, aufsteigend; '#' = Kommentar)
+//
+// Aufruf: .pio/build/native_radio_load/program [profile=all] [step=1000] [runs=1]
+//           [connect=<ip>:<port>] [latency=<us>] [jitter=<us>] [drop=<n>]
+//           [segment=<bytes>] [gap=<us>] [seed=<n>] [radios=<n>]
+// Exit-Code 0 = jeder Endwert ist beim Radio angekommen
+
+#include <Arduino.h>
+#include <HostSim.h>
+
+#include <EventLoop.h>
+#include <TimerWheel.h>
+#include <RadioTCP.h>
+#include <RadioStandIn.h>
+#include <NetMux.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct BurstEvent {
+  uint32_t ms;      // ab Burst-Beginn
+  int32_t steps;    // Rastungen (Vorzeichen = Richtung)
+};
+
+struct Burst {
+  std::string name;
+  std::vector<BurstEvent> events;
+};
+
+static std::vector<uint32_t> rtts;   // SET-RTTs des laufenden Bursts (alle Radios)
+static uint8_t radios = 1;
+
+static void onAck(uint8_t, RadioParam, bool get, bool ok, uint32_t rttUs, void*) {
+  if (!get && ok) rtts.push_back(rttUs);
+}
+
+// --------------------
+// Bursts
+// --------------------
+
+static Burst burstSlow() {
+  Burst b{ "slow", {} };
+  for (uint32_t i = 0; i < 40; i++) b.events.push_back({ i * 60, 1 });
+  return b;
+}
+
+static Burst burstFast() {
+  // Rate steigt linear von 20/s auf 400/s und wieder zurueck
+  Burst b{ "fast", {} };
+  double t = 0;
+  for (uint32_t i = 0; i < 400; i++) {
+    const double x = (i < 200) ? i / 200.0 : (400 - i) / 200.0;
+    const double rate = 20.0 + 380.0 * x;
+    b.events.push_back({ (uint32_t)t, 1 });
+    t += 1000.0 / rate;
+  }
+  return b;
+}
+
+static Burst burstFlick() {
+  Burst b{ "flick", {} };
+  uint32_t t = 0;
+  for (uint32_t f = 0; f < 10; f++) {
+    const int32_t dir = (f % 3 == 2) ? -1 : 1;
+    for (uint32_t i = 0; i < 30; i++) {
+      b.events.push_back({ t, dir });
+      t += 2 + (i * 5) / 30;   // 2..6 ms je Rastung, laeuft aus
+    }
+    t += 150;
+  }
+  return b;
+}
+
+static Burst burstSpin() {
+  Burst b{ "spin", {} };
+  for (uint32_t i = 0; i < 2000; i++) b.events.push_back({ i, 1 });
+  return b;
+}
+
+/**
+ * @brief Aufgezeichneten Burst laden ("<ms> <rastungen>" je Zeile).
+ */
+static bool loadBurst(const char* path, Burst &b) {
+  FILE* f = fopen(path, "r");
+  if (!f) return false;
+
+  b.name = path;
+  char line[128];
+  while (fgets(line, sizeof(line), f)) {
+    if (line[0] == '#') continue;
+    unsigned long ms = 0;
+    long steps = 0;
+    if (sscanf(line, "%lu %ld", &ms, &steps) == 2) b.events.push_back({ (uint32_t)ms, (int32_t)steps });
+  }
+  fclose(f);
+  return !b.events.empty();
+}
+
+// --------------------
+// Ablauf
+// --------------------
+
+static void syncClock() {
+  static auto last = std::chrono::steady_clock::now();
+  const auto now = std::chrono::steady_clock::now();
+  const auto us = std::chrono::duration_cast<std::chrono::microseconds>(now - last).count();
+  if (us > 0) {
+    hostAdvanceUs((uint32_t)us);
+    last = now;
+  }
+}
+
+static void pass() {
+  syncClock();
+  timerRun(millis());
+  radioPoll();
+  netMuxPoll();
+}
+
+/**
+ * @brief Zaehler aller Radios summiert (RTTs: Maximum).
+ */
+static RadioStats totalStats() {
+  RadioStats t = {};
+  for (uint8_t r = 0; r < radios; r++) {
+    const RadioStats s = radioStats(r);
+    t.sent += s.sent;
+    t.acked += s.acked;
+    t.rejected += s.rejected;
+    t.coalesced += s.coalesced;
+    t.skipped += s.skipped;
+    t.readbacks += s.readbacks;
+    t.external += s.external;
+    t.offline += s.offline;
+    t.replayed += s.replayed;
+    t.connects += s.connects;
+    t.failures += s.failures;
+    if (s.maxRttUs > t.maxRttUs) t.maxRttUs = s.maxRttUs;
+  }
+  return t;
+}
+
+// Alle Radios verbunden, nichts offen, FRQ bestaetigt (freq = 0: beliebig)
+static bool allConfirmed(int32_t freq) {
+  for (uint8_t r = 0; r < radios; r++) {
+    int32_t confirmed = 0;
+    if (radioLinkState(r) != RADIO_LINK_UP || !radioSettled(r)) return false;
+    if (freq != 0 && (!radioConfirmed(r, RADIO_FRQ, confirmed) || confirmed != freq)) return false;
+  }
+  return true;
+}
+
+static uint32_t percentile(const std::vector<uint32_t> &sorted, uint32_t pct) {
+  if (sorted.empty()) return 0;
+  const size_t i = (sorted.size() * pct + 99) / 100;
+  return sorted[(i == 0) ? 0 : i - 1];
+}
+
+/**
+ * @brief Burst in Echtzeit abspielen, auf Bestaetigung des Endwerts warten, Zeile ausgeben.
+ * @return false, wenn der Endwert nicht innerhalb von 10 s bestaetigt wurde
+ */
+static bool runBurst(const Burst &b, int32_t &freq, int32_t stepHz) {
+  rtts.clear();
+  const RadioStats before = totalStats();
+  uint32_t values = 0;
+
+  const auto start = std::chrono::steady_clock::now();
+  auto elapsedMs = [&] {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count();
+  };
+
+  // Abspielen: alle faelligen Rastungen eines Durchlaufs => ein radioSet() (wie guiPollInput)
+  size_t next = 0;
+  while (next < b.events.size()) {
+    const uint32_t now = elapsedMs();
+    const int32_t f0 = freq;
+    while (next < b.events.size() && b.events[next].ms <= now) {
+      freq += b.events[next].steps * stepHz;
+      next++;
+    }
+    if (freq != f0) {
+      for (uint8_t r = 0; r < radios; r++) radioSet(r, RADIO_FRQ, freq);
+      values++;
+    }
+    pass();
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+  }
+  const auto inputDone = std::chrono::steady_clock::now();
+
+  // Nachlauf: bis der Endwert bestaetigt ist
+  bool ok = false;
+  while (std::chrono::steady_clock::now() - inputDone < std::chrono::seconds(10)) {
+    pass();
+    if (allConfirmed(freq)) {
+      ok = true;
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  const RadioStats s = totalStats();
+  const uint32_t sent = s.sent - before.sent;
+  const uint32_t acked = s.acked - before.acked;
+  const double totalS = std::chrono::duration<double>(end - start).count();
+  const double settleMs = std::chrono::duration<double, std::milli>(end - inputDone).count();
+
+  std::sort(rtts.begin(), rtts.end());
+  printf("%-10s %7u %6u %6u %7u %8.0f %7u %7u %7u %7u %9.1f %5u  %s\n",
+         b.name.c_str(), (unsigned)values, (unsigned)sent,
+         (unsigned)(s.coalesced - before.coalesced), (unsigned)(s.skipped - before.skipped),
+         acked / totalS, (unsigned)percentile(rtts, 50), (unsigned)percentile(rtts, 90),
+         (unsigned)percentile(rtts, 99), rtts.empty() ? 0u : (unsigned)rtts.back(), settleMs,
+         (unsigned)(s.failures - before.failures), ok ? "OK" : "FEHLER");
+  fflush(stdout);
+  return ok;
+}
+
+int main(int argc, char** argv) {
+  StandInOptions opt;
+  std::string profile = "all";
+  std::string connect;
+  int32_t stepHz = 1000;
+  uint32_t runs = 1;
+
+  for (int i = 1; i < argc; i++) {
+    const char* a = argv[i];
+    if (strncmp(a, "profile=", 8) == 0) profile = a + 8;
+    else if (strncmp(a, "step=", 5) == 0) stepHz = (int32_t)strtol(a + 5, nullptr, 10);
+    else if (strncmp(a, "runs=", 5) == 0) runs = (uint32_t)strtoul(a + 5, nullptr, 10);
+    else if (strncmp(a, "connect=", 8) == 0) connect = a + 8;
+    else if (!standInParseArg(opt, a)) {
+      fprintf(stderr, "unbekannte Option: %s\n", a);
+      return 2;
+    }
+  }
+
+  std::vector<Burst> bursts;
+  if (profile == "all" || profile == "slow") bursts.push_back(burstSlow());
+  if (profile == "all" || profile == "fast") bursts.push_back(burstFast());
+  if (profile == "all" || profile == "flick") bursts.push_back(burstFlick());
+  if (profile == "all" || profile == "spin") bursts.push_back(burstSpin());
+  if (bursts.empty()) {
+    Burst b;
+    if (!loadBurst(profile.c_str(), b)) {
+      fprintf(stderr, "kein Profil/keine Aufzeichnung: %s\n", profile.c_str());
+      return 2;
+    }
+    bursts.push_back(b);
+  }
+
+  hostSimReset();
+  eventLoopInit();
+  timerWheelInit(millis());
+
+  // Gegenstelle
+  std::string host = "127.0.0.1";
+  uint16_t port = 0;
+  if (connect.empty()) {
+    if (!standInStart(0, opt)) {
+      fprintf(stderr, "stand-in: kein Port\n");
+      return 1;
+    }
+    port = standInPort();
+    radios = standInRadios();
+    printf("stand-in: radios=%u latency=%u us jitter=%u us drop=%u segment=%u gap=%u us\n",
+           (unsigned)radios, (unsigned)opt.latency_us, (unsigned)opt.jitter_us, (unsigned)opt.drop_every,
+           (unsigned)opt.segment_max, (unsigned)opt.segment_gap_us);
+  } else {
+    const size_t colon = connect.rfind(':');
+    host = connect.substr(0, colon);
+    port = (colon == std::string::npos) ? 5025 : (uint16_t)strtoul(connect.c_str() + colon + 1, nullptr, 10);
+    radios = (uint8_t)std::min<uint32_t>(std::max<uint32_t>(opt.radios, 1), RADIO_MAX);
+    printf("Radio: %s:%u (%u Radios)\n", host.c_str(), (unsigned)port, (unsigned)radios);
+  }
+
+  // Radio r: eigener Port (Stand-in bzw. port + 2r), keine Telemetrie
+  RadioEndpoint eps[RADIO_MAX];
+  std::vector<std::string> names;
+  for (uint8_t r = 0; r < radios; r++) names.push_back("R" + std::to_string(r + 1));
+  for (uint8_t r = 0; r < radios; r++) {
+    const uint16_t p = connect.empty() ? standInPort(r) : (uint16_t)(port + 2 * r);
+    eps[r] = RadioEndpoint{ names[r].c_str(), host.c_str(), p, 0 };
+  }
+
+  radioOnAck(onAck, nullptr);
+  radioInit(eps, radios);
+
+  const auto connectStart = std::chrono::steady_clock::now();
+  while (!allConfirmed(0)) {
+    pass();
+    if (std::chrono::steady_clock::now() - connectStart > std::chrono::seconds(5)) {
+      fprintf(stderr, "keine Verbindung\n");
+      return 1;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+
+  // Startfrequenz: was das Radio meldet (Zuruecklesen beim Verbinden)
+  int32_t freq = 0;
+  if (!radioConfirmed(0, RADIO_FRQ, freq) || freq == 0) freq = 100000000;
+
+  printf("%-10s %7s %6s %6s %7s %8s %7s %7s %7s %7s %9s %5s\n", "burst", "values", "sent",
+         "coal", "skipped", "cmd/s", "p50us", "p90us", "p99us", "maxus", "settle_ms", "fail");
+
+  bool allOk = true;
+  for (uint32_t r = 0; r < runs; r++) {
+    for (const Burst &b : bursts) allOk &= runBurst(b, freq, stepHz);
+  }
+
+  const RadioStats s = totalStats();
+  printf("gesamt: sent=%u acked=%u coalesced=%u skipped=%u readbacks=%u connects=%u failures=%u\n",
+         (unsigned)s.sent, (unsigned)s.acked, (unsigned)s.coalesced, (unsigned)s.skipped,
+         (unsigned)s.readbacks, (unsigned)s.connects, (unsigned)s.failures);
+  const NetMuxStats m = netMuxStats();
+  printf("netmux: polls=%u ready=%u dispatched=%u sockets=%u (max %u)\n", (unsigned)m.polls,
+         (unsigned)m.ready, (unsigned)m.dispatched, (unsigned)m.sockets, (unsigned)m.maxSockets);
+
+  radioStop();
+  if (connect.empty()) standInStop();
+  return allOk ? 0 : 1;
+}
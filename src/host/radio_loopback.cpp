@@ -0,0 +1,500 @@
+// src/host/radio_loopback.cpp
+//
+// Host-Test des Radio-Clients gegen den lokalen Stand-in (PlatformIO-Env "native_radio").
+// - lib/RadioTCP laeuft unveraendert ueber POSIX-Sockets, Gegenstelle ist
+//   lib/RadioStandIn auf 127.0.0.1 (freier Port)
+// - Fake-Clock (lib/HostSim) folgt der echten Zeit, damit Timeouts und
+//   Wiederverbinden wie auf dem Geraet ablaufen
+//
+// Szenarien:
+//   spin     schnelles Drehen: 2000 Frequenzen ohne Pause => Endwert kommt an,
+//            Zwischenwerte werden zusammengefasst, alles gesendete ist quittiert
+//   params   MOD/PWR setzen, gleicher Wert wird nicht erneut gesendet
+//   delta    hin und zurueck gedreht, bevor gesendet wurde => nichts gesendet
+//   readback Wert am Radio verstellt => per GET uebernommen, genau eine
+//            Benachrichtigung, nichts zurueckgeschrieben
+//   drop     Verbindungsabbruch mitten im Drehen => neu verbinden, Endwert kommt an
+//   ring     Telemetrie-Parser: Strom in zufaelligen Stuecken durch den Ring
+//            (Zeilen ueber das Ringende), fehlerhafte und ueberlange Zeilen
+//   telemetry Telemetrie-Strom des Stand-in: Rahmen kommen an, Snapshot gueltig,
+//            FWD folgt dem gesetzten PWR-Index
+//   offline  Netz weg: keine Versuche, Aenderungen landen verdichtet im Journal;
+//            Radio weg: Versuche mit wachsendem Abstand; danach Journal in
+//            einem Rutsch nachgeholt
+//   multi    drei Radios (Stand-in mit radios=3): jedes bekommt seine Werte,
+//            Readback/Abbruch betreffen nur ihr Radio, Telemetrie je Radio,
+//            ein poll() je Durchlauf fuer alle sechs Sockets
+//
+// Aufruf: .pio/build/native_radio/program
+// Exit-Code 0 = alle Szenarien bestanden
+
+#include <Arduino.h>
+#include <HostSim.h>
+
+#include <EventLoop.h>
+#include <TimerWheel.h>
+#include <RadioTCP.h>
+#include <RadioTelemetry.h>
+#include <RadioStandIn.h>
+#include <NetMux.h>
+#include <radio_config.h>
+
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <stdio.h>
+#include <string.h>
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+  printf("  %-52s %s\n", what, ok ? "OK" : "FEHLER");
+  if (!ok) failures++;
+}
+
+/**
+ * @brief Fake-Clock auf die echte Zeit nachziehen.
+ */
+static void syncClock() {
+  static auto last = std::chrono::steady_clock::now();
+  const auto now = std::chrono::steady_clock::now();
+  const auto us = std::chrono::duration_cast<std::chrono::microseconds>(now - last).count();
+  if (us > 0) {
+    hostAdvanceUs((uint32_t)us);
+    last = now;
+  }
+}
+
+/**
+ * @brief Ein Durchlauf wie loop(): Timer, Clients, ein poll() fuer alle Sockets.
+ */
+static uint32_t passes = 0;
+
+static void pass() {
+  passes++;
+  syncClock();
+  timerRun(millis());
+  radioPoll();
+  telemetryPoll();
+  netMuxPoll();
+}
+
+/**
+ * @brief Durchlaeufe, bis cond erfuellt ist oder timeoutMs (echte Zeit) vergangen sind.
+ */
+template <typename Cond>
+static bool runUntil(Cond cond, uint32_t timeoutMs) {
+  const auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+  while (std::chrono::steady_clock::now() < end) {
+    pass();
+    if (cond()) return true;
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+  return cond();
+}
+
+static bool linkUp() { return radioLinkState(0) == RADIO_LINK_UP; }
+static bool settled() { return linkUp() && radioSettled(0); }
+
+static void printStats(const char* label, uint8_t radio = 0) {
+  const RadioStats s = radioStats(radio);
+  printf("  [%s] sent=%u acked=%u rejected=%u coalesced=%u skipped=%u readbacks=%u external=%u "
+         "offline=%u replayed=%u connects=%u failures=%u rtt=%u/%u us\n",
+         label, (unsigned)s.sent, (unsigned)s.acked, (unsigned)s.rejected, (unsigned)s.coalesced,
+         (unsigned)s.skipped, (unsigned)s.readbacks, (unsigned)s.external, (unsigned)s.offline,
+         (unsigned)s.replayed, (unsigned)s.connects, (unsigned)s.failures, (unsigned)s.lastRttUs,
+         (unsigned)s.maxRttUs);
+}
+
+// Benachrichtigungen des Spiegels (wie die GUI sie bekommt)
+static uint32_t notifyCount[RADIO_PARAM_COUNT];
+static uint32_t externalCount[RADIO_PARAM_COUNT];
+static int32_t lastNotified[RADIO_PARAM_COUNT];
+
+static void onRadioChange(RadioParam param, int32_t value, bool external, void*) {
+  notifyCount[param]++;
+  if (external) externalCount[param]++;
+  lastNotified[param] = value;
+}
+
+// Zustandswechsel der Verbindung (wie die Footer-Anzeige sie bekommt)
+static std::vector<uint32_t> attemptMs;   // Beginn jedes Verbindungsaufbaus
+static uint8_t lastLink = RADIO_LINK_DOWN;
+
+static void onLinkChange(uint8_t radio, uint8_t state, void*) {
+  if (radio != 0) return;
+  if (state == RADIO_LINK_CONNECTING) attemptMs.push_back(millis());
+  lastLink = state;
+}
+
+static void scenarioSpin() {
+  printf("spin\n");
+  int32_t f = 100000000;
+  for (int i = 0; i < 2000; i++) {
+    f += 1000;
+    radioSet(0, RADIO_FRQ, f);
+    pass();
+  }
+  check(runUntil(settled, 2000), "alles quittiert");
+
+  int32_t confirmed = 0;
+  const RadioStats s = radioStats(0);
+  check(radioConfirmed(0, RADIO_FRQ, confirmed) && confirmed == f, "Endwert vom Radio bestaetigt");
+  check(standInState().value[RADIO_FRQ] == f, "Endwert im Radio");
+  check(s.coalesced > 0 && s.sent + s.coalesced == 2000, "Zwischenwerte zusammengefasst");
+  check(s.acked == s.sent, "jedes Kommando quittiert");
+  printStats("spin");
+}
+
+static void scenarioParams() {
+  printf("params\n");
+  radioSet(0, RADIO_MOD, 2);
+  radioSet(0, RADIO_PWR, 1);
+  check(runUntil(settled, 1000), "MOD/PWR quittiert");
+
+  const StandInState st = standInState();
+  check(st.value[RADIO_MOD] == 2 && st.value[RADIO_PWR] == 1, "MOD/PWR im Radio");
+
+  const uint32_t sent = radioStats(0).sent;
+  radioSet(0, RADIO_MOD, 2);
+  runUntil(settled, 50);
+  check(radioStats(0).sent == sent, "gleicher Wert wird nicht erneut gesendet");
+}
+
+static void scenarioDelta() {
+  printf("delta\n");
+  const RadioStats before = radioStats(0);
+  const uint32_t notified = notifyCount[RADIO_PWR];
+
+  radioSet(0, RADIO_PWR, 3);
+  radioSet(0, RADIO_PWR, 1);   // zurueck auf den bestaetigten Wert, noch vor dem Senden
+  check(runUntil(settled, 1000), "nichts offen");
+
+  const RadioStats s = radioStats(0);
+  check(s.sent == before.sent, "kein Kommando gesendet");
+  check(s.skipped == before.skipped + 1, "als uebersprungen gezaehlt");
+  check(notifyCount[RADIO_PWR] == notified, "keine Benachrichtigung");
+}
+
+static void scenarioReadback() {
+  printf("readback\n");
+  const RadioParamState before = radioParamState(0, RADIO_FRQ);
+  const uint32_t sent = radioStats(0).sent;
+  const uint32_t notified = notifyCount[RADIO_FRQ];
+  const int32_t f = 433920000;
+
+  standInSetValue(RADIO_FRQ, f);
+  int32_t confirmed = 0;
+  check(runUntil([&] { return radioConfirmed(0, RADIO_FRQ, confirmed) && confirmed == f; },
+                 RADIO_CONFIG.readback_ms + 1000),
+        "fremder Wert zurueckgelesen");
+
+  const RadioParamState st = radioParamState(0, RADIO_FRQ);
+  check(st.desired == f && st.desiredGen == before.desiredGen + 1, "als Sollwert uebernommen");
+  check(st.confirmedGen == before.confirmedGen + 1, "eine neue Generation");
+  check(notifyCount[RADIO_FRQ] == notified + 1 && externalCount[RADIO_FRQ] > 0 &&
+        lastNotified[RADIO_FRQ] == f, "genau eine Benachrichtigung (extern)");
+
+  // Naechster Zyklus liest denselben Wert: keine Benachrichtigung, nichts gesendet
+  const uint32_t reads = standInState().reads;
+  runUntil([&] { return standInState().reads >= reads + RADIO_PARAM_COUNT && settled(); },
+           RADIO_CONFIG.readback_ms + 1000);
+  check(notifyCount[RADIO_FRQ] == notified + 1, "unveraenderter Wert meldet nichts");
+  check(radioStats(0).sent == sent && standInState().value[RADIO_FRQ] == f, "nichts zurueckgeschrieben");
+  printStats("readback");
+}
+
+static void scenarioDrop() {
+  printf("drop\n");
+  const uint32_t connects = radioStats(0).connects;
+
+  int32_t f = 200000000;
+  for (int i = 0; i < 500; i++) {
+    f += 1000;
+    radioSet(0, RADIO_FRQ, f);
+    pass();
+    if (i == 250) standInDropConnection();
+  }
+  check(runUntil([] { return radioStats(0).connects > 1 && settled(); }, 5000),
+        "neu verbunden und quittiert");
+  check(radioStats(0).connects == connects + 1, "genau eine neue Verbindung");
+  check(standInState().value[RADIO_FRQ] == f, "Endwert nach Wiederverbinden im Radio");
+  printStats("drop");
+}
+
+static void scenarioRing() {
+  printf("ring\n");
+  TelemetryRing r = {};
+  tlmRingReset(r);
+  std::mt19937 rnd(7);
+
+  // Strom: 1000 Rahmen, dazwischen eine kaputte und eine ueberlange Zeile
+  std::string stream;
+  std::vector<TelemetryFrame> expect;
+  for (int i = 0; i < 1000; i++) {
+    char line[64];
+    const int s = -127 + i % 95, swr = 100 + i % 201, fwd = i * 7 % 600;
+    snprintf(line, sizeof(line), (i % 3) ? "TLM S=%d SWR=%d FWD=%d\n" : "TLM FWD=%3$d X=1 SWR=%2$d S=%1$d\r\n",
+             s, swr, fwd);
+    stream += line;
+    expect.push_back(TelemetryFrame{ (int16_t)s, (uint16_t)swr, (uint16_t)fwd, TLM_S | TLM_SWR | TLM_FWD });
+    if (i == 300) stream += "TLM S=12a\n";
+    if (i == 600) stream += "TLM " + std::string(TLM_RING_SIZE + 50, 'x') + "\n";
+  }
+
+  size_t pos = 0, got = 0, bad = 0;
+  bool same = true;
+  TelemetryFrame f = {};
+  while (pos < stream.size()) {
+    size_t space = 0;
+    uint8_t* dst = tlmRingWritePtr(r, space);
+    size_t n = 1 + rnd() % 40;
+    if (n > space) n = space;
+    if (n > stream.size() - pos) n = stream.size() - pos;
+    memcpy(dst, stream.data() + pos, n);
+    tlmRingCommit(r, n);
+    pos += n;
+
+    TelemetryParseResult res;
+    while ((res = tlmRingNext(r, f)) != TLM_PARSE_MORE) {
+      if (res == TLM_PARSE_BAD) {
+        bad++;
+        continue;
+      }
+      if (got >= expect.size()) {
+        same = false;
+        continue;
+      }
+      const TelemetryFrame &e = expect[got++];
+      if (f.sDbm != e.sDbm || f.swr100 != e.swr100 || f.fwdDw != e.fwdDw || f.fields != e.fields) same = false;
+    }
+  }
+  check(got == expect.size() && same, "alle Rahmen, Werte stimmen");
+  check(bad == 1 && r.overruns == 1, "kaputte/ueberlange Zeile verworfen");
+}
+
+static void scenarioTelemetry() {
+  printf("telemetry\n");
+  static RadioEndpoint ep;
+  ep = RadioEndpoint{ "R1", "127.0.0.1", standInPort(), standInTelemetryPort() };
+  telemetryInit(&ep, 1);
+  runUntil([] { return false; }, 1000);
+
+  RadioTelemetry t = {};
+  telemetryRead(0, t);
+  TelemetryStats s = telemetryStats(0);
+  printf("  frames=%u publishes=%u reads=%u bytes=%u bad=%u\n", (unsigned)s.frames,
+         (unsigned)s.publishes, (unsigned)s.reads, (unsigned)s.bytes, (unsigned)s.bad);
+  check(s.connects == 1 && s.frames >= 15 && s.bad == 0 && s.overruns == 0, "Rahmen mit 20 Hz empfangen");
+  check(t.valid && t.fields == (TLM_S | TLM_SWR | TLM_FWD), "Snapshot gueltig, alle Felder");
+  check(t.sDbm >= -127 && t.sDbm <= -33 && t.swr100 >= 100 && t.swr100 <= 300, "Werte im Bereich");
+
+  radioSet(0, RADIO_PWR, 2);
+  check(runUntil([] {
+          RadioTelemetry x;
+          telemetryRead(0, x);
+          return x.fwdDw == 500;
+        }, 1000),
+        "FWD folgt PWR (HIGH = 50 W)");
+
+  telemetryStop();
+  telemetryRead(0, t);
+  check(!t.valid, "nach dem Trennen ungueltig");
+}
+
+static void scenarioOffline() {
+  printf("offline\n");
+  const RadioStats before = radioStats(0);
+  const uint32_t connections = standInState().connections;
+
+  // Netz weg: Verbindung zu, keine Versuche, Aenderungen nur im Journal
+  radioNetworkUp(false);
+  pass();   // wirkt im naechsten radioPoll()
+  int32_t f = 300000000;
+  for (int i = 0; i < 200; i++) {
+    f += 1000;
+    radioSet(0, RADIO_FRQ, f);
+    if (i == 100) radioSet(0, RADIO_MOD, 3);
+    pass();
+  }
+  runUntil([] { return false; }, 300);
+  check(lastLink == RADIO_LINK_DOWN && radioLinkState(0) == RADIO_LINK_DOWN, "getrennt, gemeldet");
+  check(standInState().connections == connections, "ohne Netz kein Versuch");
+
+  RadioStats s = radioStats(0);
+  check(s.offline == before.offline + 201 && s.sent == before.sent, "Aenderungen offline gesammelt");
+
+  // Radio weg, Netz wieder da: Versuche mit wachsendem Abstand
+  const uint16_t port = standInPort();
+  standInStop();
+  attemptMs.clear();
+  radioNetworkUp(true);
+  runUntil([] { return false; }, 2500);
+
+  bool growing = attemptMs.size() >= 3;
+  for (size_t i = 2; i < attemptMs.size(); i++) {
+    const uint32_t prev = attemptMs[i - 1] - attemptMs[i - 2];
+    const uint32_t gap = attemptMs[i] - attemptMs[i - 1];
+    if (gap * 10 < prev * 14) growing = false;   // ~x2, Zufall +-12.5%
+  }
+  printf("  %u Versuche in 2500 ms\n", (unsigned)attemptMs.size());
+  check(growing && attemptMs.size() <= 5, "Backoff waechst");
+
+  // Radio wieder da: Journal (FRQ + MOD) in einem Rutsch
+  check(standInStart(port), "Stand-in neu gestartet");
+  check(runUntil(settled, RADIO_CONFIG.retry_max_ms + 1000), "wieder verbunden und quittiert");
+
+  s = radioStats(0);
+  check(s.replayed == before.replayed + 2, "Journal in einem Rutsch nachgeholt");
+  check(s.sent == before.sent + 2, "je Parameter ein Kommando");
+  const StandInState st = standInState();
+  check(st.value[RADIO_FRQ] == f && st.value[RADIO_MOD] == 3, "Endstand im Radio");
+  printStats("offline");
+}
+
+// Benachrichtigungen der Radios 1/2 im Szenario multi (arg = Radio)
+static uint32_t multiExternal[RADIO_MAX];
+static int32_t multiLast[RADIO_MAX];
+
+static void onMultiChange(RadioParam param, int32_t value, bool external, void* arg) {
+  const uintptr_t radio = (uintptr_t)arg;
+  if (param != RADIO_FRQ || radio >= RADIO_MAX) return;
+  if (external) multiExternal[radio]++;
+  multiLast[radio] = value;
+}
+
+static void scenarioMulti() {
+  printf("multi\n");
+  const uint8_t N = 3;
+  radioStop();
+  standInStop();
+
+  StandInOptions opt;
+  opt.telemetry_hz = 20;
+  opt.radios = N;
+  if (!standInStart(0, opt)) {
+    check(false, "Stand-in mit 3 Radios");
+    return;
+  }
+
+  static RadioEndpoint eps[N];
+  static const char* const NAMES[N] = { "R1", "R2", "R3" };
+  for (uint8_t r = 0; r < N; r++) {
+    eps[r] = RadioEndpoint{ NAMES[r], "127.0.0.1", standInPort(r), standInTelemetryPort(r) };
+  }
+  radioSubscribe(1, onMultiChange, (void*)(uintptr_t)1);
+  radioSubscribe(2, onMultiChange, (void*)(uintptr_t)2);
+  radioInit(eps, N);
+  telemetryInit(eps, N);
+
+  const uint32_t passes0 = passes;
+  const uint32_t polls0 = netMuxStats().polls;
+
+  auto allSettled = [] {
+    for (uint8_t r = 0; r < 3; r++) {
+      if (radioLinkState(r) != RADIO_LINK_UP || !radioSettled(r)) return false;
+    }
+    return true;
+  };
+  check(runUntil(allSettled, 1000), "alle Radios verbunden");
+
+  // Jedes Radio bekommt seine eigenen Werte
+  for (uint8_t r = 0; r < N; r++) {
+    radioSet(r, RADIO_FRQ, 144000000 + r * 1000000);
+    radioSet(r, RADIO_PWR, r);
+  }
+  check(runUntil(allSettled, 1000), "alles quittiert");
+  bool own = true;
+  for (uint8_t r = 0; r < N; r++) {
+    const StandInState st = standInState(r);
+    if (st.value[RADIO_FRQ] != 144000000 + r * 1000000 || st.value[RADIO_PWR] != r) own = false;
+  }
+  check(own, "jedes Radio hat seine Werte");
+
+  // Readback nur auf Radio 2
+  const uint32_t ext1 = multiExternal[1];
+  const uint32_t ext2 = multiExternal[2];
+  standInSetValue(RADIO_FRQ, 145500000, 2);
+  int32_t confirmed = 0;
+  check(runUntil([&] { return radioConfirmed(2, RADIO_FRQ, confirmed) && confirmed == 145500000; },
+                 RADIO_CONFIG.readback_ms + 1000),
+        "Readback auf Radio 2");
+  check(multiExternal[2] == ext2 + 1 && multiLast[2] == 145500000 && multiExternal[1] == ext1,
+        "Benachrichtigung nur fuer Radio 2");
+  check(radioConfirmed(1, RADIO_FRQ, confirmed) && confirmed == 145000000, "Radio 1 unveraendert");
+
+  // Abbruch nur auf Radio 1
+  uint32_t connects[N];
+  for (uint8_t r = 0; r < N; r++) connects[r] = radioStats(r).connects;
+  standInDropConnection(1);
+  radioSet(1, RADIO_FRQ, 146000000);
+  check(runUntil([&] { return radioStats(1).connects > connects[1] && allSettled(); }, 5000),
+        "Radio 1 neu verbunden");
+  check(radioStats(0).connects == connects[0] && radioStats(2).connects == connects[2],
+        "andere Radios bleiben verbunden");
+  check(standInState(1).value[RADIO_FRQ] == 146000000, "Endwert in Radio 1");
+
+  // Telemetrie je Radio: FWD folgt dem PWR des jeweiligen Radios
+  static const uint16_t FWD[N] = { 50, 200, 500 };
+  check(runUntil([] {
+          for (uint8_t r = 0; r < 3; r++) {
+            RadioTelemetry t;
+            telemetryRead(r, t);
+            if (!t.valid || t.fwdDw != FWD[r]) return false;
+          }
+          return true;
+        }, 1000),
+        "Telemetrie je Radio (5/20/50 W)");
+
+  const NetMuxStats m = netMuxStats();
+  printf("  passes=%u polls=%u ready=%u dispatched=%u sockets=%u/%u\n",
+         (unsigned)(passes - passes0), (unsigned)(m.polls - polls0), (unsigned)m.ready,
+         (unsigned)m.dispatched, (unsigned)m.sockets, (unsigned)m.maxSockets);
+  check(m.polls - polls0 == passes - passes0 && m.sockets == 2 * N, "ein poll() je Durchlauf, 6 Sockets");
+  for (uint8_t r = 0; r < N; r++) {
+    char label[8];
+    snprintf(label, sizeof(label), "R%u", (unsigned)(r + 1));
+    printStats(label, r);
+  }
+
+  telemetryStop();
+}
+
+int main() {
+  hostSimReset();
+  eventLoopInit();
+  timerWheelInit(millis());
+
+  StandInOptions opt;
+  opt.telemetry_hz = 20;
+  if (!standInStart(0, opt)) {
+    fprintf(stderr, "stand-in: kein Port\n");
+    return 1;
+  }
+  static RadioEndpoint ep = { "R1", "127.0.0.1", standInPort(), 0 };
+  radioSubscribe(0, onRadioChange, nullptr);
+  radioOnLink(onLinkChange, nullptr);
+  radioInit(&ep, 1);
+  if (!runUntil(linkUp, 1000)) {
+    fprintf(stderr, "keine Verbindung zum Stand-in\n");
+    return 1;
+  }
+
+  scenarioSpin();
+  scenarioParams();
+  scenarioDelta();
+  scenarioReadback();
+  scenarioDrop();
+  scenarioRing();
+  scenarioTelemetry();
+  scenarioOffline();
+  scenarioMulti();
+
+  radioStop();
+  standInStop();
+
+  printf(failures ? "FEHLER: %d\n" : "alles OK\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,86 @@
+// src/host/radio_standin.cpp
+//
+// Stand-in-Radio als eigenstaendiger Server (PlatformIO-Env "native_radio_standin").
+// Bedient denselben TCP-Steuerendpunkt wie das Radio, z.B. fuer das echte Panel
+// im LAN (any) oder fuer radio_load gegen einen entfernten Rechner.
+//
+// Aufruf: .pio/build/native_radio_standin/program [port=5025] [any]
+//           [latency=<us>] [jitter=<us>] [drop=<n>] [segment=<bytes>] [gap=<us>] [seed=<n>]
+//           [telemetry=<hz>] [radios=<n>]
+//   latency/jitter  Antwortverzoegerung je Kommando (+ zufaellig 0..jitter)
+//   drop            Verbindung nach jedem n-ten Kommando trennen
+//   segment/gap     Antworten in Stuecken von 1..segment Bytes, gap us Pause dazwischen
+//   any             auf allen Interfaces lauschen (sonst 127.0.0.1)
+//   telemetry       Telemetrie-Zeilen/s auf port+1 (Default 20, 0 = aus)
+//   radios          Anzahl Radios (Default 1), Radio u auf port+2u / port+2u+1
+//
+// Gibt jede Sekunde den Zustand je Radio aus; Ende mit Ctrl-C.
+
+#include <RadioStandIn.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static std::atomic<bool> stopRequested(false);
+
+static void onSignal(int) {
+  stopRequested.store(true);
+}
+
+int main(int argc, char** argv) {
+  StandInOptions opt;
+  opt.telemetry_hz = 20;
+  uint16_t port = 5025;
+
+  for (int i = 1; i < argc; i++) {
+    if (strncmp(argv[i], "port=", 5) == 0) port = (uint16_t)strtoul(argv[i] + 5, nullptr, 10);
+    else if (!standInParseArg(opt, argv[i])) {
+      fprintf(stderr, "unbekannte Option: %s\n", argv[i]);
+      return 2;
+    }
+  }
+
+  if (!standInStart(port, opt)) {
+    fprintf(stderr, "Port %u nicht verfuegbar\n", (unsigned)port);
+    return 1;
+  }
+  const uint8_t radios = standInRadios();
+  for (uint8_t r = 0; r < radios; r++) {
+    printf("stand-in R%u auf %s:%u (telemetrie %u, %u Hz)\n", (unsigned)(r + 1),
+           opt.bind_any ? "0.0.0.0" : "127.0.0.1", (unsigned)standInPort(r),
+           (unsigned)standInTelemetryPort(r), (unsigned)opt.telemetry_hz);
+  }
+  printf("latency=%u jitter=%u drop=%u segment=%u gap=%u\n", (unsigned)opt.latency_us,
+         (unsigned)opt.jitter_us, (unsigned)opt.drop_every, (unsigned)opt.segment_max,
+         (unsigned)opt.segment_gap_us);
+
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+
+  StandInState last[STANDIN_RADIOS_MAX] = {};
+  while (!stopRequested.load()) {
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    for (uint8_t r = 0; r < radios; r++) {
+      const StandInState st = standInState(r);
+      printf("R%u conn=%u cmds=%u (+%u/s) get=%u err=%u drops=%u segments=%u tlm=%u/%u (+%u/s)  "
+             "FRQ=%ld MOD=%ld PWR=%ld\n",
+             (unsigned)(r + 1), (unsigned)st.connections, (unsigned)st.commands,
+             (unsigned)(st.commands - last[r].commands), (unsigned)st.reads, (unsigned)st.rejected,
+             (unsigned)st.drops, (unsigned)st.segments, (unsigned)st.tlmConnections,
+             (unsigned)st.tlmFrames, (unsigned)(st.tlmFrames - last[r].tlmFrames),
+             (long)st.value[0], (long)st.value[1], (long)st.value[2]);
+      last[r] = st;
+    }
+    fflush(stdout);
+  }
+
+  standInStop();
+  return 0;
+}
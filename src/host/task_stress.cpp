@@ -0,0 +1,212 @@
+// src/host/task_stress.cpp
+//
+// Stresstest der Task-Schicht auf dem Host (PlatformIO-Env "native_tasks").
+// - TaskRuntime laeuft hier auf std::thread, Queues/Snapshots sind dieselben
+//   Header/Quellen wie in der Firmware
+// - Input-Queue: mehrere Producer-Tasks, ein Consumer; geprueft wird
+//   Reihenfolge je Producer und Vollstaendigkeit (empfangen + verworfen = gesendet)
+// - Snapshot: ein Schreiber, mehrere Leser; jeder gelesene Stand muss in sich
+//   konsistent sein und die Version darf nie rueckwaerts laufen
+// - Radio-Grenze wie mit GUI_TASKS: ein "GUI"-Task stellt Sollwerte per
+//   radioRequest() ein und liest RadioView, ein "Netz"-Task ruft radioPoll();
+//   der Endwert muss im Spiegel ankommen, gelesene Werte nie rueckwaerts laufen
+//
+// Aufruf: .pio/build/native_tasks/program [sekunden]   (Default 2 s)
+// Exit-Code 0 = alles konsistent
+
+#include <InputEvents.h>
+#include <Snapshot.h>
+#include <TaskRuntime.h>
+#include <RadioTCP.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static const uint8_t PRODUCERS = 2;
+static const uint8_t READERS = 2;
+
+// --------------------
+// Input-Queue
+// --------------------
+struct Producer {
+  uint8_t source;
+  int32_t next;                 // laufende Nummer (value)
+  std::atomic<uint32_t> sent;
+};
+
+static Producer producers[PRODUCERS];
+
+static int32_t expected[PRODUCERS];   // naechste erwartete Nummer je Quelle (Consumer)
+static uint32_t received = 0;
+static uint32_t orderErrors = 0;
+
+static void producerStep(void* arg) {
+  Producer &p = *(Producer*)arg;
+  for (uint8_t i = 0; i < 16; i++) {
+    if (inputPush(p.source, INPUT_ROTATE, 0, p.next)) p.next++;
+    p.sent.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+static void consumerStep(void*) {
+  InputEvent batch[INPUT_QUEUE_SIZE];
+  const uint8_t n = inputDrain(batch, INPUT_QUEUE_SIZE);
+
+  for (uint8_t i = 0; i < n; i++) {
+    const InputEvent &e = batch[i];
+    if (e.source >= PRODUCERS || e.value != expected[e.source]) orderErrors++;
+    else expected[e.source]++;
+    received++;
+  }
+}
+
+// --------------------
+// Snapshot
+// --------------------
+// Alle Felder werden aus demselben Zaehler abgeleitet => Mischstaende fallen auf
+struct StressState {
+  uint32_t a;
+  uint32_t b;         // ~a
+  uint16_t c;         // (uint16_t)a
+  uint8_t d;          // (uint8_t)(a * 7)
+  int32_t e[5];       // a + i
+};
+
+static Snapshot<StressState> snap;
+static uint32_t writerCounter = 0;
+
+struct Reader {
+  uint32_t lastVersion;
+  std::atomic<uint32_t> reads;
+  std::atomic<uint32_t> torn;
+  std::atomic<uint32_t> backwards;
+};
+
+static Reader readers[READERS];
+
+static StressState makeState(uint32_t a) {
+  StressState s = {};
+  s.a = a;
+  s.b = ~a;
+  s.c = (uint16_t)a;
+  s.d = (uint8_t)(a * 7);
+  for (uint8_t i = 0; i < 5; i++) s.e[i] = (int32_t)(a + i);
+  return s;
+}
+
+static bool consistent(const StressState &s) {
+  const StressState ref = makeState(s.a);
+  if (s.b != ref.b || s.c != ref.c || s.d != ref.d) return false;
+  for (uint8_t i = 0; i < 5; i++) if (s.e[i] != ref.e[i]) return false;
+  return true;
+}
+
+static void writerStep(void*) {
+  for (uint8_t i = 0; i < 64; i++) snapshotPublish(snap, makeState(++writerCounter));
+}
+
+static void readerStep(void* arg) {
+  Reader &r = *(Reader*)arg;
+  StressState s;
+  const uint32_t v = snapshotRead(snap, s);
+
+  if (!consistent(s)) r.torn.fetch_add(1, std::memory_order_relaxed);
+  if ((int32_t)(v - r.lastVersion) < 0) r.backwards.fetch_add(1, std::memory_order_relaxed);
+  r.lastVersion = v;
+  r.reads.fetch_add(1, std::memory_order_relaxed);
+}
+
+// --------------------
+// Radio-Grenze (radioRequest() / RadioView)
+// --------------------
+// Port 0 = nur Spiegel, keine Verbindung
+static const RadioEndpoint STRESS_RADIO[1] = { { "stress", "127.0.0.1", 0, 0 } };
+
+static int32_t guiFreq = 0;          // zuletzt angeforderter Wert (GUI-Task)
+static uint32_t guiViewBackwards = 0;
+static uint32_t guiViewVersion = 0;
+
+static void guiStep(void*) {
+  for (uint8_t i = 0; i < 16; i++) radioRequest(0, RADIO_FRQ, ++guiFreq);
+
+  // Eigene Werte sind sofort sichtbar, uebernommene koennen nur neuer sein
+  RadioView v;
+  const uint32_t version = radioReadView(0, v);
+  if (v.value[RADIO_FRQ] != guiFreq || (int32_t)(version - guiViewVersion) < 0) guiViewBackwards++;
+  guiViewVersion = version;
+}
+
+static void netStep(void*) {
+  radioPoll();
+}
+
+int main(int argc, char** argv) {
+  const int seconds = (argc > 1) ? atoi(argv[1]) : 2;
+
+  inputQueueInit();
+  snapshotInit(snap, makeState(0));
+  radioInit(STRESS_RADIO, 1);
+
+  for (uint8_t i = 0; i < PRODUCERS; i++) {
+    producers[i].source = i;
+    producers[i].next = 0;
+    producers[i].sent.store(0);
+    expected[i] = 0;
+    taskStart(TaskSpec{ "producer", producerStep, &producers[i], 5, -1, 0, 0 });
+  }
+  taskStart(TaskSpec{ "consumer", consumerStep, nullptr, 5, -1, 0, 0 });
+
+  taskStart(TaskSpec{ "gui", guiStep, nullptr, 5, -1, 0, 0 });
+  taskStart(TaskSpec{ "net", netStep, nullptr, 3, -1, 0, 0 });
+
+  taskStart(TaskSpec{ "writer", writerStep, nullptr, 5, -1, 0, 0 });
+  for (uint8_t i = 0; i < READERS - 1; i++) {
+    readers[i].lastVersion = 0;
+    taskStart(TaskSpec{ "reader", readerStep, &readers[i], 2, -1, 0, 0 });
+  }
+
+  // Letzter Leser im Hauptthread, bestimmt die Testdauer
+  Reader &mainReader = readers[READERS - 1];
+  mainReader.lastVersion = 0;
+  const auto until = std::chrono::steady_clock::now() + std::chrono::seconds(seconds);
+  while (std::chrono::steady_clock::now() < until) readerStep(&mainReader);
+
+  taskStopAll();
+  consumerStep(nullptr);   // Rest der Queue einsammeln
+  radioPoll();             // letzte Anforderungen uebernehmen
+
+  // --- Auswertung ---
+  uint32_t sent = 0, pushed = 0;
+  for (uint8_t i = 0; i < PRODUCERS; i++) {
+    sent += producers[i].sent.load();
+    pushed += (uint32_t)producers[i].next;
+  }
+  const uint32_t dropped = inputDroppedCount();
+
+  uint32_t reads = 0, torn = 0, backwards = 0;
+  for (uint8_t i = 0; i < READERS; i++) {
+    reads += readers[i].reads.load();
+    torn += readers[i].torn.load();
+    backwards += readers[i].backwards.load();
+  }
+
+  const bool queueOk = (orderErrors == 0) && (received == pushed) && (pushed + dropped == sent);
+  const bool snapOk = (torn == 0) && (backwards == 0);
+  const RadioParamState rs = radioParamState(0, RADIO_FRQ);
+  const bool radioOk = (guiViewBackwards == 0) && rs.desiredValid && rs.desired == guiFreq;
+
+  printf("queue:    sent=%u received=%u dropped=%u order_errors=%u  %s\n",
+         sent, received, dropped, orderErrors, queueOk ? "OK" : "FEHLER");
+  printf("snapshot: writes=%u reads=%u torn=%u backwards=%u  %s\n",
+         writerCounter, reads, torn, backwards, snapOk ? "OK" : "FEHLER");
+  printf("radio:    requests=%d desired=%d generations=%u view_errors=%u  %s\n",
+         (int)guiFreq, (int)rs.desired, (unsigned)rs.desiredGen, (unsigned)guiViewBackwards,
+         radioOk ? "OK" : "FEHLER");
+
+  radioStop();
+  return (queueOk && snapOk && radioOk) ? 0 : 1;
+}
@@ -0,0 +1,689 @@
+// src/host/web_loopback.cpp
+//
+// Host-Test des Web-Spiegels (PlatformIO-Env "native_web").
+// - GUI wie gui_sim (Software-Display, Encoder/Taster ueber lib/HostSim),
+//   drei Radios nur als Spiegel (Port 0), lib/WebMirror auf 127.0.0.1 (freier Port)
+// - Gegenstelle ist ein kleiner WebSocket-Client in diesem Programm
+//   (blockierende POSIX-Sockets, Rahmen maskiert wie ein Browser)
+// - Fake-Clock (lib/HostSim) folgt der echten Zeit
+//
+// Szenarien:
+//   codec    SHA-1/Base64/Accept-Key gegen die Beispiele aus FIPS 180-1/RFC 4648/RFC 6455
+//   http     Seite, 404/405/400, Verbindung danach geschlossen
+//   ws       Handshake, Listen + voller Stand, danach nur geaenderte Felder
+//   actions  press/rot/long/right/left vom Browser wirken wie Encoder/Taster
+//   local    Eingaben am Panel kommen bei allen Browsern an
+//   radio    Radio-Wechsel im RAD-Screen: Werte des neuen Radios im Delta
+//   limits   mehr als WEB_CLIENTS_MAX Verbindungen, Ping, unmaskierter Rahmen, Close
+//   latency  guiUpdate() ohne und mit 4 Browsern beim Drehen am Panel (p50/p99)
+//
+// Aufruf: .pio/build/native_web/program          Szenarien, Exit-Code 0 = bestanden
+//         .pio/build/native_web/program serve [port=8080]
+//                                                Panel-Simulation fuer einen echten
+//                                                Browser (http://127.0.0.1:8080/), Ctrl-C
+
+#include <Arduino.h>
+#include <HostSim.h>
+
+#include <TFTDisplay.h>
+#include <InputEvents.h>
+#include <RotaryEncoder.h>
+#include <NavButtons.h>
+#include <GUI.h>
+#include <EventLoop.h>
+#include <TimerWheel.h>
+#include <RadioTCP.h>
+#include <RadioTelemetry.h>
+#include <NetMux.h>
+#include <WebMirror.h>
+#include <WebSocket.h>
+
+#include <config.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <signal.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int failures = 0;
+
+static void check(bool ok, const char* what) {
+  printf("  %-52s %s\n", what, ok ? "OK" : "FEHLER");
+  if (!ok) failures++;
+}
+
+// Radios ohne Verbindung (nur Spiegel)
+static const RadioEndpoint SIM_RADIOS[] = {
+  { "R1", "127.0.0.1", 0, 0 },
+  { "R2", "127.0.0.1", 0, 0 },
+  { "R3", "127.0.0.1", 0, 0 },
+};
+
+// Dauer je guiUpdate()/webPoll() (echte Zeit), nur im Szenario latency
+static bool measure = false;
+static std::vector<uint32_t> guiUs;
+static std::vector<uint32_t> webUs;
+
+static void syncClock() {
+  static auto last = std::chrono::steady_clock::now();
+  const auto now = std::chrono::steady_clock::now();
+  const auto us = std::chrono::duration_cast<std::chrono::microseconds>(now - last).count();
+  if (us > 0) {
+    hostAdvanceUs((uint32_t)us);
+    last = now;
+  }
+}
+
+static uint32_t elapsedUs(std::chrono::steady_clock::time_point t0) {
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - t0).count();
+}
+
+/**
+ * @brief Ein Durchlauf wie loop(): Timer, GUI, Radio-Client, ein poll(), Web-Spiegel.
+ */
+static void pass() {
+  syncClock();
+  timerRun(millis());
+
+  auto t0 = std::chrono::steady_clock::now();
+  guiUpdate();
+  if (measure) guiUs.push_back(elapsedUs(t0));
+
+  radioPoll();
+  netMuxPoll();
+
+  t0 = std::chrono::steady_clock::now();
+  webPoll();
+  if (measure) webUs.push_back(elapsedUs(t0));
+}
+
+template <typename Cond>
+static bool runUntil(Cond cond, uint32_t timeoutMs) {
+  const auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+  while (std::chrono::steady_clock::now() < end) {
+    pass();
+    if (cond()) return true;
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+  return cond();
+}
+
+static void runMs(uint32_t ms) {
+  runUntil([] { return false; }, ms);
+}
+
+// --------------------
+// Test-Client
+// --------------------
+
+struct Client {
+  int fd = -1;
+  std::string in;      // empfangen, noch nicht ausgewertet
+  bool closed = false;
+};
+
+static Client connectClient() {
+  Client c;
+  c.fd = socket(AF_INET, SOCK_STREAM, 0);
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(webPort());
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (connect(c.fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) c.closed = true;
+  return c;
+}
+
+static void closeClient(Client &c) {
+  if (c.fd >= 0) close(c.fd);
+  c.fd = -1;
+}
+
+static void sendRaw(Client &c, const std::string &s) {
+  send(c.fd, s.data(), s.size(), MSG_NOSIGNAL);
+}
+
+// Empfangenes abholen (ohne Warten)
+static void drain(Client &c) {
+  char buf[2048];
+  for (;;) {
+    const ssize_t n = recv(c.fd, buf, sizeof(buf), MSG_DONTWAIT);
+    if (n > 0) {
+      c.in.append(buf, (size_t)n);
+      continue;
+    }
+    if (n == 0) c.closed = true;
+    return;
+  }
+}
+
+/**
+ * @brief Auf den HTTP-Kopf warten (bis Leerzeile), Kopf aus c.in entfernen.
+ */
+static bool readHead(Client &c, std::string &head, uint32_t timeoutMs = 500) {
+  const bool ok = runUntil([&] {
+    drain(c);
+    return c.in.find("\r\n\r\n") != std::string::npos;
+  }, timeoutMs);
+  if (!ok) return false;
+  const size_t end = c.in.find("\r\n\r\n") + 4;
+  head = c.in.substr(0, end);
+  c.in.erase(0, end);
+  return true;
+}
+
+/**
+ * @brief Naechsten Server-Rahmen (unmaskiert) aus c.in holen.
+ */
+static bool readFrame(Client &c, uint8_t &opcode, std::string &payload, uint32_t timeoutMs = 500) {
+  auto complete = [&] {
+    if (c.in.size() < 2) return false;
+    size_t len = (uint8_t)c.in[1] & 0x7F, head = 2;
+    if (len == 126) {
+      if (c.in.size() < 4) return false;
+      len = (size_t)(uint8_t)c.in[2] << 8 | (uint8_t)c.in[3];
+      head = 4;
+    }
+    return c.in.size() >= head + len;
+  };
+  if (!runUntil([&] {
+        drain(c);
+        return complete();
+      }, timeoutMs)) {
+    return false;
+  }
+
+  opcode = (uint8_t)c.in[0] & 0x0F;
+  size_t len = (uint8_t)c.in[1] & 0x7F, head = 2;
+  if (len == 126) {
+    len = (size_t)(uint8_t)c.in[2] << 8 | (uint8_t)c.in[3];
+    head = 4;
+  }
+  payload = c.in.substr(head, len);
+  c.in.erase(0, head + len);
+  return true;
+}
+
+static bool readText(Client &c, std::string &msg, uint32_t timeoutMs = 500) {
+  uint8_t op = 0;
+  return readFrame(c, op, msg, timeoutMs) && op == WS_OP_TEXT;
+}
+
+// Rahmen wie ein Browser: FIN, maskiert
+static void sendFrame(Client &c, uint8_t opcode, const std::string &payload, bool masked = true) {
+  std::string f;
+  f += (char)(0x80 | opcode);
+  f += (char)((masked ? 0x80 : 0) | payload.size());
+  const uint8_t mask[4] = { 0x12, 0x34, 0x56, 0x78 };
+  if (masked) f.append((const char*)mask, 4);
+  for (size_t i = 0; i < payload.size(); i++) f += (char)(payload[i] ^ (masked ? mask[i & 3] : 0));
+  sendRaw(c, f);
+}
+
+static const char* const RFC_KEY = "dGhlIHNhbXBsZSBub25jZQ==";
+
+/**
+ * @brief WebSocket oeffnen, Listen + vollen Stand abholen.
+ */
+static bool openSocket(Client &c, std::string* hello = nullptr, std::string* full = nullptr) {
+  c = connectClient();
+  sendRaw(c, std::string("GET /ws HTTP/1.1\r\nHost: panel\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                         "Sec-WebSocket-Key: ") + RFC_KEY + "\r\nSec-WebSocket-Version: 13\r\n\r\n");
+  std::string head, h, f;
+  if (!readHead(c, head) || head.compare(0, 12, "HTTP/1.1 101") != 0) return false;
+  if (!readText(c, h) || !readText(c, f)) return false;
+  if (hello) *hello = h;
+  if (full) *full = f;
+  return true;
+}
+
+// Anzahl Felder in einem Delta ("k":wert)
+static int fieldCount(const std::string &msg) {
+  return (int)std::count(msg.begin(), msg.end(), ':');
+}
+
+// Wert eines Felds im Delta, fallback wenn nicht enthalten
+static long field(const std::string &msg, const char* key, long fallback = -999) {
+  const std::string k = std::string("\"") + key + "\":";
+  const size_t p = msg.find(k);
+  return (p == std::string::npos) ? fallback : strtol(msg.c_str() + p + k.size(), nullptr, 10);
+}
+
+// --------------------
+// Panel-Eingaben (wie gui_sim)
+// --------------------
+
+static void pressPin(uint8_t pin) {
+  hostSetPin(pin, LOW);
+  runMs(80);
+  hostSetPin(pin, HIGH);
+  runMs(80);
+}
+
+static void rotateStep(bool cw, uint32_t stepMs) {
+  const uint8_t first  = cw ? ENC_CLK : ENC_DT;
+  const uint8_t second = cw ? ENC_DT  : ENC_CLK;
+  hostSetPin(first, !hostGetPin(first));
+  runMs(stepMs / 2);
+  hostSetPin(second, !hostGetPin(second));
+  runMs(stepMs / 2);
+}
+
+// --------------------
+// Szenarien
+// --------------------
+
+static void scenarioCodec() {
+  printf("codec\n");
+  uint8_t d[20];
+  wsSha1((const uint8_t*)"abc", 3, d);
+  char hex[41];
+  for (int i = 0; i < 20; i++) snprintf(hex + i * 2, 3, "%02x", d[i]);
+  check(strcmp(hex, "a9993e364706816aba3e25717850c26c9cd0d89d") == 0, "SHA-1(\"abc\")");
+
+  const char* two = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";   // 56 Bytes: zwei Bloecke
+  wsSha1((const uint8_t*)two, strlen(two), d);
+  for (int i = 0; i < 20; i++) snprintf(hex + i * 2, 3, "%02x", d[i]);
+  check(strcmp(hex, "84983e441c3bd26ebaae4aa1f95129e5e54670f1") == 0, "SHA-1 ueber zwei Bloecke");
+
+  char b64[16];
+  wsBase64((const uint8_t*)"foobar", 6, b64);
+  bool ok = strcmp(b64, "Zm9vYmFy") == 0;
+  wsBase64((const uint8_t*)"fooba", 5, b64);
+  ok &= strcmp(b64, "Zm9vYmE=") == 0;
+  wsBase64((const uint8_t*)"foob", 4, b64);
+  ok &= strcmp(b64, "Zm9vYg==") == 0;
+  check(ok, "Base64 mit Auffuellung");
+
+  char accept[WS_ACCEPT_LEN + 1];
+  wsAcceptKey(RFC_KEY, strlen(RFC_KEY), accept);
+  check(strcmp(accept, "s3pPLMBiTxaQ9kYGzzhZRbK+xOo=") == 0, "Sec-WebSocket-Accept (RFC 6455)");
+}
+
+static void scenarioHttp() {
+  printf("http\n");
+  Client c = connectClient();
+  sendRaw(c, "GET / HTTP/1.1\r\nHost: panel\r\n\r\n");
+  std::string head;
+  const bool gotHead = readHead(c, head);
+  const long length = gotHead ? strtol(head.c_str() + head.find("Content-Length: ") + 16, nullptr, 10) : -1;
+  runUntil([&] {
+    drain(c);
+    return c.closed;
+  }, 500);
+  check(gotHead && head.compare(0, 15, "HTTP/1.1 200 OK") == 0 &&
+        head.find("text/html") != std::string::npos, "Seite: 200, text/html");
+  check((long)c.in.size() == length && c.in.find("new WebSocket") != std::string::npos,
+        "ganze Seite (Content-Length) aus dem Flash");
+  check(c.closed, "danach geschlossen");
+  closeClient(c);
+
+  struct {
+    const char* request;
+    const char* status;
+  } const ERRORS[] = {
+    { "GET /nope HTTP/1.1\r\n\r\n", "HTTP/1.1 404" },
+    { "POST / HTTP/1.1\r\nContent-Length: 0\r\n\r\n", "HTTP/1.1 405" },
+    { "GET /ws HTTP/1.1\r\nUpgrade: websocket\r\n\r\n", "HTTP/1.1 400" },
+  };
+  bool all = true;
+  for (const auto &e : ERRORS) {
+    Client x = connectClient();
+    sendRaw(x, e.request);
+    all &= readHead(x, head) && head.compare(0, 12, e.status) == 0;
+    closeClient(x);
+  }
+  check(all, "404 / 405 / 400");
+
+  // Unvollstaendige Anfrage: Platz wird nach request_timeout_ms frei
+  const uint32_t bad = webStats().badRequests;
+  Client slow = connectClient();
+  sendRaw(slow, "GET / HTTP/1.1\r\n");
+  check(runUntil([&] {
+          drain(slow);
+          return slow.closed;
+        }, WEB_CONFIG.request_timeout_ms + 500),
+        "halbe Anfrage nach Zeitueberschreitung geschlossen");
+  check(webStats().badRequests == bad + 1, "als Fehler gezaehlt");
+  closeClient(slow);
+}
+
+static Client main1;
+
+static void scenarioWs() {
+  printf("ws\n");
+  std::string hello, full;
+  check(openSocket(main1, &hello, &full), "Handshake 101, Listen + Stand");
+  check(hello.find("\"mod\":[\"AM\",\"FM\"") != std::string::npos &&
+        hello.find("\"pwr\":[\"LOW\",\"MED\",\"HIGH\"]") != std::string::npos &&
+        hello.find("\"rad\":[\"R1\",\"R2\",\"R3\"]") != std::string::npos, "Listen-Texte");
+
+  GuiState st;
+  guiReadState(st);
+  check(fieldCount(full) == 8 && field(full, "f") == st.freq_hz && field(full, "s") == st.screen &&
+        field(full, "r") == 0, "erstes Delta: alle Felder");
+
+  // Ohne Aenderung kommt nichts
+  std::string msg;
+  check(!readText(main1, msg, 100), "ohne Aenderung kein Delta");
+  printf("  hello=%u Bytes, voller Stand=%u Bytes\n", (unsigned)hello.size(), (unsigned)full.size());
+}
+
+static void scenarioActions() {
+  printf("actions\n");
+  std::string msg;
+  GuiState st;
+
+  sendFrame(main1, WS_OP_TEXT, "press");
+  check(readText(main1, msg) && msg == "{\"e\":1}", "press => {\"e\":1}");
+  check(guiIsEditing(), "Panel im Edit");
+
+  // Cursor auf die kleinste Stelle (1 kHz): 5x weiter
+  for (int i = 0; i < 5; i++) sendFrame(main1, WS_OP_TEXT, "press");
+  runUntil([&] {
+    guiReadState(st);
+    return st.cursor == 5;
+  }, 500);
+  while (readText(main1, msg, 100)) {}
+  check(st.cursor == 5, "Cursor weiter (5x press)");
+
+  const int32_t f0 = st.freq_hz;
+  sendFrame(main1, WS_OP_TEXT, "rot 3");
+  check(runUntil([&] {
+          guiReadState(st);
+          return st.freq_hz == f0 + 3000;
+        }, 500),
+        "rot 3 => +3 kHz am Panel");
+  // Schritte koennen auf mehrere Durchlaeufe verteilt ankommen: letztes Delta zaehlt
+  std::string last;
+  bool onlyFreq = true;
+  while (readText(main1, msg, 100)) {
+    onlyFreq &= fieldCount(msg) == 1 && field(msg, "f") != -999;
+    last = msg;
+  }
+  check(onlyFreq && field(last, "f") == f0 + 3000, "Delta nur mit f, Endwert stimmt");
+
+  sendFrame(main1, WS_OP_TEXT, "rot -1000");   // auf rot_max begrenzt
+  runUntil([&] {
+    guiReadState(st);
+    return st.freq_hz == f0 + 3000 - WEB_CONFIG.rot_max * 1000;
+  }, 500);
+  check(st.freq_hz == f0 + 3000 - WEB_CONFIG.rot_max * 1000, "rot begrenzt auf rot_max Schritte");
+  while (readText(main1, msg, 100)) {}
+
+  sendFrame(main1, WS_OP_TEXT, "long");
+  check(readText(main1, msg) && field(msg, "e") == 0 && field(msg, "c") == 0 && fieldCount(msg) == 2,
+        "long => Edit aus, Cursor 0");
+
+  sendFrame(main1, WS_OP_TEXT, "right");
+  check(readText(main1, msg) && msg == "{\"s\":1}", "right => {\"s\":1}");
+  sendFrame(main1, WS_OP_TEXT, "left");
+  check(readText(main1, msg) && msg == "{\"s\":0}", "left => {\"s\":0}");
+
+  const uint32_t bad = webStats().badRequests;
+  sendFrame(main1, WS_OP_TEXT, "jump");
+  runMs(50);
+  check(webStats().badRequests == bad + 1 && !readText(main1, msg, 50), "unbekannte Aktion ignoriert");
+}
+
+static void scenarioLocal() {
+  printf("local\n");
+  Client others[2];
+  bool ok = true;
+  for (Client &o : others) ok &= openSocket(o);
+  check(ok, "zwei weitere Browser");
+  check(webStats().sockets == 3, "3 WebSockets offen");
+
+  pressPin(BTN_RIGHT);
+  std::string a, b, c;
+  check(readText(main1, a) && readText(others[0], b) && readText(others[1], c) && a == "{\"s\":1}" &&
+        b == a && c == a, "Taster am Panel => Delta an alle");
+
+  pressPin(ENC_SW);   // Edit auf MOD
+  rotateStep(true, 10);
+  rotateStep(true, 10);
+  GuiState st;
+  guiReadState(st);
+  std::string msg, last;
+  while (readText(others[1], msg, 100)) last = msg;
+  check(field(last, "m") == st.modIndex && st.modIndex != 0, "Drehen am Panel => MOD-Index beim Browser");
+
+  pressPin(BTN_LEFT);   // zurueck auf FRQ (Edit endet)
+  for (Client &o : others) closeClient(o);
+  check(runUntil([] { return webStats().sockets == 1; }, 500), "Browser weg => Platz frei");
+  while (readText(main1, msg, 50)) {}
+}
+
+static void scenarioRadio() {
+  printf("radio\n");
+  std::string msg;
+  GuiState st;
+
+  // R1: andere Frequenz als R2 (Edit, 1 kHz-Stelle)
+  sendFrame(main1, WS_OP_TEXT, "left");   // FRQ -> RAD
+  check(readText(main1, msg) && field(msg, "s") == GUI_RAD, "left => RAD-Screen");
+
+  sendFrame(main1, WS_OP_TEXT, "press");
+  sendFrame(main1, WS_OP_TEXT, "right");
+  check(runUntil([&] {
+          guiReadState(st);
+          return st.radio == 1;
+        }, 500),
+        "press + right => Radio 2 aktiv");
+  std::string all;
+  while (readText(main1, msg, 100)) all += msg;
+  check(field(all, "r") == 1, "Delta mit r=1");
+
+  // Radio 2 hat die Default-Werte, Radio 1 die geaenderte Frequenz: f kommt mit
+  sendFrame(main1, WS_OP_TEXT, "left");
+  runUntil([&] {
+    guiReadState(st);
+    return st.radio == 0;
+  }, 500);
+  all.clear();
+  while (readText(main1, msg, 100)) all += msg;
+  check(field(all, "r") == 0 && field(all, "f") == st.freq_hz, "zurueck auf Radio 1 => r + f im Delta");
+
+  sendFrame(main1, WS_OP_TEXT, "press");   // Auswahl beenden
+  sendFrame(main1, WS_OP_TEXT, "right");   // RAD -> FRQ
+  runUntil([&] {
+    guiReadState(st);
+    return st.screen == GUI_FRQ && !st.edit;
+  }, 500);
+  while (readText(main1, msg, 100)) {}
+}
+
+static void scenarioLimits() {
+  printf("limits\n");
+  std::vector<Client> extra(WEB_CLIENTS_MAX - 1);
+  bool ok = true;
+  for (Client &c : extra) ok &= openSocket(c);
+  check(ok && webStats().sockets == WEB_CLIENTS_MAX, "WEB_CLIENTS_MAX WebSockets");
+
+  const uint32_t rejected = webStats().rejected;
+  Client over = connectClient();
+  check(runUntil([&] {
+          drain(over);
+          return over.closed;
+        }, 500) && webStats().rejected == rejected + 1,
+        "eine mehr => abgewiesen");
+  closeClient(over);
+
+  // Ping => Pong mit gleicher Nutzlast
+  uint8_t op = 0;
+  std::string payload;
+  sendFrame(extra[0], WS_OP_PING, "hi");
+  check(readFrame(extra[0], op, payload) && op == WS_OP_PONG && payload == "hi", "Ping => Pong");
+
+  // Unmaskierter Rahmen => Close 1002, Verbindung zu
+  sendFrame(extra[1], WS_OP_TEXT, "press", false);
+  const bool closeFrame = readFrame(extra[1], op, payload) && op == WS_OP_CLOSE && payload.size() == 2 &&
+                          ((uint8_t)payload[0] << 8 | (uint8_t)payload[1]) == 1002;
+  check(closeFrame && runUntil([&] {
+          drain(extra[1]);
+          return extra[1].closed;
+        }, 500),
+        "unmaskiert => Close 1002, geschlossen");
+  GuiState st;
+  guiReadState(st);
+  check(!st.edit, "unmaskierte Aktion nicht ausgefuehrt");
+
+  // Close vom Browser => Close zurueck, Platz frei
+  sendFrame(extra[2], WS_OP_CLOSE, std::string("\x03\xe8", 2));
+  check(readFrame(extra[2], op, payload) && op == WS_OP_CLOSE && runUntil([&] {
+          drain(extra[2]);
+          return extra[2].closed;
+        }, 500),
+        "Close => Close zurueck, geschlossen");
+
+  for (Client &c : extra) closeClient(c);
+  check(runUntil([] { return webStats().sockets == 1; }, 500), "nur noch ein WebSocket");
+}
+
+static uint32_t percentile(std::vector<uint32_t> v, uint32_t pct) {
+  if (v.empty()) return 0;
+  std::sort(v.begin(), v.end());
+  const size_t i = (v.size() * pct + 99) / 100;
+  return v[(i == 0) ? 0 : i - 1];
+}
+
+/**
+ * @brief 200 Rastungen am Panel (5 ms je Rastung), Dauer je guiUpdate()/webPoll() messen.
+ */
+static void measureBurst(const char* label) {
+  guiUs.clear();
+  webUs.clear();
+  measure = true;
+  for (int i = 0; i < 200; i++) rotateStep(i % 2 == 0, 5);
+  runMs(100);
+  measure = false;
+  printf("  %-14s passes=%-6u guiUpdate p50=%u p99=%u us   webPoll p50=%u p99=%u max=%u us\n", label,
+         (unsigned)guiUs.size(), (unsigned)percentile(guiUs, 50), (unsigned)percentile(guiUs, 99),
+         (unsigned)percentile(webUs, 50), (unsigned)percentile(webUs, 99),
+         (unsigned)percentile(webUs, 100));
+}
+
+static void scenarioLatency() {
+  printf("latency\n");
+  std::string msg;
+  pressPin(BTN_RIGHT);   // MOD: Drehen aendert den Index (Deltas auch bei Hin und Her)
+  pressPin(ENC_SW);
+  while (readText(main1, msg, 50)) {}
+
+  closeClient(main1);
+  runUntil([] { return webStats().sockets == 0; }, 500);
+  measureBurst("ohne Browser");
+  const uint32_t p50Without = percentile(guiUs, 50);
+
+  std::vector<Client> browsers(WEB_CLIENTS_MAX);
+  for (Client &c : browsers) openSocket(c);
+  const uint32_t deltas = webStats().deltas;
+  measureBurst("4 Browser");
+  const uint32_t p50With = percentile(guiUs, 50);
+
+  GuiState st;
+  guiReadState(st);
+  bool synced = true;
+  for (Client &c : browsers) {
+    std::string last;
+    while (readText(c, msg, 50)) last = msg;
+    synced &= field(last, "m") == st.modIndex || last.empty();
+  }
+  const uint32_t pushed = webStats().deltas - deltas;
+  printf("  %u Deltas, %u Bytes gesamt, verschoben=%u\n", (unsigned)pushed, (unsigned)webStats().deltaBytes,
+         (unsigned)webStats().deferred);
+  check(pushed >= WEB_CLIENTS_MAX * 100 && synced, "jede Aenderung bei allen Browsern");
+  check(p50With <= p50Without * 2 + 20, "guiUpdate() p50 mit Browsern unveraendert");
+  for (Client &c : browsers) closeClient(c);
+}
+
+// --------------------
+// Ablauf
+// --------------------
+
+static std::atomic<bool> stopRequested(false);
+
+static void onSignal(int) {
+  stopRequested.store(true);
+}
+
+static void serve() {
+  printf("Web-Spiegel: http://127.0.0.1:%u/  (Ctrl-C beendet)\n", (unsigned)webPort());
+  fflush(stdout);
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+  while (!stopRequested.load()) {
+    pass();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  const WebStats s = webStats();
+  printf("accepts=%u pages=%u upgrades=%u actions=%u deltas=%u\n", (unsigned)s.accepts, (unsigned)s.pages,
+         (unsigned)s.upgrades, (unsigned)s.actions, (unsigned)s.deltas);
+}
+
+int main(int argc, char** argv) {
+  bool serveMode = false;
+  uint16_t port = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "serve") == 0) {
+      serveMode = true;
+      if (port == 0) port = 8080;
+    } else if (strncmp(argv[i], "port=", 5) == 0) {
+      port = (uint16_t)strtoul(argv[i] + 5, nullptr, 10);
+    } else {
+      fprintf(stderr, "unbekannte Option: %s\n", argv[i]);
+      return 2;
+    }
+  }
+
+  hostSimReset();
+  eventLoopInit();
+  timerWheelInit(millis());
+
+  initDisplay();
+  inputQueueInit();
+  initRotaryEncoder();
+  initNavButtons();
+  radioInit(SIM_RADIOS, 3);
+  guiInit();
+
+  if (!webInit(port)) {
+    fprintf(stderr, "web: Port %u nicht verfuegbar\n", (unsigned)port);
+    return 1;
+  }
+
+  if (serveMode) {
+    serve();
+  } else {
+    scenarioCodec();
+    scenarioHttp();
+    scenarioWs();
+    scenarioActions();
+    scenarioLocal();
+    scenarioRadio();
+    scenarioLimits();
+    scenarioLatency();
+
+    const WebStats s = webStats();
+    printf("accepts=%u rejected=%u pages=%u upgrades=%u bad=%u stalled=%u actions=%u events=%u dropped=%u deltas=%u\n",
+           (unsigned)s.accepts, (unsigned)s.rejected, (unsigned)s.pages, (unsigned)s.upgrades,
+           (unsigned)s.badRequests, (unsigned)s.stalled, (unsigned)s.actions, (unsigned)s.events,
+           (unsigned)s.dropped, (unsigned)s.deltas);
+    printf(failures ? "FEHLER: %d\n" : "alles OK\n", failures);
+  }
+
+  webStop();
+  radioStop();
+  return failures ? 1 : 0;
+}
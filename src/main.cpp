@@ -1,37 +1,186 @@
 // src/main.cpp
 //
 // Entry point des Projekts.
-// - Initialisiert Hardware-Module (Display, Encoder, Nav-Buttons)
+// - Initialisiert Hardware-Module (Display, Encoder, Nav-Buttons, Ethernet)
+// - Radio-Client (lib/RadioTCP) sendet FRQ/MOD/PWR-Änderungen der GUI an das
+//   aktive Radio, Telemetrie (lib/RadioTelemetry) liefert S-Meter/SWR/FWD für die
+//   Balken; alle Radios aus RADIO_LIST bleiben verbunden, ihre Sockets fragt
+//   ein gemeinsamer poll() ab (lib/NetMux)
 // - Startet danach die GUI-State-Machine
-// - Loop ruft nur guiUpdate() auf (GUI kümmert sich um Input + Rendering)
+// - Web-Spiegel (lib/WebMirror, include/web_config.h): Browser sehen den
+//   Bedienstand als Deltas und bedienen das Panel wie Encoder/Taster; die
+//   Sockets haengen im selben poll() (lib/NetMux)
+// - Loop ruft nur guiUpdate() auf (GUI kümmert sich um Input + Rendering) und
+//   ruht danach bis zum nächsten Ereignis oder zur nächsten Deadline (EventLoop)
+// - Mit GUI_TASKS (config.h) laufen Input, Rendering und Netzwerk stattdessen in
+//   drei FreeRTOS-Tasks (Input auf Kern 0, Render und Netz auf Kern 1), loop() bleibt leer
 
 #include <Arduino.h>
+#include <ETH.h>
 
 #include <TFTDisplay.h>
+#include <InputEvents.h>
 #include <RotaryEncoder.h>
 #include <NavButtons.h>
 #include <GUI.h>
+#include <LatencyTrace.h>
+#include <TaskRuntime.h>
+#include <EventLoop.h>
+#include <TimerWheel.h>
+#include <RadioTCP.h>
+#include <RadioTelemetry.h>
+#include <NetMux.h>
+#include <WebMirror.h>
+
+#include <config.h>
+#include <radio_config.h>
+#include <web_config.h>
+
+/**
+ * @brief Diagnose ueber Serial: 'l' = Latenz-Histogramme und Eingabe-Zaehler
+ *        ausgeben, 'r' = Histogramme zuruecksetzen.
+ *        Laeuft im selben Kontext wie das Rendering (schreibt die Histogramme).
+ */
+static void pollDiagnostics() {
+  if (!Serial.available()) return;
+
+  const int c = Serial.read();
+  if (c == 'l') {
+    latencyDump();
+    Serial.printf("encoder invalid %lu dropped %lu, input dropped %lu\n",
+                  (unsigned long)getEncoderInvalidCount(),
+                  (unsigned long)getEncoderDroppedCount(),
+                  (unsigned long)inputDroppedCount());
+  } else if (c == 'r') {
+    latencyReset();
+  }
+}
+
+/**
+ * @brief Netzwerk-Events (Event-Task des Arduino-Cores): Radio-Client nur
+ *        mit Link und IP verbinden lassen, sonst ruhen statt ins Leere zu versuchen.
+ */
+static void onNetworkEvent(arduino_event_id_t event) {
+  switch (event) {
+    case ARDUINO_EVENT_ETH_GOT_IP:
+      radioNetworkUp(true);
+      telemetryNetworkUp(true);
+      break;
+    case ARDUINO_EVENT_ETH_DISCONNECTED:
+    case ARDUINO_EVENT_ETH_STOP:
+      radioNetworkUp(false);
+      telemetryNetworkUp(false);
+      break;
+    default:
+      break;
+  }
+}
+
+#if GUI_TASKS
+// Timer des Radio-Clients und der Telemetrie (gehoert dem Netz-Task)
+static TimerWheel netWheel;
+
+// Besitzt das Standard-Timer-Rad (Toast, Entprellung, Long-Press)
+static void inputTask(void*) {
+  timerRun(millis());
+  guiPollInput();
+}
+
+// Besitzt Radio-Client, Telemetrie, Web-Spiegel und alle Sockets (NetMux)
+static void netTask(void*) {
+  timerRun(netWheel, millis());
+  radioPoll();
+  telemetryPoll();
+  netMuxPoll();
+  webPoll();
+}
+
+static void renderTask(void*) {
+  guiRender();
+  pollDiagnostics();
+}
+#endif
 
 void setup() {
   // Optional: Debug-Ausgaben
   Serial.begin(115200);
   delay(200);
 
+  // Vor den Input-Modulen: deren ISRs wecken die Hauptschleife, Deadlines sind Timer
+  eventLoopInit();
+  timerWheelInit(millis());
+
   // Display initialisieren (Rotation/Grundsetup erfolgt im TFTDisplay-Modul)
   initDisplay();
 
   // Optionaler Power-On-Selbsttest (IBIT/Screen-Test) – kann später entfernt/angepasst werden
   //runBit();
 
-  // Input-Module initialisieren
+  // Input-Module initialisieren (gemeinsame Event-Queue zuerst)
+  inputQueueInit();
   initRotaryEncoder();
   initNavButtons();
 
+  // Ethernet (DHCP läuft im Hintergrund); der Radio-Client verbindet sich,
+  // sobald das Radio erreichbar ist, und versucht es sonst mit wachsendem Abstand
+  // erneut. Link weg/IP da kommt per Event und stoppt bzw. startet die Versuche.
+  WiFi.onEvent(onNetworkEvent);
+  ETH.begin(LAN_PHY_ADDR, LAN_PHY_POWER, LAN_PHY_MDC, LAN_PHY_MDIO, ETH_PHY_LAN8720, ETH_CLOCK_GPIO0_IN);
+#if GUI_TASKS
+  timerWheelInit(netWheel, millis());
+  timerWheelSelect(&netWheel);
+#endif
+  radioInit(RADIO_LIST, (uint8_t)RADIO_COUNT);
+  telemetryInit(RADIO_LIST, (uint8_t)RADIO_COUNT);
+  timerWheelSelect(nullptr);
+
   // GUI initialisieren (zieht Theme/Limits/Listen/Defaults aus include/gui_config.h)
   guiInit();
+
+  // Web-Spiegel: liest nur den veröffentlichten GUI-Stand, Aktionen gehen in die Input-Queue.
+  // Standardmäßig aus (WEB_CONFIG.port = 0), da er den Light Sleep sperrt
+  if (WEB_CONFIG.port != 0) webInit(WEB_CONFIG.port);
+
+#if GUI_TASKS
+  // Ab hier gehört TFTDisplay dem Render-Task, Encoder/Taster dem Input-Task,
+  // Radio-Client/Telemetrie/Web-Spiegel dem Netz-Task
+  taskStart(TaskSpec{ "input", inputTask, nullptr, TASK_INPUT_PRIO, TASK_INPUT_CORE,
+                      TASK_INPUT_STACK, TASK_INPUT_PERIOD_MS });
+  taskStart(TaskSpec{ "render", renderTask, nullptr, TASK_RENDER_PRIO, TASK_RENDER_CORE,
+                      TASK_RENDER_STACK, TASK_RENDER_PERIOD_MS });
+  taskStart(TaskSpec{ "net", netTask, nullptr, TASK_NET_PRIO, TASK_NET_CORE,
+                      TASK_NET_STACK, TASK_NET_PERIOD_MS });
+#endif
 }
 
 void loop() {
-  // GUI verarbeitet Eingaben + aktualisiert Anzeige nur bei Bedarf
+#if GUI_TASKS
+  // Arbeit liegt in den Tasks
+  delay(1000);
+#else
+  // Faellige Timer (Toast-Ende, Entprell-Tick, Long-Press), dann GUI: verarbeitet
+  // Eingaben + aktualisiert Anzeige nur bei Bedarf. Danach neue Sollwerte senden
+  // und alle Sockets (Quittungen, Telemetrie, Verbindungsaufbau, Browser) in einem
+  // poll(); zuletzt geaenderten Bedienstand an die Browser
+  timerRun(millis());
+  telemetryPoll();
   guiUpdate();
+  radioPoll();
+  netMuxPoll();
+  webPoll();
+  pollDiagnostics();
+
+  // Ruhen bis Encoder/Taster-Interrupt, naechsten Timer, Frame oder Socket-Abfrage
+  // (Kommandos unterwegs bzw. Telemetrie-Strom verbunden). Light Sleep sperren Radio-Client und
+  // Telemetrie bei offener Verbindung. Im Light Sleep laufen Encoder- und Taster-ISR
+  // nicht => Zustand danach neu einlesen (der weckende Druck startet die Entprellung).
+  uint32_t timeout = eventDeadlineMin(guiIdleUs(), timerIdleUs(millis(), micros()));
+  timeout = eventDeadlineMin(timeout, radioIdleUs());
+  timeout = eventDeadlineMin(timeout, telemetryIdleUs());
+  timeout = eventDeadlineMin(timeout, webIdleUs());
+  if (eventLoopIdle(timeout) == EVENT_IDLE_SLEEP) {
+    resyncRotaryEncoder();
+    resyncNavButtons();
+  }
+#endif
 }
@@ -0,0 +1,20 @@
+// src/radio_config.cpp
+//
+// Zentraler Ort für die Definition der Radio-Konfiguration
+// (Deklaration und Default-Werte in include/radio_config.h, wie gui_config).
+
+#include <radio_config.h>
+
+// ---------------------------
+// Radios (Liste)
+// ---------------------------
+// Hinweis: Reihenfolge entspricht der Auswahl im Radio-Screen, der erste
+// Eintrag ist nach dem Start aktiv. Hoechstens RADIO_MAX Eintraege.
+const RadioEndpoint RADIO_LIST[] = {
+  { "R1", "192.168.1.50", 5025, 5026 },
+  { "R2", "192.168.1.51", 5025, 5026 },
+};
+const int RADIO_COUNT = sizeof(RADIO_LIST) / sizeof(RADIO_LIST[0]);
+static_assert(sizeof(RADIO_LIST) / sizeof(RADIO_LIST[0]) <= RADIO_MAX, "RADIO_LIST: mehr als RADIO_MAX Radios");
+
+const RadioConfig RADIO_CONFIG{};
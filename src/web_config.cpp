@@ -0,0 +1,8 @@
+// src/web_config.cpp
+//
+// Zentraler Ort für die Definition der Web-Konfiguration
+// (Deklaration und Default-Werte in include/web_config.h, wie radio_config).
+
+#include <web_config.h>
+
+const WebConfig WEB_CONFIG{};
@@ -0,0 +1,195 @@
+// test/test_debouncer/test_main.cpp
+//
+// Host-Test der Tasterbank (lib/NavButtons/Debouncer.h) mit prellenden
+// Pegelwoertern: vertikaler 2-Bit-Zaehler, Short-/Long-Press, mehrere Tasten
+// in beiden GPIO-Registern gleichzeitig.
+//
+// Aufruf: pio test -e native_test -f test_debouncer
+
+#include <unity.h>
+
+#include <Debouncer.h>
+
+// Pins wie auf dem Board: ENC_SW (GPIO 35, oberes Register), BTN_LEFT (5), BTN_RIGHT (17)
+typedef DebouncerBank<35, 5, 17> Bank;
+
+static const uint64_t IDLE = ~0ULL;   // INPUT_PULLUP: nichts gedrueckt = alles HIGH
+static const uint32_t KEY_ENC = 1u << 0;
+static const uint32_t KEY_LEFT = 1u << 1;
+static const uint32_t KEY_RIGHT = 1u << 2;
+
+static Bank bank;
+static uint32_t nowMs;
+static uint32_t presses;
+static uint32_t longPresses;
+
+static uint64_t low(uint64_t levels, uint8_t pin) {
+  return levels & ~(1ULL << pin);
+}
+
+void setUp() {
+  nowMs = 1000;
+  presses = 0;
+  longPresses = 0;
+  debouncerInit(bank, IDLE, nowMs);
+}
+
+void tearDown() {}
+
+// Ein Tick im Raster, Ereignisse aufsammeln
+static DebounceEvents tick(uint64_t levels) {
+  nowMs += DEBOUNCE_TICK_MS;
+  const DebounceEvents ev = debouncerUpdate(bank, levels, nowMs);
+  presses |= ev.press;
+  longPresses |= ev.longPress;
+  return ev;
+}
+
+static void ticks(uint64_t levels, uint16_t n) {
+  for (uint16_t i = 0; i < n; i++) tick(levels);
+}
+
+static void test_stable_after_samples() {
+  const uint64_t pressed = low(IDLE, 5);
+  for (uint8_t i = 1; i < DEBOUNCE_SAMPLES; i++) {
+    tick(pressed);
+    TEST_ASSERT_EQUAL_HEX32(0, bank.down);
+    TEST_ASSERT_TRUE(debouncerBusy(bank));
+  }
+  tick(pressed);
+  TEST_ASSERT_EQUAL_HEX32(KEY_LEFT, bank.down);
+  TEST_ASSERT_FALSE(debouncerBusy(bank));
+}
+
+static void test_bounce_never_toggles() {
+  // Abwechselnd gedrueckt/offen: Zaehler faellt jedes Mal auf 0 zurueck
+  const uint64_t pressed = low(IDLE, 17);
+  for (uint8_t i = 0; i < 40; i++) tick((i & 1) ? IDLE : pressed);
+  TEST_ASSERT_EQUAL_HEX32(0, bank.down);
+
+  // 3 gedrueckt, 1 offen, wieder 3: reicht auch nicht
+  for (uint8_t r = 0; r < 5; r++) {
+    ticks(pressed, DEBOUNCE_SAMPLES - 1);
+    tick(IDLE);
+  }
+  TEST_ASSERT_EQUAL_HEX32(0, bank.down);
+  TEST_ASSERT_EQUAL_HEX32(0, presses);
+}
+
+static void test_bouncing_press_and_release_is_one_short_press() {
+  const uint64_t pressed = low(IDLE, 35);
+
+  // Druck prellt, dann stabil
+  const uint64_t bounceDown[6] = { pressed, IDLE, pressed, IDLE, IDLE, pressed };
+  for (uint64_t lv : bounceDown) tick(lv);
+  ticks(pressed, 10);
+  TEST_ASSERT_EQUAL_HEX32(KEY_ENC, bank.down);
+  TEST_ASSERT_EQUAL_HEX32(0, presses);   // Short erst beim Loslassen
+
+  // Loslassen prellt ebenfalls
+  const uint64_t bounceUp[5] = { IDLE, pressed, IDLE, pressed, IDLE };
+  for (uint64_t lv : bounceUp) tick(lv);
+  ticks(IDLE, DEBOUNCE_SAMPLES);
+  TEST_ASSERT_EQUAL_HEX32(0, bank.down);
+  TEST_ASSERT_EQUAL_HEX32(KEY_ENC, presses);
+  TEST_ASSERT_EQUAL_HEX32(0, longPresses);
+}
+
+static void test_long_press_once_without_short() {
+  const uint64_t pressed = low(IDLE, 5);
+  ticks(pressed, DEBOUNCE_SAMPLES);
+  const uint32_t downAt = nowMs;
+
+  // Vor Ablauf kein Long, Restzeit fuer den Timer stimmt
+  TEST_ASSERT_EQUAL_UINT32(DEBOUNCE_LONGPRESS_MS, debouncerLongPressDueMs(bank, downAt));
+  while (nowMs + DEBOUNCE_TICK_MS - downAt < DEBOUNCE_LONGPRESS_MS) {
+    tick(pressed);
+    TEST_ASSERT_EQUAL_HEX32(0, longPresses);
+  }
+
+  // Genau einmal, auch wenn weiter gehalten wird
+  const DebounceEvents ev = tick(pressed);
+  TEST_ASSERT_EQUAL_HEX32(KEY_LEFT, ev.longPress);
+  ticks(pressed, 100);
+  TEST_ASSERT_EQUAL_HEX32(0, tick(pressed).longPress);
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFUL, debouncerLongPressDueMs(bank, nowMs));
+
+  // Loslassen nach Long: kein Short
+  ticks(IDLE, DEBOUNCE_SAMPLES);
+  TEST_ASSERT_EQUAL_HEX32(0, presses);
+  TEST_ASSERT_EQUAL_HEX32(KEY_LEFT, longPresses);
+
+  // Naechster kurzer Druck ist wieder ein Short
+  ticks(pressed, DEBOUNCE_SAMPLES);
+  ticks(IDLE, DEBOUNCE_SAMPLES);
+  TEST_ASSERT_EQUAL_HEX32(KEY_LEFT, presses);
+}
+
+static void test_keys_in_both_registers_independent() {
+  // ENC_SW (GPIO 35) und BTN_RIGHT (GPIO 17) gleichzeitig, BTN_RIGHT prellt laenger
+  const uint64_t both = low(low(IDLE, 35), 17);
+  const uint64_t encOnly = low(IDLE, 35);
+
+  tick(both);
+  tick(encOnly);
+  tick(both);
+  tick(both);
+  tick(both);
+  TEST_ASSERT_EQUAL_HEX32(KEY_ENC, bank.down);   // ENC: 5 Ticks gedrueckt, RIGHT: erst 3 in Folge
+  tick(both);
+  TEST_ASSERT_EQUAL_HEX32(KEY_ENC | KEY_RIGHT, bank.down);
+
+  // Nur ENC loslassen
+  ticks(low(IDLE, 17), DEBOUNCE_SAMPLES);
+  TEST_ASSERT_EQUAL_HEX32(KEY_ENC, presses);
+  TEST_ASSERT_EQUAL_HEX32(KEY_RIGHT, bank.down);
+
+  ticks(IDLE, DEBOUNCE_SAMPLES);
+  TEST_ASSERT_EQUAL_HEX32(KEY_ENC | KEY_RIGHT, presses);
+}
+
+static void test_other_pins_ignored() {
+  // Fremde Pins (0, 16, 34, 63) wackeln, Bank bleibt ruhig
+  uint64_t noise = IDLE;
+  for (uint8_t i = 0; i < 30; i++) {
+    noise ^= (1ULL << 0) | (1ULL << 16) | (1ULL << 34) | (1ULL << 63);
+    tick(noise);
+  }
+  TEST_ASSERT_EQUAL_HEX32(0, bank.down);
+  TEST_ASSERT_FALSE(debouncerBusy(bank));
+  TEST_ASSERT_EQUAL_HEX32(0, presses);
+}
+
+static void test_pressed_at_init_no_event() {
+  // Beim Start gehaltene Taste: weder Long noch Short
+  debouncerInit(bank, low(IDLE, 17), nowMs);
+  TEST_ASSERT_EQUAL_HEX32(KEY_RIGHT, bank.down);
+
+  ticks(low(IDLE, 17), DEBOUNCE_LONGPRESS_MS / DEBOUNCE_TICK_MS + 5);
+  ticks(IDLE, DEBOUNCE_SAMPLES);
+  TEST_ASSERT_EQUAL_HEX32(0, bank.down);
+  TEST_ASSERT_EQUAL_HEX32(0, presses);
+  TEST_ASSERT_EQUAL_HEX32(0, longPresses);
+}
+
+static void test_tick_due() {
+  TEST_ASSERT_FALSE(debouncerTickDue(bank, nowMs + DEBOUNCE_TICK_MS - 1));
+  TEST_ASSERT_TRUE(debouncerTickDue(bank, nowMs + DEBOUNCE_TICK_MS));
+
+  // millis()-Ueberlauf
+  debouncerInit(bank, IDLE, 0xFFFFFFFCu);
+  TEST_ASSERT_TRUE(debouncerTickDue(bank, 0xFFFFFFFCu + DEBOUNCE_TICK_MS));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_stable_after_samples);
+  RUN_TEST(test_bounce_never_toggles);
+  RUN_TEST(test_bouncing_press_and_release_is_one_short_press);
+  RUN_TEST(test_long_press_once_without_short);
+  RUN_TEST(test_keys_in_both_registers_independent);
+  RUN_TEST(test_other_pins_ignored);
+  RUN_TEST(test_pressed_at_init_no_event);
+  RUN_TEST(test_tick_due);
+  return UNITY_END();
+}
@@ -0,0 +1,214 @@
+// test/test_flush_queue/test_main.cpp
+//
+// Host-Test der Flush-Queue (lib/TFTDisplay/TFTFlushQueue) ueber den
+// DMA-Stand-in (TFTFlushHost). Die "Hardware" meldet Baender nur fertig, wenn
+// der Test tftFlushHostComplete() aufruft; so lassen sich Ping-Pong-Reihenfolge,
+// voller Transport, Busy und Abschluss Schritt fuer Schritt pruefen.
+//
+// Aufruf: pio test -e native_test -f test_flush_queue
+
+#include <unity.h>
+
+#include <TFTFlushQueue.h>
+#include <TFTFlushHost.h>
+
+#include <string.h>
+
+static const int16_t W = 160;
+static const int16_t H = 128;
+static const uint32_t BAND_PX = W * 4;   // 4 volle Zeilen je Band
+
+static uint16_t fb[H][W];        // Quelle (Framebuffer)
+static uint16_t panel[H][W];     // Ziel (was beim "Display" ankommt)
+static uint16_t buf0[BAND_PX];
+static uint16_t buf1[BAND_PX];
+
+// Transport-Huelle um den Stand-in: Slots mitschreiben, "voll" nachstellen
+static TftFlushTransport host;
+static bool refuse = false;
+static uint8_t startedSlots[64];
+static uint8_t startedCount = 0;
+
+// Reihenfolge der fertig gemeldeten Baender (Startzeile)
+static int16_t doneRows[64];
+static uint8_t doneCount = 0;
+
+static void readRow(int16_t x, int16_t y, int16_t w, uint16_t* out) {
+  memcpy(out, &fb[y][x], (size_t)w * 2);
+}
+
+static bool recordStart(void* ctx, uint8_t slot, int16_t x, int16_t y, int16_t w, int16_t h,
+                        const uint16_t* px, uint32_t count) {
+  if (refuse) return false;
+  if (!host.start(ctx, slot, x, y, w, h, px, count)) return false;
+  if (startedCount < sizeof(startedSlots)) startedSlots[startedCount++] = slot;
+  return true;
+}
+
+static uint8_t recordCollect(void* ctx) {
+  return host.collect(ctx);
+}
+
+static void bandDone(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* px, uint32_t count) {
+  TEST_ASSERT_EQUAL_UINT32((uint32_t)w * h, count);
+  if (doneCount < sizeof(doneRows) / sizeof(doneRows[0])) doneRows[doneCount++] = y;
+
+  // Staging-Puffer liegt in Display-Bytefolge (big endian)
+  for (int16_t r = 0; r < h; r++) {
+    for (int16_t c = 0; c < w; c++) {
+      const uint16_t v = px[r * w + c];
+      panel[y + r][x + c] = (uint16_t)((v << 8) | (v >> 8));
+    }
+  }
+}
+
+void setUp() {
+  for (int16_t y = 0; y < H; y++) {
+    for (int16_t x = 0; x < W; x++) fb[y][x] = (uint16_t)(y * W + x);
+  }
+  memset(panel, 0, sizeof(panel));
+  refuse = false;
+  startedCount = 0;
+  doneCount = 0;
+
+  host = tftFlushHostTransport();
+  TftFlushTransport t;
+  t.start = recordStart;
+  t.collect = recordCollect;
+  t.ctx = nullptr;
+
+  tftFlushHostSetSink(bandDone);
+  tftFlushQueueInit(buf0, buf1, BAND_PX, readRow, t);
+}
+
+void tearDown() {}
+
+// Alle laufenden Baender einzeln fertig melden, bis die Queue leer ist
+static uint16_t completeAll() {
+  uint16_t polls = 0;
+  while (tftFlushQueueBusy()) {
+    tftFlushHostComplete(1);
+    if (++polls > 1000) break;
+  }
+  return polls;
+}
+
+static bool panelMatches(const TftRect &r) {
+  for (int16_t y = r.y0; y <= r.y1; y++) {
+    for (int16_t x = r.x0; x <= r.x1; x++) {
+      if (panel[y][x] != fb[y][x]) return false;
+    }
+  }
+  return true;
+}
+
+static void test_ping_pong_order() {
+  const TftRect r = { 0, 0, W - 1, 31 };   // 32 Zeilen => 8 Baender
+  TEST_ASSERT_TRUE(tftFlushQueueSubmit(&r, 1));
+
+  // Beide Puffer sofort unterwegs, nicht mehr
+  TEST_ASSERT_EQUAL_UINT8(2, tftFlushHostPending());
+  TEST_ASSERT_EQUAL_UINT8(0, startedSlots[0]);
+  TEST_ASSERT_EQUAL_UINT8(1, startedSlots[1]);
+
+  completeAll();
+
+  TEST_ASSERT_EQUAL_UINT32(8, tftFlushQueueBandsStarted());
+  TEST_ASSERT_EQUAL_UINT8(8, startedCount);
+  for (uint8_t i = 0; i < startedCount; i++) TEST_ASSERT_EQUAL_UINT8(i & 1, startedSlots[i]);
+
+  // Fertig in Startreihenfolge, Zeilen aufsteigend
+  TEST_ASSERT_EQUAL_UINT8(8, doneCount);
+  for (uint8_t i = 0; i < doneCount; i++) TEST_ASSERT_EQUAL_INT(i * 4, doneRows[i]);
+  TEST_ASSERT_TRUE(panelMatches(r));
+}
+
+static void test_band_reuses_slot_only_after_completion() {
+  const TftRect r = { 0, 0, W - 1, 31 };
+  TEST_ASSERT_TRUE(tftFlushQueueSubmit(&r, 1));
+
+  // Ohne Fertigmeldung startet nichts Neues (beide Puffer belegt)
+  for (int i = 0; i < 5; i++) TEST_ASSERT_TRUE(tftFlushQueueBusy());
+  TEST_ASSERT_EQUAL_UINT8(2, startedCount);
+
+  // Ein Band fertig => genau ein neues, im frei gewordenen Puffer 0
+  tftFlushHostComplete(1);
+  TEST_ASSERT_TRUE(tftFlushQueueBusy());
+  TEST_ASSERT_EQUAL_UINT8(3, startedCount);
+  TEST_ASSERT_EQUAL_UINT8(0, startedSlots[2]);
+  TEST_ASSERT_EQUAL_UINT8(2, tftFlushHostPending());
+}
+
+static void test_submit_rejected_while_busy() {
+  const TftRect a = { 0, 0, W - 1, 15 };
+  const TftRect b = { 0, 64, W - 1, 79 };
+  TEST_ASSERT_TRUE(tftFlushQueueSubmit(&a, 1));
+  TEST_ASSERT_FALSE(tftFlushQueueSubmit(&b, 1));
+
+  completeAll();
+  TEST_ASSERT_TRUE(panelMatches(a));
+  TEST_ASSERT_EQUAL_UINT16(0, panel[64][0]);   // b wurde nicht uebernommen
+
+  TEST_ASSERT_TRUE(tftFlushQueueSubmit(&b, 1));
+  completeAll();
+  TEST_ASSERT_TRUE(panelMatches(b));
+}
+
+static void test_transport_full_retries() {
+  const TftRect r = { 8, 10, 40, 29 };
+  refuse = true;
+
+  // Uebernommen, aber der Transport nimmt nichts an
+  TEST_ASSERT_TRUE(tftFlushQueueSubmit(&r, 1));
+  TEST_ASSERT_TRUE(tftFlushQueueBusy());
+  TEST_ASSERT_TRUE(tftFlushQueueBusy());
+  TEST_ASSERT_EQUAL_UINT32(0, tftFlushQueueBandsStarted());
+  TEST_ASSERT_EQUAL_UINT8(0, tftFlushHostPending());
+
+  // Zwischenzeitlich geaenderte Pixel werden beim neuen Versuch frisch gelesen
+  fb[10][8] = 0xBEEF;
+  refuse = false;
+  TEST_ASSERT_TRUE(tftFlushQueueBusy());
+  TEST_ASSERT_EQUAL_UINT8(2, tftFlushHostPending());
+
+  completeAll();
+  TEST_ASSERT_TRUE(panelMatches(r));
+  TEST_ASSERT_EQUAL_HEX16(0xBEEF, panel[10][8]);
+}
+
+static void test_completion() {
+  const TftRect rects[2] = {
+    { 0, 0, W - 1, 5 },     // 6 Zeilen => 2 Baender (4 + 2)
+    { 10, 50, 20, 100 },    // 11 Pixel breit => 58 Zeilen je Band => 1 Band
+  };
+  TEST_ASSERT_TRUE(tftFlushQueueSubmit(rects, 2));
+
+  // Busy bis zur letzten Fertigmeldung
+  tftFlushHostComplete(2);
+  TEST_ASSERT_TRUE(tftFlushQueueBusy());
+  tftFlushHostComplete(1);
+  TEST_ASSERT_FALSE(tftFlushQueueBusy());
+
+  TEST_ASSERT_EQUAL_UINT32(3, tftFlushQueueBandsStarted());
+  TEST_ASSERT_TRUE(panelMatches(rects[0]));
+  TEST_ASSERT_TRUE(panelMatches(rects[1]));
+  TEST_ASSERT_EQUAL_UINT16(0, panel[50][9]);    // ausserhalb der Rechtecke
+  TEST_ASSERT_EQUAL_UINT16(0, panel[101][10]);
+}
+
+static void test_empty_submit_not_busy() {
+  TEST_ASSERT_TRUE(tftFlushQueueSubmit(nullptr, 0));
+  TEST_ASSERT_FALSE(tftFlushQueueBusy());
+  TEST_ASSERT_EQUAL_UINT8(0, tftFlushHostPending());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_ping_pong_order);
+  RUN_TEST(test_band_reuses_slot_only_after_completion);
+  RUN_TEST(test_submit_rejected_while_busy);
+  RUN_TEST(test_transport_full_retries);
+  RUN_TEST(test_completion);
+  RUN_TEST(test_empty_submit_not_busy);
+  return UNITY_END();
+}
@@ -0,0 +1,168 @@
+// test/test_quad_decoder/test_main.cpp
+//
+// Host-Test des Encoder-Decoders (lib/RotaryEncoder): synthetische
+// Quadratur-Flankenfolgen fuer die Tabelle in QuadDecoder.h und der
+// SPSC-Ring aus StepRing.h (Reihenfolge, voll, Ueberlauf der Zaehler).
+//
+// Aufruf: pio test -e native_test -f test_quad_decoder
+
+#include <unity.h>
+
+#include <QuadDecoder.h>
+#include <StepRing.h>
+
+// Zustaende (A<<1 | B) einer vollen Periode im Uhrzeigersinn, Start 11
+static const uint8_t CW[4] = { 0x1, 0x0, 0x2, 0x3 };
+static const uint8_t CCW[4] = { 0x2, 0x0, 0x1, 0x3 };
+
+static QuadDecoder dec;
+static StepRing ring;
+
+void setUp() {
+  quadDecoderInit(dec, 0x3);
+  stepRingInit(ring);
+}
+
+void tearDown() {}
+
+// Folge einspeisen, Summe der gemeldeten Schritte
+static int feed(const uint8_t* states, uint8_t n, uint8_t periods = 1) {
+  int sum = 0;
+  for (uint8_t p = 0; p < periods; p++) {
+    for (uint8_t i = 0; i < n; i++) sum += quadDecoderFeed(dec, states[i]);
+  }
+  return sum;
+}
+
+static void test_cw_periods() {
+  // 2 Viertelschritte je Schritt => 2 Schritte je Periode
+  TEST_ASSERT_EQUAL_INT(20, feed(CW, 4, 10));
+  TEST_ASSERT_EQUAL_UINT32(0, dec.invalid);
+  TEST_ASSERT_EQUAL_INT8(0, dec.quarters);
+}
+
+static void test_ccw_periods() {
+  TEST_ASSERT_EQUAL_INT(-20, feed(CCW, 4, 10));
+  TEST_ASSERT_EQUAL_UINT32(0, dec.invalid);
+}
+
+static void test_step_on_second_quarter() {
+  // Erste CLK-Flanke mit DT != CLK => Viertelschritt vorwaerts, noch kein Schritt
+  TEST_ASSERT_EQUAL_INT8(0, quadDecoderFeed(dec, 0x1));
+  TEST_ASSERT_EQUAL_INT8(+1, quadDecoderFeed(dec, 0x0));
+  TEST_ASSERT_EQUAL_INT8(0, quadDecoderFeed(dec, 0x2));
+  TEST_ASSERT_EQUAL_INT8(+1, quadDecoderFeed(dec, 0x3));
+}
+
+static void test_same_state_is_ignored() {
+  TEST_ASSERT_EQUAL_INT8(0, quadDecoderFeed(dec, 0x3));
+  TEST_ASSERT_EQUAL_INT8(0, quadDecoderFeed(dec, 0x3));
+  TEST_ASSERT_EQUAL_INT8(0, dec.quarters);
+  TEST_ASSERT_EQUAL_UINT32(0, dec.invalid);
+}
+
+static void test_bounce_cancels() {
+  // CLK prellt: 11 -> 01 -> 11 -> 01 -> 11 (hin und zurueck), kein Schritt
+  const uint8_t bounce[4] = { 0x1, 0x3, 0x1, 0x3 };
+  TEST_ASSERT_EQUAL_INT(0, feed(bounce, 4, 5));
+  TEST_ASSERT_EQUAL_INT8(0, dec.quarters);
+  TEST_ASSERT_EQUAL_UINT32(0, dec.invalid);
+}
+
+static void test_bounce_then_step() {
+  // Prellen auf CLK, danach sauber weiter: genau ein Schritt
+  const uint8_t seq[6] = { 0x1, 0x3, 0x1, 0x3, 0x1, 0x0 };
+  TEST_ASSERT_EQUAL_INT(1, feed(seq, 6));
+  TEST_ASSERT_EQUAL_UINT32(0, dec.invalid);
+}
+
+static void test_invalid_jump_discarded() {
+  // Beide Bits kippen gleichzeitig (verpasste Flanke): verworfen und gezaehlt
+  TEST_ASSERT_EQUAL_INT8(0, quadDecoderFeed(dec, 0x0));
+  TEST_ASSERT_EQUAL_UINT32(1, dec.invalid);
+  TEST_ASSERT_EQUAL_INT8(0, dec.quarters);
+
+  // Decoder laeuft vom neuen Zustand aus normal weiter
+  TEST_ASSERT_EQUAL_INT8(0, quadDecoderFeed(dec, 0x2));
+  TEST_ASSERT_EQUAL_INT8(+1, quadDecoderFeed(dec, 0x3));
+
+  TEST_ASSERT_EQUAL_INT8(0, quadDecoderFeed(dec, 0x0));   // 11 -> 00
+  TEST_ASSERT_EQUAL_INT8(0, quadDecoderFeed(dec, 0x3));   // 00 -> 11
+  quadDecoderFeed(dec, 0x1);
+  quadDecoderFeed(dec, 0x2);                               // 01 -> 10
+  TEST_ASSERT_EQUAL_UINT32(4, dec.invalid);
+}
+
+static void test_direction_change_mid_step() {
+  // Ein Viertel vor, zwei zurueck: ein Schritt rueckwaerts
+  TEST_ASSERT_EQUAL_INT8(0, quadDecoderFeed(dec, 0x1));    // +1
+  TEST_ASSERT_EQUAL_INT8(0, quadDecoderFeed(dec, 0x3));    // -1
+  TEST_ASSERT_EQUAL_INT8(0, quadDecoderFeed(dec, 0x2));    // -1
+  TEST_ASSERT_EQUAL_INT8(-1, quadDecoderFeed(dec, 0x0));   // -1
+}
+
+static void test_ring_fifo() {
+  for (uint32_t i = 0; i < 10; i++) TEST_ASSERT_TRUE(stepRingPush(ring, 1000 + i, (i & 1) ? -1 : +1));
+
+  EncoderStep s;
+  for (uint32_t i = 0; i < 10; i++) {
+    TEST_ASSERT_TRUE(stepRingPop(ring, s));
+    TEST_ASSERT_EQUAL_UINT32(1000 + i, s.us);
+    TEST_ASSERT_EQUAL_INT8((i & 1) ? -1 : +1, s.dir);
+  }
+  TEST_ASSERT_FALSE(stepRingPop(ring, s));
+}
+
+static void test_ring_full_drops_newest() {
+  for (uint32_t i = 0; i < STEP_RING_SIZE; i++) TEST_ASSERT_TRUE(stepRingPush(ring, i, +1));
+  TEST_ASSERT_FALSE(stepRingPush(ring, 999, +1));
+  TEST_ASSERT_FALSE(stepRingPush(ring, 998, +1));
+  TEST_ASSERT_EQUAL_UINT32(2, ring.dropped.load());
+
+  // Aelteste bleiben erhalten, nach einem Pop ist wieder Platz
+  EncoderStep s;
+  TEST_ASSERT_TRUE(stepRingPop(ring, s));
+  TEST_ASSERT_EQUAL_UINT32(0, s.us);
+  TEST_ASSERT_TRUE(stepRingPush(ring, 500, -1));
+
+  uint32_t n = 0, last = 0;
+  while (stepRingPop(ring, s)) {
+    last = s.us;
+    n++;
+  }
+  TEST_ASSERT_EQUAL_UINT32(STEP_RING_SIZE, n);
+  TEST_ASSERT_EQUAL_UINT32(500, last);
+}
+
+static void test_ring_counter_wrap() {
+  // Freilaufende Zaehler kurz vor 2^32: Differenz head - tail bleibt korrekt
+  ring.head.store(0xFFFFFFF0u);
+  ring.tail.store(0xFFFFFFF0u);
+
+  for (uint32_t i = 0; i < 40; i++) TEST_ASSERT_TRUE(stepRingPush(ring, i, +1));
+  TEST_ASSERT_EQUAL_UINT32(40, ring.head.load() - ring.tail.load());
+
+  EncoderStep s;
+  for (uint32_t i = 0; i < 40; i++) {
+    TEST_ASSERT_TRUE(stepRingPop(ring, s));
+    TEST_ASSERT_EQUAL_UINT32(i, s.us);
+  }
+  TEST_ASSERT_FALSE(stepRingPop(ring, s));
+  TEST_ASSERT_EQUAL_UINT32(0, ring.dropped.load());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_cw_periods);
+  RUN_TEST(test_ccw_periods);
+  RUN_TEST(test_step_on_second_quarter);
+  RUN_TEST(test_same_state_is_ignored);
+  RUN_TEST(test_bounce_cancels);
+  RUN_TEST(test_bounce_then_step);
+  RUN_TEST(test_invalid_jump_discarded);
+  RUN_TEST(test_direction_change_mid_step);
+  RUN_TEST(test_ring_fifo);
+  RUN_TEST(test_ring_full_drops_newest);
+  RUN_TEST(test_ring_counter_wrap);
+  return UNITY_END();
+}
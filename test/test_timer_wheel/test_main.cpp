@@ -0,0 +1,260 @@
+// test/test_timer_wheel/test_main.cpp
+//
+// Host-Test des Timer-Rads (lib/TimerWheel): feste Faelle (Ablauf auf die
+// Millisekunde, delay 0, Cancel, Re-Arm, geparkte Timer) und ein
+// Zufallsvergleich gegen ein triviales Referenzmodell (Ablaufzeit je Timer),
+// auch ueber den millis()-Ueberlauf. Dazu ein zweites Rad wie im Netz-Task.
+//
+// Aufruf: pio test -e native_test -f test_timer_wheel
+
+#include <unity.h>
+
+#include <TimerWheel.h>
+
+#include <random>
+
+static const int N = 64;
+
+static Timer timers[N];
+static uint32_t fired[N];      // Anzahl Aufrufe je Timer
+static uint32_t firedAtMs[N];  // Zeit des letzten Aufrufs
+static uint32_t nowMs;
+
+static void onTimer(void* arg) {
+  const int i = (int)(intptr_t)arg;
+  fired[i]++;
+  firedAtMs[i] = nowMs;
+}
+
+static void start(uint32_t t) {
+  nowMs = t;
+  timerWheelInit(nowMs);
+  for (int i = 0; i < N; i++) {
+    timerInit(timers[i], onTimer, (void*)(intptr_t)i);
+    fired[i] = 0;
+    firedAtMs[i] = 0;
+  }
+}
+
+// Millisekunde fuer Millisekunde bis t abarbeiten
+static void runTo(uint32_t t) {
+  while (nowMs != t) {
+    nowMs++;
+    timerRun(nowMs);
+  }
+}
+
+void setUp() {
+  start(1000);
+}
+
+void tearDown() {}
+
+static void test_fires_on_exact_ms() {
+  timerArm(timers[0], nowMs, 1);
+  timerArm(timers[1], nowMs, 255);
+  timerArm(timers[2], nowMs, 256);      // erster grober Slot
+  timerArm(timers[3], nowMs, 16385);    // zweite Ebene
+
+  const uint32_t t0 = nowMs;
+  runTo(t0 + 20000);
+  TEST_ASSERT_EQUAL_UINT32(1, fired[0]);
+  TEST_ASSERT_EQUAL_UINT32(t0 + 1, firedAtMs[0]);
+  TEST_ASSERT_EQUAL_UINT32(t0 + 255, firedAtMs[1]);
+  TEST_ASSERT_EQUAL_UINT32(t0 + 256, firedAtMs[2]);
+  TEST_ASSERT_EQUAL_UINT32(t0 + 16385, firedAtMs[3]);
+  TEST_ASSERT_FALSE(timerArmed(timers[3]));
+}
+
+static void test_delay_zero_fires_next_ms() {
+  timerRun(nowMs);
+  timerArm(timers[0], nowMs, 0);
+  TEST_ASSERT_EQUAL_UINT32(1, timerNextDeadlineMs(nowMs));
+  TEST_ASSERT_EQUAL_UINT16(0, timerRun(nowMs));
+  TEST_ASSERT_EQUAL_UINT32(0, fired[0]);
+
+  runTo(nowMs + 1);
+  TEST_ASSERT_EQUAL_UINT32(1, fired[0]);
+}
+
+static void test_cancel_and_rearm() {
+  timerArm(timers[0], nowMs, 50);
+  timerArm(timers[1], nowMs, 50);
+  timerCancel(timers[0]);
+  timerCancel(timers[0]);                 // doppelt: nichts
+  TEST_ASSERT_FALSE(timerArmed(timers[0]));
+
+  // Laufenden Timer verschieben: nur der neue Ablauf zaehlt
+  timerArm(timers[1], nowMs, 500);
+  const uint32_t t0 = nowMs;
+  runTo(t0 + 1000);
+  TEST_ASSERT_EQUAL_UINT32(0, fired[0]);
+  TEST_ASSERT_EQUAL_UINT32(1, fired[1]);
+  TEST_ASSERT_EQUAL_UINT32(t0 + 500, firedAtMs[1]);
+}
+
+static void test_far_timer_parked() {
+  // Jenseits der groben Ebenen (> 2^20 ms): geparkt und spaeter neu eingehaengt
+  const uint32_t delay = (1UL << 20) + 12345;
+  timerArm(timers[0], nowMs, delay);
+  TEST_ASSERT_EQUAL_UINT32(delay, timerNextDeadlineMs(nowMs));
+
+  const uint32_t t0 = nowMs;
+  runTo(t0 + delay - 1);
+  TEST_ASSERT_EQUAL_UINT32(0, fired[0]);
+  TEST_ASSERT_EQUAL_UINT32(1, timerNextDeadlineMs(nowMs));
+  runTo(t0 + delay);
+  TEST_ASSERT_EQUAL_UINT32(1, fired[0]);
+}
+
+static void test_deadline_query() {
+  TEST_ASSERT_EQUAL_UINT32(TIMER_NO_DEADLINE, timerNextDeadlineMs(nowMs));
+
+  timerArm(timers[0], nowMs, 700);
+  timerArm(timers[1], nowMs, 40);
+  TEST_ASSERT_EQUAL_UINT32(40, timerNextDeadlineMs(nowMs));
+
+  // Zeit laeuft ohne timerRun(): ueberfaellig => 0
+  TEST_ASSERT_EQUAL_UINT32(0, timerNextDeadlineMs(nowMs + 60));
+
+  // Angebrochene Millisekunde wird abgezogen
+  TEST_ASSERT_EQUAL_UINT32(40 * 1000UL - 300, timerIdleUs(nowMs, nowMs * 1000UL + 300));
+
+  runTo(nowMs + 40);
+  TEST_ASSERT_EQUAL_UINT32(660, timerNextDeadlineMs(nowMs));
+}
+
+static void test_second_wheel_independent() {
+  // Timer binden sich beim timerInit() an das gewaehlte Rad
+  static TimerWheel other;
+  timerWheelInit(other, nowMs);
+  timerWheelSelect(&other);
+  timerInit(timers[1], onTimer, (void*)(intptr_t)1);
+  timerWheelSelect(nullptr);
+
+  timerArm(timers[0], nowMs, 10);
+  timerArm(timers[1], nowMs, 20);
+  TEST_ASSERT_EQUAL_UINT32(10, timerNextDeadlineMs(nowMs));
+  TEST_ASSERT_EQUAL_UINT32(20, timerNextDeadlineMs(other, nowMs));
+
+  // Nur das Standardrad laeuft: Timer 1 bleibt liegen
+  const uint32_t t0 = nowMs;
+  runTo(t0 + 50);
+  TEST_ASSERT_EQUAL_UINT32(1, fired[0]);
+  TEST_ASSERT_EQUAL_UINT32(0, fired[1]);
+  TEST_ASSERT_EQUAL_UINT32(TIMER_NO_DEADLINE, timerNextDeadlineMs(nowMs));
+  TEST_ASSERT_EQUAL_UINT32(0, timerNextDeadlineMs(other, nowMs));
+
+  TEST_ASSERT_EQUAL_UINT16(1, timerRun(other, nowMs));
+  TEST_ASSERT_EQUAL_UINT32(1, fired[1]);
+
+  // Cancel findet das richtige Rad
+  timerArm(timers[1], nowMs, 5);
+  timerCancel(timers[1]);
+  TEST_ASSERT_EQUAL_UINT32(TIMER_NO_DEADLINE, timerNextDeadlineMs(other, nowMs));
+}
+
+// ---------------------------------------------------------------------------
+// Zufallsvergleich gegen das Referenzmodell
+// ---------------------------------------------------------------------------
+
+static bool refArmed[N];
+static uint32_t refExpires[N];
+static uint32_t errors;
+static std::mt19937 rng;
+
+static void onTimerRef(void* arg) {
+  const int i = (int)(intptr_t)arg;
+  if (!refArmed[i]) errors++;                              // nicht (mehr) aktiv
+  if ((int32_t)(refExpires[i] - nowMs) > 0) errors++;      // zu frueh
+  refArmed[i] = false;
+
+  // Callbacks stoppen fremde Timer und starten sich selbst neu
+  if (rng() % 4 == 0) {
+    const int j = rng() % N;
+    timerCancel(timers[j]);
+    refArmed[j] = false;
+  }
+  if (rng() % 3 == 0) {
+    const uint32_t d = 1 + rng() % 3000;
+    timerArm(timers[i], nowMs, d);
+    refArmed[i] = true;
+    refExpires[i] = nowMs + d;
+  }
+}
+
+static uint32_t refDeadline() {
+  uint32_t best = TIMER_NO_DEADLINE;
+  for (int k = 0; k < N; k++) {
+    if (!refArmed[k]) continue;
+    const int32_t d = (int32_t)(refExpires[k] - nowMs);
+    const uint32_t u = d > 0 ? (uint32_t)d : 0;
+    if (u < best) best = u;
+  }
+  return best;
+}
+
+static void fuzz(uint32_t startMs, uint32_t seed) {
+  nowMs = startMs;
+  timerWheelInit(nowMs);
+  rng.seed(seed);
+  errors = 0;
+  for (int i = 0; i < N; i++) {
+    timerInit(timers[i], onTimerRef, (void*)(intptr_t)i);
+    refArmed[i] = false;
+  }
+  timerRun(nowMs);
+
+  for (uint32_t step = 0; step < 200000 && errors == 0; step++) {
+    const uint32_t op = rng() % 10;
+    const int i = rng() % N;
+
+    if (op < 3) {
+      // Meist kurz, manchmal grob, selten geparkt
+      const uint32_t r = rng() % 10;
+      const uint32_t d = r < 6 ? rng() % 300 : r < 9 ? rng() % 20000 : rng() % 3000000;
+      timerArm(timers[i], nowMs, d);
+      refArmed[i] = true;
+      refExpires[i] = nowMs + (d ? d : 1);
+    } else if (op < 4) {
+      timerCancel(timers[i]);
+      refArmed[i] = false;
+    } else {
+      const uint32_t best = refDeadline();
+      TEST_ASSERT_EQUAL_UINT32(best, timerNextDeadlineMs(nowMs));
+
+      // Wie die Hauptschleife: bis zur Deadline schlafen oder frueher aufwachen
+      const uint32_t adv = rng() % 3 == 0 ? (best == TIMER_NO_DEADLINE ? rng() % 5000 : best) : rng() % 50;
+      nowMs += adv;
+      timerRun(nowMs);
+
+      for (int k = 0; k < N; k++) {
+        if (refArmed[k] && (int32_t)(refExpires[k] - nowMs) <= 0) errors++;   // verpasst
+      }
+    }
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, errors);
+}
+
+static void test_random_against_reference() {
+  fuzz(0, 1);
+  fuzz(0, 7);
+}
+
+static void test_random_across_millis_wrap() {
+  fuzz(0xFFFF0000UL, 2);
+  fuzz(0xFFFFFF00UL, 3);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_fires_on_exact_ms);
+  RUN_TEST(test_delay_zero_fires_next_ms);
+  RUN_TEST(test_cancel_and_rearm);
+  RUN_TEST(test_far_timer_parked);
+  RUN_TEST(test_deadline_query);
+  RUN_TEST(test_second_wheel_independent);
+  RUN_TEST(test_random_against_reference);
+  RUN_TEST(test_random_across_millis_wrap);
+  return UNITY_END();
+}